@@ -0,0 +1,1119 @@
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include "gset.h"
+
+// Loop from 0 to (N - 1)
+#define FOR(I, N) for (size_t I = 0; I < N; ++I)
+
+// Number of elements used by the benchmarks
+#define NB_ELEM 10000000
+
+// Get the current time in seconds
+static double Now(
+  void) {
+
+  struct timespec t;
+  timespec_get(&t, TIME_UTC);
+  return (double)(t.tv_sec) + (double)(t.tv_nsec) * 1e-9;
+
+}
+
+// Print the result of a benchmark
+// Inputs:
+//   label: the label of the benchmark
+//      nb: the number of operations
+//     sec: the time in seconds
+static void PrintResult(
+  char const* const label,
+        size_t const nb,
+        double const sec) {
+
+  printf("  %-44s %8.3fs %8.2fns/op\n", label, sec, sec * 1e9 / (double)nb);
+
+}
+
+// Typed allocation protected by a Try block, as done before
+// GSet<N>AllocNoExc
+static GSetLong* AllocWithTry(
+  void) {
+
+  GSetLong* that = malloc(sizeof(GSetLong));
+  if (that == NULL) Raise(TryCatchExc_MallocFailed);
+  Try {
+    *that = (GSetLong){ .s = GSetAlloc() };
+  } CatchDefault {
+    free(that);
+  } EndCatch;
+  ForwardExc();
+  return that;
+
+}
+
+// Benchmark of the overhead of TryCatchC avoided by the exception free
+// functions
+static void BenchTryCatch(
+  void) {
+
+  printf("Exception free functions vs TryCatchC\n");
+  GSetLong* set = GSetLongAlloc();
+  volatile long sink = 0;
+
+  // Draining a set, testing its size before each GSetPop
+  FOR(i, NB_ELEM) GSetAdd(set, (long)i);
+  double t = Now();
+  while (GSetGetSize(set) > 0) sink += GSetPop(set);
+  PrintResult("GSetPop after GSetGetSize", NB_ELEM, Now() - t);
+
+  // Draining a set, each GSetPop in a Try block
+  FOR(i, NB_ELEM) GSetAdd(set, (long)i);
+  t = Now();
+  bool isEmpty = false;
+  while (isEmpty == false) {
+
+    Try {
+      sink += GSetPop(set);
+    } Catch(TryCatchExc_OutOfRange) {
+      isEmpty = true;
+    } EndCatch;
+
+  }
+  PrintResult("GSetPop in Try block", NB_ELEM, Now() - t);
+
+  // Draining a set with GSetTryPop
+  FOR(i, NB_ELEM) GSetAdd(set, (long)i);
+  t = Now();
+  long v = 0;
+  while (GSetTryPop(set, &v)) sink += v;
+  PrintResult("GSetTryPop", NB_ELEM, Now() - t);
+
+  // Pop on an empty set, the raised exception is caught
+  size_t const nbEmpty = NB_ELEM / 10;
+  t = Now();
+  FOR(i, nbEmpty) {
+
+    Try {
+      sink += GSetPop(set);
+    } Catch(TryCatchExc_OutOfRange) {
+      ++sink;
+    } EndCatch;
+
+  }
+  PrintResult("GSetPop on empty set, exception caught", nbEmpty, Now() - t);
+
+  // Pop on an empty set with GSetTryPop
+  t = Now();
+  FOR(i, nbEmpty) if (GSetTryPop(set, &v) == false) ++sink;
+  PrintResult("GSetTryPop on empty set", nbEmpty, Now() - t);
+
+  // Reading elements through an iterator, each GSetGet in a Try block
+  FOR(i, NB_ELEM) GSetAdd(set, (long)i);
+  GSetIterLong* iter = GSetIterLongAlloc(set);
+  t = Now();
+  bool isEnd = false;
+  while (isEnd == false) {
+
+    Try {
+      sink += GSetGet(iter);
+      if (GSetIterNext(iter) == false) isEnd = true;
+    } Catch(TryCatchExc_OutOfRange) {
+      isEnd = true;
+    } EndCatch;
+
+  }
+  PrintResult("GSetGet in Try block", NB_ELEM, Now() - t);
+
+  // Reading elements through an iterator with GSetTryGet
+  GSetIterReset(iter);
+  t = Now();
+  do {
+    if (GSetTryGet(iter, &v)) sink += v;
+  } while (GSetIterNext(iter));
+  PrintResult("GSetTryGet", NB_ELEM, Now() - t);
+  GSetIterFree(&iter);
+  GSetFree(&set);
+
+  // Allocation of typed sets
+  size_t const nbAlloc = NB_ELEM / 10;
+  t = Now();
+  FOR(i, nbAlloc) {
+
+    GSetLong* s = AllocWithTry();
+    GSetFree(&s);
+
+  }
+  PrintResult("typed alloc with Try block", nbAlloc, Now() - t);
+  t = Now();
+  FOR(i, nbAlloc) {
+
+    GSetLong* s = GSetLongAllocNoExc();
+    GSetFree(&s);
+
+  }
+  PrintResult("GSetLongAllocNoExc", nbAlloc, Now() - t);
+  (void)sink;
+
+}
+
+// Benchmark of the consumption of a set one data at a time versus by
+// batches
+static void BenchPopArr(
+  void) {
+
+  printf("Batched pop/drop\n");
+  GSetLong* set = GSetLongAlloc();
+  volatile long sink = 0;
+  long v = 0;
+
+  // Draining a set one data at a time
+  FOR(i, NB_ELEM) GSetAdd(set, (long)i);
+  double t = Now();
+  while (GSetTryPop(set, &v)) sink += v;
+  PrintResult("GSetTryPop", NB_ELEM, Now() - t);
+  FOR(i, NB_ELEM) GSetAdd(set, (long)i);
+  t = Now();
+  while (GSetTryDrop(set, &v)) sink += v;
+  PrintResult("GSetTryDrop", NB_ELEM, Now() - t);
+
+  // Draining a set by batches
+  long buf[256];
+  FOR(i, NB_ELEM) GSetAdd(set, (long)i);
+  t = Now();
+  size_t nb = 0;
+  while ((nb = GSetPopArr(set, 256, buf)) > 0) FOR(i, nb) sink += buf[i];
+  PrintResult("GSetPopArr by 256", NB_ELEM, Now() - t);
+  FOR(i, NB_ELEM) GSetAdd(set, (long)i);
+  t = Now();
+  while ((nb = GSetDropArr(set, 256, buf)) > 0) FOR(i, nb) sink += buf[i];
+  PrintResult("GSetDropArr by 256", NB_ELEM, Now() - t);
+  GSetFree(&set);
+  (void)sink;
+
+}
+
+// Benchmark of a rolling window of samples
+static void BenchBounded(
+  void) {
+
+  printf("Rolling window of 1000 samples\n");
+  size_t const nbWindow = 1000;
+
+  // Add a sample and pop the oldest one when the window is full
+  GSetDouble* set = GSetDoubleAlloc();
+  double t = Now();
+  FOR(i, NB_ELEM) {
+
+    GSetAdd(set, (double)i);
+    if (GSetGetSize(set) > nbWindow) (void)GSetPop(set);
+
+  }
+  PrintResult("GSetAdd and GSetPop", NB_ELEM, Now() - t);
+  GSetFree(&set);
+
+  // Add a sample in a bounded set overwriting the oldest one
+  set = GSetDoubleAllocBounded(nbWindow, GSetBounded_Overwrite);
+  t = Now();
+  FOR(i, NB_ELEM) GSetAdd(set, (double)i);
+  PrintResult("GSetAdd in bounded set", NB_ELEM, Now() - t);
+  GSetFree(&set);
+
+  // Add a sample and get the sum, minimum and maximum of the window
+  size_t const nbQuery = NB_ELEM / 100;
+  volatile double sink = 0.0;
+  set = GSetDoubleAllocBounded(nbWindow, GSetBounded_Overwrite);
+  t = Now();
+  FOR(i, nbQuery) {
+
+    GSetAdd(set, (double)((i * 7919) % 1000));
+    double min = 0.0;
+    double max = 0.0;
+    GSetMinMax(set, &min, &max);
+    sink += GSetSum(set) + min + max;
+
+  }
+  PrintResult("GSetAdd, GSetSum and GSetMinMax", nbQuery, Now() - t);
+  GSetFree(&set);
+  set = GSetDoubleAllocBounded(nbWindow, GSetBounded_Overwrite);
+  GSetAttachWindow(set);
+  t = Now();
+  FOR(i, nbQuery) {
+
+    GSetAdd(set, (double)((i * 7919) % 1000));
+    sink += GSetWindowSum(set) + GSetWindowMin(set) + GSetWindowMax(set);
+
+  }
+  PrintResult("GSetAdd and GSetWindowSum/Min/Max", nbQuery, Now() - t);
+  GSetFree(&set);
+  (void)sink;
+
+}
+
+// Number of data per producer thread in the concurrent queue benchmark
+#define NB_CONC_DATA 1000000
+
+// Queues shared by the producer threads
+static GSetLong* concSet = NULL;
+static pthread_mutex_t concMutex = PTHREAD_MUTEX_INITIALIZER;
+static GSetConcLong* concQueue = NULL;
+
+// Producer adding data to the mutex guarded set
+static void* ProduceMutex(
+  void* arg) {
+
+  FOR(i, NB_CONC_DATA) {
+
+    pthread_mutex_lock(&concMutex);
+    GSetAdd(concSet, (long)i);
+    pthread_mutex_unlock(&concMutex);
+
+  }
+  return arg;
+
+}
+
+// Producer adding data to the concurrent queue
+static void* ProduceConc(
+  void* arg) {
+
+  FOR(i, NB_CONC_DATA) GSetConcAdd(concQueue, (long)i);
+  return arg;
+
+}
+
+// Benchmark of a work queue between several producers and one consumer
+static void BenchConc(
+  void) {
+
+  printf("Work queue, %d data per producer\n", NB_CONC_DATA);
+  volatile long sink = 0;
+  size_t const nbProducers[] = {1, 2, 4, 8};
+  FOR(iNb, sizeof(nbProducers) / sizeof(nbProducers[0])) {
+
+    size_t const nbThread = nbProducers[iNb];
+    size_t const nbData = nbThread * NB_CONC_DATA;
+    pthread_t threads[8];
+    char label[64];
+
+    // Mutex guarded GSetAdd/GSetTryPop
+    concSet = GSetLongAlloc();
+    double t = Now();
+    FOR(i, nbThread) pthread_create(threads + i, NULL, ProduceMutex, NULL);
+    size_t nbPop = 0;
+    long v = 0;
+    while (nbPop < nbData) {
+
+      pthread_mutex_lock(&concMutex);
+      bool isPopped = GSetTryPop(concSet, &v);
+      pthread_mutex_unlock(&concMutex);
+      if (isPopped) {
+
+        sink += v;
+        ++nbPop;
+
+      }
+
+    }
+    FOR(i, nbThread) pthread_join(threads[i], NULL);
+    snprintf(label, sizeof(label), "mutex guarded GSet, %zu producer(s)",
+      nbThread);
+    PrintResult(label, nbData, Now() - t);
+    GSetFree(&concSet);
+
+    // GSetConcAdd/GSetConcPop
+    concQueue = GSetConcLongAlloc();
+    t = Now();
+    FOR(i, nbThread) pthread_create(threads + i, NULL, ProduceConc, NULL);
+    nbPop = 0;
+    while (nbPop < nbData) {
+
+      if (GSetConcPop(concQueue, &v)) {
+
+        sink += v;
+        ++nbPop;
+
+      }
+
+    }
+    FOR(i, nbThread) pthread_join(threads[i], NULL);
+    snprintf(label, sizeof(label), "GSetConc, %zu producer(s)", nbThread);
+    PrintResult(label, nbData, Now() - t);
+    GSetConcFree(&concQueue);
+
+  }
+  (void)sink;
+
+}
+
+// Ring queue shared by the producer and consumer threads, and size of the
+// batches (1 for one data at a time)
+static GSetSpscLong* spscQueue = NULL;
+static size_t spscBatch = 1;
+
+// Producer adding data to the ring queue
+static void* ProduceSpsc(
+  void* arg) {
+
+  long batch[256];
+  long v = 0;
+  while (v < NB_ELEM) {
+
+    size_t nb = 0;
+    if (spscBatch == 1) {
+
+      nb = (GSetSpscAdd(spscQueue, v) ? 1 : 0);
+
+    } else {
+
+      FOR(i, spscBatch) batch[i] = v + (long)i;
+      size_t nbAdd = spscBatch;
+      if (v + (long)nbAdd > NB_ELEM) nbAdd = (size_t)(NB_ELEM - v);
+      nb = GSetSpscAddArr(spscQueue, nbAdd, batch);
+
+    }
+
+    if (nb == 0) sched_yield();
+    v += (long)nb;
+
+  }
+  return arg;
+
+}
+
+// Benchmark of a pipeline between one producer and one consumer
+static void BenchSpsc(
+  void) {
+
+  printf("Pipeline, one producer and one consumer\n");
+  volatile long sink = 0;
+  pthread_t thread;
+
+  // Mutex guarded GSetAdd/GSetTryPop
+  concSet = GSetLongAlloc();
+  double t = Now();
+  pthread_create(&thread, NULL, ProduceMutex, NULL);
+  size_t nbPop = 0;
+  long v = 0;
+  while (nbPop < NB_CONC_DATA) {
+
+    pthread_mutex_lock(&concMutex);
+    bool isPopped = GSetTryPop(concSet, &v);
+    pthread_mutex_unlock(&concMutex);
+    if (isPopped) {
+
+      sink += v;
+      ++nbPop;
+
+    } else sched_yield();
+
+  }
+  pthread_join(thread, NULL);
+  PrintResult("mutex guarded GSet", NB_CONC_DATA, Now() - t);
+  GSetFree(&concSet);
+
+  // GSetSpscAdd/GSetSpscPop one at a time, then by batches
+  long batch[256];
+  size_t const batches[] = {1, 16, 256};
+  FOR(iBatch, sizeof(batches) / sizeof(batches[0])) {
+
+    spscBatch = batches[iBatch];
+    spscQueue = GSetSpscLongAlloc(4096);
+    t = Now();
+    pthread_create(&thread, NULL, ProduceSpsc, NULL);
+    nbPop = 0;
+    while (nbPop < NB_ELEM) {
+
+      size_t nb = 0;
+      if (spscBatch == 1) {
+
+        if (GSetSpscPop(spscQueue, &v)) {
+
+          sink += v;
+          nb = 1;
+
+        }
+
+      } else {
+
+        nb = GSetSpscPopArr(spscQueue, spscBatch, batch);
+        FOR(i, nb) sink += batch[i];
+
+      }
+
+      if (nb == 0) sched_yield();
+      nbPop += nb;
+
+    }
+    pthread_join(thread, NULL);
+    char label[64];
+    snprintf(label, sizeof(label), "GSetSpsc, batches of %zu", spscBatch);
+    PrintResult(label, NB_ELEM, Now() - t);
+    GSetSpscFree(&spscQueue);
+
+  }
+  (void)sink;
+
+}
+
+// Depth of the tree of tasks, number of iterations of the work of a task
+// and maximum number of workers in the scheduler benchmark
+#define SCHED_DEPTH 18
+#define SCHED_WORK 200
+#define SCHED_MAX_WORKER 8
+
+// Tasks of the scheduler benchmark, the task i spawns the tasks 2i+1 and
+// 2i+2. Only the root task is given to the first worker, the others get
+// their tasks by stealing
+static size_t const schedNbTask = ((size_t)1 << (SCHED_DEPTH + 1)) - 1;
+static char* schedTasks = NULL;
+
+// Workers of the scheduler benchmark
+struct SchedWorker {
+
+  size_t id;
+  size_t nbWorker;
+  GSetDeque** deques;
+  atomic_size_t* nbDone;
+  size_t nbRun;
+  double sink;
+
+};
+
+// Run a task, spawning its children in the deque of the worker
+static void SchedRun(
+  struct SchedWorker* const worker,
+               char* const task) {
+
+  size_t iTask = (size_t)(task - schedTasks);
+  double v = (double)iTask;
+  FOR(i, SCHED_WORK) v = v * 0.999 + 1.0;
+  worker->sink += v;
+  FOR(iChild, 2) {
+
+    size_t iChildTask = 2 * iTask + 1 + iChild;
+    if (iChildTask < schedNbTask)
+      GSetDequePush(worker->deques[worker->id], schedTasks + iChildTask);
+
+  }
+  ++(worker->nbRun);
+  atomic_fetch_add_explicit(worker->nbDone, 1, memory_order_relaxed);
+
+}
+
+// Worker thread of the scheduler benchmark, running the tasks of its deque
+// and stealing tasks from a random other worker when its deque is empty
+static void* SchedWork(
+  void* arg) {
+
+  struct SchedWorker* worker = arg;
+  unsigned int seed = (unsigned int)worker->id * 2654435761u + 1u;
+  void* task = NULL;
+  while (atomic_load_explicit(worker->nbDone, memory_order_relaxed) <
+    schedNbTask) {
+
+    if (GSetDequePop(worker->deques[worker->id], &task)) {
+
+      SchedRun(worker, task);
+
+    } else if (worker->nbWorker > 1) {
+
+      seed ^= seed << 13;
+      seed ^= seed >> 17;
+      seed ^= seed << 5;
+      size_t victim = seed % worker->nbWorker;
+      if (victim != worker->id &&
+        GSetDequeSteal(worker->deques[victim], &task))
+        SchedRun(worker, task);
+      else sched_yield();
+
+    }
+
+  }
+  return NULL;
+
+}
+
+// Benchmark of a work-stealing scheduler running a tree of tasks
+static void BenchDeque(
+  void) {
+
+  printf("Work-stealing scheduler, %zu tasks\n", schedNbTask);
+  schedTasks = malloc(schedNbTask);
+  if (schedTasks == NULL) Raise(TryCatchExc_MallocFailed);
+  size_t const nbWorkers[] = {1, 2, 4, SCHED_MAX_WORKER};
+  FOR(iNb, sizeof(nbWorkers) / sizeof(nbWorkers[0])) {
+
+    size_t const nbWorker = nbWorkers[iNb];
+    GSetDeque* deques[SCHED_MAX_WORKER];
+    struct SchedWorker workers[SCHED_MAX_WORKER];
+    pthread_t threads[SCHED_MAX_WORKER];
+    atomic_size_t nbDone;
+    atomic_init(&nbDone, 0);
+    FOR(i, nbWorker) {
+
+      deques[i] = GSetDequeAlloc();
+      workers[i] = (struct SchedWorker){
+        .id = i, .nbWorker = nbWorker, .deques = deques, .nbDone = &nbDone,
+        .nbRun = 0, .sink = 0.0 };
+
+    }
+    GSetDequePush(deques[0], schedTasks);
+    double t = Now();
+    for (size_t i = 1; i < nbWorker; ++i)
+      pthread_create(threads + i, NULL, SchedWork, workers + i);
+    SchedWork(workers);
+    for (size_t i = 1; i < nbWorker; ++i) pthread_join(threads[i], NULL);
+    char label[64];
+    snprintf(label, sizeof(label), "GSetDeque, %zu worker(s)", nbWorker);
+    PrintResult(label, schedNbTask, Now() - t);
+    printf("    tasks per worker:");
+    FOR(i, nbWorker) {
+
+      printf(" %.1f%%", 100.0 * (double)workers[i].nbRun /
+        (double)schedNbTask);
+      GSetDequeFree(deques + i);
+
+    }
+    printf("\n");
+
+  }
+  free(schedTasks);
+
+}
+
+// Condition signaled when data are added to the mutex guarded set, and
+// blocking queue shared by the producer threads
+static pthread_cond_t concCond = PTHREAD_COND_INITIALIZER;
+static GSetBlockingQueueLong* blockingQueue = NULL;
+static size_t blockingBatch = 1;
+
+// Producer adding data to the mutex guarded set and signaling the consumer
+static void* ProduceCond(
+  void* arg) {
+
+  FOR(i, NB_CONC_DATA) {
+
+    pthread_mutex_lock(&concMutex);
+    GSetAdd(concSet, (long)i);
+    pthread_cond_signal(&concCond);
+    pthread_mutex_unlock(&concMutex);
+
+  }
+  return arg;
+
+}
+
+// Producer adding data to the blocking queue, one at a time or by batches
+static void* ProduceBlocking(
+  void* arg) {
+
+  long batch[256];
+  for (size_t i = 0; i < NB_CONC_DATA; i += blockingBatch) {
+
+    if (blockingBatch == 1) {
+
+      GSetBlockingQueueAdd(blockingQueue, (long)i);
+
+    } else {
+
+      FOR(j, blockingBatch) batch[j] = (long)(i + j);
+      GSetBlockingQueueAddArr(blockingQueue, blockingBatch, batch);
+
+    }
+
+  }
+  return arg;
+
+}
+
+// Benchmark of a blocking queue between producers and one consumer
+static void BenchBlockingQueue(
+  void) {
+
+  printf("Blocking queue, %d data per producer\n", NB_CONC_DATA);
+  volatile long sink = 0;
+  size_t const nbProducers[] = {1, 4};
+  FOR(iNb, sizeof(nbProducers) / sizeof(nbProducers[0])) {
+
+    size_t const nbThread = nbProducers[iNb];
+    size_t const nbData = nbThread * NB_CONC_DATA;
+    pthread_t threads[4];
+    char label[64];
+
+    // Mutex and condition guarded GSetAdd/GSetPop
+    concSet = GSetLongAlloc();
+    double t = Now();
+    FOR(i, nbThread) pthread_create(threads + i, NULL, ProduceCond, NULL);
+    FOR(iData, nbData) {
+
+      pthread_mutex_lock(&concMutex);
+      while (GSetGetSize(concSet) == 0)
+        pthread_cond_wait(&concCond, &concMutex);
+      sink += GSetPop(concSet);
+      pthread_mutex_unlock(&concMutex);
+
+    }
+    FOR(i, nbThread) pthread_join(threads[i], NULL);
+    snprintf(label, sizeof(label), "mutex/cond GSet, %zu producer(s)",
+      nbThread);
+    PrintResult(label, nbData, Now() - t);
+    GSetFree(&concSet);
+
+    // GSetBlockingQueue one at a time, then by batches, without maximum
+    // capacity and bounded
+    size_t const batches[] = {1, 64, 64};
+    size_t const capacities[] = {0, 0, 4096};
+    FOR(iBatch, sizeof(batches) / sizeof(batches[0])) {
+
+      blockingBatch = batches[iBatch];
+      blockingQueue = GSetBlockingQueueLongAlloc(capacities[iBatch]);
+      t = Now();
+      FOR(i, nbThread)
+        pthread_create(threads + i, NULL, ProduceBlocking, NULL);
+      long buf[256];
+      size_t nbPop = 0;
+      while (nbPop < nbData) {
+
+        size_t nb = GSetBlockingQueuePopArr(blockingQueue, blockingBatch, buf);
+        FOR(i, nb) sink += buf[i];
+        nbPop += nb;
+
+      }
+      FOR(i, nbThread) pthread_join(threads[i], NULL);
+      snprintf(label, sizeof(label),
+        "GSetBlockingQueue(%zu) by %zu, %zu prod.",
+        capacities[iBatch], blockingBatch, nbThread);
+      PrintResult(label, nbData, Now() - t);
+      GSetBlockingQueueFree(&blockingQueue);
+
+    }
+
+  }
+  (void)sink;
+
+}
+
+// Number of elements of the set and duration in seconds of the
+// concurrent-read benchmark
+#define EPOCH_NB_ELEM 1000
+#define EPOCH_DURATION 0.5
+
+// Set shared by the readers and the writer, flags set when the readers
+// must stop and when they must use the mutex instead of the epochs
+static GSetLong* epochSet = NULL;
+static atomic_bool epochIsDone;
+static bool epochWithMutex = false;
+
+// Reader iterating on the set in read sections, or under the mutex
+static void* ReadEpoch(
+  void* arg) {
+
+  GSetIterLong* iter = GSetIterLongAlloc(epochSet);
+  size_t nbRead = 0;
+  long sum = 0;
+  while (atomic_load_explicit(&epochIsDone, memory_order_relaxed) == false) {
+
+    size_t slot = 0;
+    if (epochWithMutex) pthread_mutex_lock(&concMutex);
+    else slot = GSetEpochEnter(epochSet);
+    GSetIterReset(iter);
+    long v = 0;
+    if (GSetIterIsReady(iter)) do {
+
+      if (GSetTryGet(iter, &v)) sum += v;
+      ++nbRead;
+
+    } while (GSetIterNext(iter));
+    if (epochWithMutex) pthread_mutex_unlock(&concMutex);
+    else GSetEpochLeave(epochSet, slot);
+
+  }
+  GSetIterFree(&iter);
+  *(size_t*)arg = nbRead + (sum == -1 ? 1 : 0);
+  return NULL;
+
+}
+
+// Benchmark of readers iterating on a set while one writer updates it
+static void BenchEpoch(
+  void) {
+
+  printf("Readers iterating on a set of %d data, one writer\n",
+    EPOCH_NB_ELEM);
+  size_t const nbReaders[] = {1, 2, 4};
+  FOR(iMode, 2) FOR(iNb, sizeof(nbReaders) / sizeof(nbReaders[0])) {
+
+    epochWithMutex = (iMode == 0);
+    size_t const nbThread = nbReaders[iNb];
+    epochSet = GSetLongAlloc();
+    if (epochWithMutex == false) GSetAttachEpoch(epochSet);
+    FOR(i, EPOCH_NB_ELEM) GSetAdd(epochSet, (long)i);
+    atomic_init(&epochIsDone, false);
+    pthread_t threads[4];
+    size_t nbRead[4] = {0};
+    FOR(i, nbThread)
+      pthread_create(threads + i, NULL, ReadEpoch, nbRead + i);
+
+    // The writer replaces the oldest data with a new one every
+    // microsecond or so
+    double t = Now();
+    long v = EPOCH_NB_ELEM;
+    while (Now() - t < EPOCH_DURATION) {
+
+      if (epochWithMutex) pthread_mutex_lock(&concMutex);
+      (void)GSetPop(epochSet);
+      GSetAdd(epochSet, v);
+      if (epochWithMutex) pthread_mutex_unlock(&concMutex);
+      ++v;
+      sched_yield();
+
+    }
+    atomic_store(&epochIsDone, true);
+    FOR(i, nbThread) pthread_join(threads[i], NULL);
+    double sec = Now() - t;
+    size_t nbTotal = 0;
+    FOR(i, nbThread) nbTotal += nbRead[i];
+    char label[64];
+    snprintf(label, sizeof(label), "%s, %zu reader(s)",
+      (epochWithMutex ? "mutex" : "GSetEpochEnter/Leave"), nbThread);
+    PrintResult(label, nbTotal, sec);
+    GSetFree(&epochSet);
+
+  }
+
+}
+
+// Number of operations per thread, range of the data and number of shards
+// of the sharded set benchmark
+#define SHARDED_NB_OP 200000
+#define SHARDED_RANGE 65536
+#define SHARDED_NB_SHARD 64
+#define SHARDED_MAX_THREAD 32
+
+// Sets shared by the threads, the sharded one or the one guarded by
+// concMutex
+static GSetShardedLong* shardedSet = NULL;
+
+// Thread applying a mix of 80% lookups, 10% additions and 10% removals of
+// pseudo random data, on the sharded set or on concSet under the mutex
+static void* MixSharded(
+  void* arg) {
+
+  uint64_t x = 0x9e3779b97f4a7c15ULL * ((uintptr_t)arg + 1);
+  size_t nbFound = 0;
+  FOR(iOp, SHARDED_NB_OP) {
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    long v = (long)((x >> 8) % SHARDED_RANGE);
+    unsigned op = (unsigned)(x & 0xff) % 10;
+    if (shardedSet != NULL) {
+
+      if (op == 0) (void)GSetShardedAdd(shardedSet, v);
+      else if (op == 1) (void)GSetShardedRemove(shardedSet, v);
+      else nbFound += GSetShardedContains(shardedSet, v);
+
+    } else {
+
+      pthread_mutex_lock(&concMutex);
+      if (op == 0) {
+
+        if (GSetContains(concSet, v) == false) GSetAdd(concSet, v);
+
+      } else if (op == 1) (void)GSetRemove(concSet, v);
+      else nbFound += GSetContains(concSet, v);
+      pthread_mutex_unlock(&concMutex);
+
+    }
+
+  }
+  return (void*)(uintptr_t)nbFound;
+
+}
+
+// Benchmark of threads using a set with mixed operations
+static void BenchSharded(
+  void) {
+
+  printf("Mixed operations, %d per thread\n", SHARDED_NB_OP);
+  size_t const nbThreads[] = {1, 2, 4, 8, 16, 32};
+  FOR(iMode, 2) FOR(iNb, sizeof(nbThreads) / sizeof(nbThreads[0])) {
+
+    // Half of the range in the set at the start
+    size_t const nbThread = nbThreads[iNb];
+    if (iMode == 0) {
+
+      concSet = GSetLongAlloc();
+      GSetAttachIndex(concSet);
+      FOR(i, SHARDED_RANGE / 2) GSetAdd(concSet, (long)(2 * i));
+
+    } else {
+
+      shardedSet = GSetShardedLongAlloc(SHARDED_NB_SHARD);
+      FOR(i, SHARDED_RANGE / 2) GSetShardedAdd(shardedSet, (long)(2 * i));
+
+    }
+
+    pthread_t threads[SHARDED_MAX_THREAD];
+    double t = Now();
+    FOR(i, nbThread)
+      pthread_create(threads + i, NULL, MixSharded, (void*)(uintptr_t)i);
+    FOR(i, nbThread) pthread_join(threads[i], NULL);
+    double sec = Now() - t;
+    char label[64];
+    snprintf(label, sizeof(label), "%s, %zu thread(s)",
+      (iMode == 0 ? "mutex GSet" : "GSetSharded(64)"), nbThread);
+    PrintResult(label, nbThread * SHARDED_NB_OP, sec);
+    GSetFree(&concSet);
+    GSetShardedFree(&shardedSet);
+
+  }
+
+}
+
+// Number of data saved and loaded by the serialization benchmark
+#define IO_NB_DATA 2000000
+
+// Benchmark of saving a set in a file and loading it back, with text and
+// one GSetAdd per data, and in binary with GSetSave/GSetLoad
+static void BenchSaveLoad(
+  void) {
+
+  printf("Save and load of %d long\n", IO_NB_DATA);
+  GSetLong* set = GSetLongAlloc();
+  FOR(i, IO_NB_DATA) GSetAdd(set, (long)(i * 2654435761u));
+
+  // fprintf/fscanf
+  FILE* stream = tmpfile();
+  if (stream == NULL) return;
+  double t = Now();
+  GSetIterLong* iter = GSetIterLongAlloc(set);
+  do fprintf(stream, "%ld\n", GSetGet(iter)); while (GSetNext(iter));
+  GSetIterFree(&iter);
+  fflush(stream);
+  PrintResult("fprintf", IO_NB_DATA, Now() - t);
+  rewind(stream);
+  GSetLong* loaded = GSetLongAlloc();
+  t = Now();
+  long v = 0;
+  while (fscanf(stream, "%ld", &v) == 1) GSetAdd(loaded, v);
+  PrintResult("fscanf + GSetAdd", IO_NB_DATA, Now() - t);
+  GSetFree(&loaded);
+  fclose(stream);
+
+  // GSetSave/GSetLoad
+  stream = tmpfile();
+  if (stream == NULL) return;
+  t = Now();
+  GSetSave(set, stream);
+  fflush(stream);
+  PrintResult("GSetSave", IO_NB_DATA, Now() - t);
+  rewind(stream);
+  loaded = GSetLongAlloc();
+  t = Now();
+  (void)GSetLoad(loaded, stream);
+  PrintResult("GSetLoad", IO_NB_DATA, Now() - t);
+  GSetFree(&loaded);
+  fclose(stream);
+  GSetFree(&set);
+
+}
+
+// Benchmark of the access to the data of a saved set, loaded with GSetLoad
+// or mapped with GSetMapFile, and summed with an iterator
+static void BenchMapFile(
+  void) {
+
+  printf("Load or map, and sum, of %d long\n", IO_NB_DATA);
+  char const* path = "./benchMapFile.gset";
+  FILE* stream = fopen(path, "wb");
+  if (stream == NULL) return;
+  GSetLong* set = GSetLongAlloc();
+  FOR(i, IO_NB_DATA) GSetAdd(set, (long)(i * 2654435761u));
+  GSetSave(set, stream);
+  fclose(stream);
+  GSetFree(&set);
+
+  // GSetLoad
+  double t = Now();
+  stream = fopen(path, "rb");
+  if (stream == NULL) return;
+  set = GSetLongAlloc();
+  (void)GSetLoad(set, stream);
+  fclose(stream);
+  double tOpen = Now() - t;
+  GSetIterLong* iter = GSetIterLongAlloc(set);
+  long sum = 0;
+  GSetIterForEach(iter) sum += GSetGet(iter);
+  PrintResult("GSetLoad, open", IO_NB_DATA, tOpen);
+  PrintResult("GSetLoad, open + sum", IO_NB_DATA, Now() - t);
+  GSetIterFree(&iter);
+  GSetFree(&set);
+
+  // GSetMapFile
+  t = Now();
+  GSetMapLong* map = GSetMapFile(path, Long);
+  tOpen = Now() - t;
+  GSetMapIterLong* iterMap = GSetMapIterLongAlloc(map);
+  long sumMap = 0;
+  GSetIterForEach(iterMap) sumMap += GSetIterGet(iterMap);
+  PrintResult("GSetMapFile, open", IO_NB_DATA, tOpen);
+  PrintResult("GSetMapFile, open + sum", IO_NB_DATA, Now() - t);
+  if (sum != sumMap) printf("Sums differ\n");
+  GSetIterFree(&iterMap);
+  GSetMapFree(&map);
+  remove(path);
+
+}
+
+// Number of data parsed by the text parsing benchmark
+#define TEXT_NB_DATA 2000000
+
+// Benchmark of parsing a text stream of numbers into a set, with fscanf
+// and one GSetAdd per data, and with GSetParseText
+static void BenchParseText(
+  void) {
+
+  printf("Parse a text of %d long and %d double\n",
+    TEXT_NB_DATA, TEXT_NB_DATA);
+  FILE* streams[2] = {tmpfile(), tmpfile()};
+  if (streams[0] == NULL || streams[1] == NULL) return;
+  FOR(i, TEXT_NB_DATA) {
+
+    fprintf(streams[0], "%ld\n", (long)(i * 2654435761u) - 2000000000l);
+    fprintf(streams[1], "%.6f\n", (double)i * 0.37 - 1000.0);
+
+  }
+
+  FOR(iType, 2) {
+
+    double size = (double)ftell(streams[iType]) / 1e6;
+    char label[64];
+
+    // fscanf
+    rewind(streams[iType]);
+    double t = Now();
+    if (iType == 0) {
+
+      GSetLong* set = GSetLongAlloc();
+      long v = 0;
+      while (fscanf(streams[iType], "%ld", &v) == 1) GSetAdd(set, v);
+      GSetFree(&set);
+
+    } else {
+
+      GSetDouble* set = GSetDoubleAlloc();
+      double v = 0.0;
+      while (fscanf(streams[iType], "%lf", &v) == 1) GSetAdd(set, v);
+      GSetFree(&set);
+
+    }
+
+    double sec = Now() - t;
+    snprintf(label, sizeof(label), "fscanf + GSetAdd, %s, %.0fMB/s",
+      (iType == 0 ? "long" : "double"), size / sec);
+    PrintResult(label, TEXT_NB_DATA, sec);
+
+    // GSetParseText
+    rewind(streams[iType]);
+    t = Now();
+    if (iType == 0) {
+
+      GSetLong* set = GSetLongAlloc();
+      (void)GSetParseText(set, streams[iType], "\n", NULL);
+      GSetFree(&set);
+
+    } else {
+
+      GSetDouble* set = GSetDoubleAlloc();
+      (void)GSetParseText(set, streams[iType], "\n", NULL);
+      GSetFree(&set);
+
+    }
+
+    sec = Now() - t;
+    snprintf(label, sizeof(label), "GSetParseText, %s, %.0fMB/s",
+      (iType == 0 ? "long" : "double"), size / sec);
+    PrintResult(label, TEXT_NB_DATA, sec);
+
+  }
+
+  fclose(streams[0]);
+  fclose(streams[1]);
+
+}
+
+// Number of data in the compressed set benchmark
+#define PACK_NB_DATA 2000000
+
+// Benchmark of compressed sets of dense sorted ids (1% of the ids missing):
+// encoding, iteration compared to the one on the set, decoding, and
+// lookups
+static void BenchPacked(
+  void) {
+
+  printf("Compressed set of %d dense sorted long\n", PACK_NB_DATA);
+  GSetLong* set = GSetLongAlloc();
+  FOR(i, PACK_NB_DATA + PACK_NB_DATA / 100)
+    if (i % 101 != 50) GSetAdd(set, (long)i + 1000000);
+  double t = Now();
+  GSetPackedLong* packed = GSetPack(set);
+  PrintResult("GSetPack", PACK_NB_DATA, Now() - t);
+  printf("  %-44s %8.3f bytes/data\n", "GSetPacked memory",
+    (double)GSetPackedGetMemSize(packed) / (double)GSetGetSize(set));
+
+  // Sum with an iterator on the set and on the compressed set
+  GSetIterLong* iter = GSetIterLongAlloc(set);
+  long sum = 0;
+  t = Now();
+  GSetIterForEach(iter) sum += GSetIterGet(iter);
+  PrintResult("GSetIter sum", PACK_NB_DATA, Now() - t);
+  GSetIterFree(&iter);
+  GSetPackedIterLong* iterPacked = GSetPackedIterLongAlloc(packed);
+  long sumPacked = 0;
+  t = Now();
+  GSetIterForEach(iterPacked) sumPacked += GSetIterGet(iterPacked);
+  PrintResult("GSetPackedIter sum", PACK_NB_DATA, Now() - t);
+  if (sum != sumPacked) printf("Sums differ\n");
+  GSetIterFree(&iterPacked);
+
+  // Decode and lookups
+  GSetLong* decoded = GSetLongAlloc();
+  t = Now();
+  (void)GSetUnpack(decoded, packed);
+  PrintResult("GSetUnpack", PACK_NB_DATA, Now() - t);
+  GSetFree(&decoded);
+  size_t nbFound = 0;
+  t = Now();
+  FOR(i, PACK_NB_DATA)
+    nbFound += GSetPackedContains(packed, (long)(i * 7919 % PACK_NB_DATA));
+  PrintResult("GSetPackedContains", PACK_NB_DATA, Now() - t);
+  if (nbFound > PACK_NB_DATA) printf("Unexpected lookups\n");
+  GSetPackedFree(&packed);
+  GSetFree(&set);
+
+}
+
+int main() {
+
+  BenchTryCatch();
+  BenchPopArr();
+  BenchBounded();
+  BenchConc();
+  BenchSpsc();
+  BenchDeque();
+  BenchBlockingQueue();
+  BenchEpoch();
+  BenchSharded();
+  BenchSaveLoad();
+  BenchMapFile();
+  BenchParseText();
+  BenchPacked();
+
+  // Return the sucess code
+  return EXIT_SUCCESS;
+
+}
@@ -5,6 +5,16 @@
 #include <float.h>
 #include <math.h>
 #include <stdint.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <limits.h>
+#include <locale.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "gset.h"
 
 // ================== Macros =========================
@@ -22,6 +32,24 @@
 // Get a random number in [0.0, 1.0]
 #define rnd() (float)(rand())/(float)(RAND_MAX)
 
+// Number of data gathered from the set before being processed by the
+// reduction kernels
+#define GSET_BLOCK_SIZE 256
+
+// Number of independent accumulators in the reduction kernels, allowing the
+// compiler to vectorise them
+#define GSET_NB_LANE 8
+
+// Attribute compiling the reduction kernels for several instruction sets,
+// the one matching the CPU being selected at runtime
+#if defined(__GNUC__) && !defined(__clang__) && \
+    defined(__x86_64__) && defined(__linux__)
+  #define GSET_KERNEL \
+    __attribute__((target_clones("avx2", "sse4.2", "default")))
+#else
+  #define GSET_KERNEL
+#endif
+
 // ================== Private type definitions =========================
 
 // Union to memorise the data in a GSet element independently of its type
@@ -54,6 +82,240 @@ struct GSetElem {
 };
 typedef struct GSetElem GSetElem;
 
+// Type of the keys of a hash index
+enum GSetKeyType {
+
+  GSetKeyType_Char,
+  GSetKeyType_UChar,
+  GSetKeyType_Int,
+  GSetKeyType_UInt,
+  GSetKeyType_Long,
+  GSetKeyType_ULong,
+  GSetKeyType_Float,
+  GSetKeyType_Double,
+  GSetKeyType_Ptr,
+  GSetKeyType_User,
+
+};
+typedef enum GSetKeyType GSetKeyType;
+
+// Structure of a slot of a hash index
+struct GSetIndexSlot {
+
+  // Element in the slot, NULL if the slot is empty
+  GSetElem* elem;
+
+  // Hash of the element's data
+  size_t hash;
+
+};
+typedef struct GSetIndexSlot GSetIndexSlot;
+
+// Structure of a hash index (open addressing with linear probing and
+// backward shift deletion, the number of slots is a power of 2 and at least
+// twice the number of indexed elements)
+struct GSetIndex {
+
+  // Type of the keys
+  GSetKeyType type;
+
+  // User defined hash and equality functions (for GSetKeyType_User)
+  GSetHashFun hash;
+  GSetEqFun eq;
+
+  // Number of slots
+  size_t nbSlot;
+
+  // Number of used slots
+  size_t nbUsed;
+
+  // Slots
+  GSetIndexSlot* slots;
+
+};
+typedef struct GSetIndex GSetIndex;
+
+// Structure of a monotonic deque of a window aggregate, ring buffer of
+// elements whose data are monotonic from the head to the tail of the deque
+struct GSetWindowDeque {
+
+  // Elements (the number of slots is a power of 2)
+  GSetElem** elems;
+
+  // Number of slots
+  size_t nbSlot;
+
+  // Index of the slot of the head of the deque
+  size_t head;
+
+  // Number of elements in the deque
+  size_t nb;
+
+};
+typedef struct GSetWindowDeque GSetWindowDeque;
+
+// Structure of a window aggregate. It is made for sets used as sliding
+// windows (data added at the tail and removed from the head): the sum and
+// the deques are then updated in O(1) (amortized for the deques). The sum
+// is also updated in O(1) when single data are added or removed elsewhere.
+// Other modifications of the set invalidate the deques, and bulk ones the
+// sum too, which are then recomputed in O(n) at the next query. Infinite
+// and NaN data are counted apart so that the sum is finite again once they
+// have left the set. The aggregate is computed at its first query.
+struct GSetWindow {
+
+  // Type of the data
+  GSetKeyType type;
+
+  // Flag to memorise if the sum is up to date
+  bool isValid;
+
+  // Flag to memorise if the deques are up to date
+  bool isMinMaxValid;
+
+  // Sum of the data (integer data are summed into an unsigned long,
+  // wrapping around on overflow, floating point data into a double with
+  // compensated summation)
+  union {
+
+    unsigned long ul;
+    double d;
+
+  } sum;
+
+  // Compensation of the floating point sum
+  double comp;
+
+  // Numbers of +inf, -inf and NaN floating point data, which are kept out
+  // of the sum and its compensation
+  size_t nbPosInf;
+  size_t nbNegInf;
+  size_t nbNaN;
+
+  // Deques of the candidates to the minimum (increasing data) and maximum
+  // (decreasing data) of the set, the current minimum and maximum being
+  // at the head of the deques
+  GSetWindowDeque min;
+  GSetWindowDeque max;
+
+};
+typedef struct GSetWindow GSetWindow;
+
+// Size in bytes of a cache line
+#define GSET_CACHE_LINE 64
+
+// Maximum number of readers simultaneously in a read section of a set in
+// concurrent-read mode
+#define GSET_EPOCH_NB_READER 64
+
+// Number of elements retired between two attempts to free the retired
+// elements of a set in concurrent-read mode
+#define GSET_EPOCH_PERIOD 64
+
+// Structure of a reader slot of a set in concurrent-read mode
+struct GSetEpochReader {
+
+  // Epoch in which the reader entered its read section, 0 if the slot is
+  // not used
+  _Alignas(GSET_CACHE_LINE) _Atomic(uint64_t) epoch;
+
+};
+typedef struct GSetEpochReader GSetEpochReader;
+
+// Structure of the elements retired during an epoch
+struct GSetEpochBag {
+
+  // Elements, their number and the size of the array
+  GSetElem** elems;
+  size_t nb;
+  size_t size;
+
+};
+typedef struct GSetEpochBag GSetEpochBag;
+
+// Structure of the epoch-based reclamation of a set in concurrent-read
+// mode. Elements removed by the writer are retired in the bag of the
+// current epoch. The epoch advances once all the readers in a read section
+// have entered it, and the elements retired two epochs before are then
+// freed as no reader can access them anymore
+struct GSetEpoch {
+
+  // Current epoch, modified by the writer only
+  _Alignas(GSET_CACHE_LINE) _Atomic(uint64_t) global;
+
+  // Retired elements of the current and two previous epochs, and number of
+  // elements retired since the last attempt to advance the epoch
+  GSetEpochBag bags[3];
+  size_t nbRetire;
+
+  // Reader slots
+  GSetEpochReader readers[GSET_EPOCH_NB_READER];
+
+};
+typedef struct GSetEpoch GSetEpoch;
+
+// Operations on sorted sets
+enum GSetAlgebraOp {
+
+  GSetAlgebraOp_Union,
+  GSetAlgebraOp_Intersect,
+  GSetAlgebraOp_Difference,
+  GSetAlgebraOp_SymDiff,
+
+};
+typedef enum GSetAlgebraOp GSetAlgebraOp;
+
+// Maximum number of levels of a skip list
+#define GSET_SKIP_MAX_LEVEL 32
+
+// Structure of a node of a skip list
+struct GSetSkipNode {
+
+  // Element of the set
+  GSetElem* elem;
+
+  // Number of levels of the node
+  size_t nbLevel;
+
+  // Next node on each level
+  struct GSetSkipNode* next[];
+
+};
+typedef struct GSetSkipNode GSetSkipNode;
+
+// Structure of a skip list on the elements of a sorted set
+struct GSetSkipList {
+
+  // Comparison function the set is sorted with
+  int (*cmp)(void const*, void const*);
+
+  // Current number of levels
+  size_t nbLevel;
+
+  // State of the generator of random levels
+  uint64_t rnd;
+
+  // Head of the list, with GSET_SKIP_MAX_LEVEL levels
+  GSetSkipNode* head;
+
+};
+typedef struct GSetSkipList GSetSkipList;
+
+// Structure of a head of the k-way merge of sorted sets
+struct GSetMergeHead {
+
+  // Current element of the merged chain
+  GSetElem* elem;
+
+  // Last element of the merged chain
+  GSetElem* last;
+
+  // Rank of the merged chain, used to keep the merge stable
+  size_t rank;
+
+};
+typedef struct GSetMergeHead GSetMergeHead;
+
 // Structure of a GSet
 struct GSet {
 
@@ -66,6 +328,30 @@ struct GSet {
   // Last element of the set
   GSetElem* last;
 
+  // Hash index of the set (NULL if the set has no index)
+  GSetIndex* index;
+
+  // Skip list on the elements of the sorted set (NULL if not built)
+  GSetSkipList* skipList;
+
+  // Window aggregate of the set (NULL if the set has no window aggregate)
+  GSetWindow* window;
+
+  // Epoch-based reclamation of the set (NULL if the set is not in
+  // concurrent-read mode)
+  GSetEpoch* epoch;
+
+  // Maximum number of elements of a bounded set (0 if the set is unbounded)
+  size_t capacity;
+
+  // Policy of a bounded set when data are added while it is full
+  GSetBoundedPolicy policy;
+
+  // Elements of a bounded set not used by its data, chained by their next
+  // pointer, and their number
+  GSetElem* spare;
+  size_t nbSpare;
+
 };
 
 struct GSetIterFilter {
@@ -91,525 +377,2545 @@ struct GSetIter {
   // Filter on the iterator
   GSetIterFilter filter;
 
+  // Flag to memorise if the set was in concurrent-read mode when the
+  // iterator was reset, the links between elements are then read with
+  // acquire loads
+  bool isConcurrent;
+
 };
 
-// ================== Private functions declaration =========================
+// Structure of a range of elements processed by one thread in
+// GSetIterParallelForEach_
+struct GSetParallelRange {
 
-// Create a new GSetElem
-// Output:
-//   Return the new GSetElem.
-static GSetElem GSetElemCreate(
-  void);
+  // Iterator positioned on the first element of the range
+  GSetIter iter;
 
-// Allocate memory for a new GSetElem
-// Output:
-//   Return the new GSetElem.
-static GSetElem* GSetElemAlloc(
-  void);
+  // Number of elements in the range
+  size_t nb;
 
-// Free the memory used by a GSetElem, do not free the memory used by the data
-// it contains.
-// Input:
-//   that: the GSetElem to be freed
-static void GSetElemFree(
-  GSetElem** const that);
+  // Function applied on each element and its parameters
+  GSetParallelFun fun;
+  void* params;
 
-// Add an element before a given element
-// Inputs:
-//   that: the GSetElem before which the new element must be added
-//   elem: the GSetElem to be added
-//    set: the GSet containing 'that'
-static void GSetElemAddElemBefore(
-  GSetElem* const that,
-  GSetElem* const elem,
-      GSet* const set);
+  // Accumulator of the range
+  void* acc;
 
-// Create a new GSet
-// Output:
-//   Return the new GSet.
-static GSet GSetCreate(
-  void);
+  // Next range in the queue of the pool
+  struct GSetParallelRange* next;
 
-// Push an element at the head of the set
-// Inputs:
-//   that: the set
-//   elem: the element
-static void GSetPushElem(
-      GSet* const that,
-  GSetElem* const elem);
+  // Number of ranges of the call not processed yet, decremented once the
+  // range is processed
+  size_t* nbPending;
 
-// Add an element at the tail of the set
-// Inputs:
-//   that: the set
-//   elem: the element
-static void GSetAddElem(
-      GSet* const that,
-  GSetElem* const elem);
+};
+typedef struct GSetParallelRange GSetParallelRange;
 
-// Pop an element from the head of the set
-// Input:
-//   that: the set
-// Output:
-//   Return the element
-static GSetElem* GSetPopElem(
-  GSet* const that);
+// Maximum number of threads in the pool processing the ranges of
+// GSetIterParallelForEach_
+#define GSET_POOL_NB_WORKER 64
 
-// Drop an element from the tail of the set
-// Input:
-//   that: the set
-// Output:
-//   Return the element
-static GSetElem* GSetDropElem(
-  GSet* const that);
+// Structure of the pool of threads processing the ranges of
+// GSetIterParallelForEach_. The threads are created when first needed and
+// wait for ranges until the program exits, so that repeated calls don't
+// pay for the creation of threads. The calling threads queue their ranges
+// and process queued ranges too while waiting for theirs, so calls nested
+// in the function applied on elements don't deadlock
+struct GSetPool {
 
-// Create a new GSetIter
-// Input:
-//   type: the type of iteration
-// Output:
-//   Return the new GSetIter.
-GSetIter GSetIterCreate(
-  GSetIterType const type);
+  // Mutex protecting the pool
+  pthread_mutex_t mutex;
 
-// ================== Public functions definition =========================
+  // Conditions signaled when ranges are queued and when a range has been
+  // processed
+  pthread_cond_t queued;
+  pthread_cond_t done;
 
-// Function to get the commit id of the library
-// Output:
-//   Return a string containing the result of `git rev-parse HEAD` at
-//   compilation time
-char const* GSetGetCommitId(
-  void) {
+  // Queue of the ranges waiting to be processed
+  GSetParallelRange* head;
+  GSetParallelRange* tail;
 
-  // Return the commit id
-  #define STRINGIFY(x) #x
-  #define STRINGIFY_VALUE_OF(x) STRINGIFY(x)
-  return STRINGIFY_VALUE_OF(COMMIT);
+  // Threads of the pool and their number
+  pthread_t workers[GSET_POOL_NB_WORKER];
+  size_t nbWorker;
 
-}
+  // Flag memorising if the stop of the threads at exit is registered
+  bool hasAtExit;
 
-// Allocate memory for a new GSet
-// Output:
-//   Return the new GSet.
-GSet* GSetAlloc(
-  void) {
+  // Flag raised at exit to stop the threads
+  bool isStopping;
 
-  // Allocate memory for the GSet
-  GSet* that = NULL;
-  MALLOC(that, sizeof(GSet));
+};
+typedef struct GSetPool GSetPool;
 
-  // Create the GSet
-  *that = GSetCreate();
+// Pool of threads shared by all the calls of GSetIterParallelForEach_
+static GSetPool GSetPoolShared = {
 
-  // Return the GSet
-  return that;
+  .mutex = PTHREAD_MUTEX_INITIALIZER,
+  .queued = PTHREAD_COND_INITIALIZER,
+  .done = PTHREAD_COND_INITIALIZER,
+  .head = NULL,
+  .tail = NULL,
+  .nbWorker = 0,
+  .hasAtExit = false,
+  .isStopping = false,
 
-}
+};
 
-// Empty the GSet with GSetEmpty() and free the memory it used.
-// Input:
-//   that: the GSet to be freed
-void GSetFree_(
-  GSet** const that) {
+// Size in bytes of the slabs from which elements are allocated. Slabs are
+// aligned on their size so the slab of an element is found from its address
+#define GSET_SLAB_SIZE 65536
 
-  // If the memory is already freed, nothing to do
-  if (that == NULL || *that == NULL) return;
+// Structure of a slab of elements. Each thread allocates elements from the
+// slabs it owns, reusing the slots of freed elements before taking never
+// allocated ones. Slots freed by the owner thread go back in its private
+// list, those freed by other threads in a shared list the owner takes back
+// when it runs out of slots. A slab is freed once all its elements have
+// been freed, by its owner thread or, after this one has exited, by the
+// thread freeing its last element
+struct GSetSlab {
 
-  // Empty the GSet
-  GSetEmpty_(*that);
+  // Number of elements allocated and not freed yet, plus the number of
+  // free slots kept by the owner thread (never allocated or in 'local'),
+  // plus one while the owner thread has not exited
+  atomic_size_t nbRef;
 
-  // Free the memory
-  free(*that);
-  *that = NULL;
+  // Slots freed by other threads than the owner, linked by their 'next'
+  _Atomic(GSetElem*) remote;
 
-}
+  // Identifier of the owner thread
+  size_t owner;
 
-// Push data at the head of the set
-// Inputs:
-//   that: the set
-//   data: the data
-#define GSETPUSH__(N, T)                                                     \
-void GSetPush_ ## N(                                                         \
-  GSet* const that,                                                          \
-             T const data) {                                                 \
-  GSetElem* elem = GSetElemAlloc();                                          \
-  elem->data.N = data;                                                       \
-  GSetPushElem(that, elem);                                                  \
-}
+  // Index of the next slot never allocated
+  size_t next;
 
-GSETPUSH__(Char, char)
-GSETPUSH__(UChar, unsigned char)
-GSETPUSH__(Int, int)
-GSETPUSH__(UInt, unsigned int)
-GSETPUSH__(Long, long)
-GSETPUSH__(ULong, unsigned long)
-GSETPUSH__(Float, float)
-GSETPUSH__(Double, double)
-GSETPUSH__(Ptr, void*)
+  // Slots freed by the owner thread, linked by their 'next', and their
+  // number
+  GSetElem* local;
+  size_t nbLocal;
 
-// Push an array of data at the head of the set
-// Inputs:
-//   that: the set
-//   arr: the array of data
-#define GSETPUSHARR__(N, T)            \
-void GSetPushArr_ ## N(                \
-     GSet* const that,                 \
-    size_t const size,                 \
-  T const* const arr) {                \
-  FOR(i, size) {                       \
-    GSetElem* elem = GSetElemAlloc();  \
-    elem->data.N = arr[i];             \
-    GSetPushElem(that, elem);          \
-  }                                    \
-}
+  // Previous and next slabs of the owner thread
+  struct GSetSlab* prevOwned;
+  struct GSetSlab* nextOwned;
 
-#define GSETPUSHARRPTR__(N, T)         \
-void GSetPushArr_ ## N(                \
-     GSet* const that,                 \
-    size_t const size,                 \
-  T const* const arr) {                \
-  FOR(i, size) {                       \
-    GSetElem* elem = GSetElemAlloc();  \
-    elem->data.N = ((void**)arr)[i];   \
-    GSetAddElem(that, elem);           \
-  }                                    \
-}
+  // Elements
+  GSetElem elems[];
 
-GSETPUSHARR__(Char, char)
-GSETPUSHARR__(UChar, unsigned char)
-GSETPUSHARR__(Int, int)
-GSETPUSHARR__(UInt, unsigned int)
-GSETPUSHARR__(Long, long)
-GSETPUSHARR__(ULong, unsigned long)
-GSETPUSHARR__(Float, float)
-GSETPUSHARR__(Double, double)
-GSETPUSHARRPTR__(Ptr, void)
+};
+typedef struct GSetSlab GSetSlab;
 
-// Add data at the tail of the set
-// Inputs:
-//   that: the set
-//   data: the data
-#define GSETADD__(N, T)                                                      \
-void GSetAdd_ ## N(                                                          \
-  GSet* const that,                                                          \
-             T const data) {                                                 \
-  GSetElem* elem = GSetElemAlloc();                                          \
-  elem->data.N = data;                                                       \
-  GSetAddElem(that, elem);                                                   \
-}
+// Number of elements in a slab
+#define GSET_SLAB_NB_ELEM \
+  ((GSET_SLAB_SIZE - sizeof(GSetSlab)) / sizeof(GSetElem))
 
-GSETADD__(Char, char)
-GSETADD__(UChar, unsigned char)
-GSETADD__(Int, int)
-GSETADD__(UInt, unsigned int)
-GSETADD__(Long, long)
-GSETADD__(ULong, unsigned long)
-GSETADD__(Float, float)
-GSETADD__(Double, double)
-GSETADD__(Ptr, void*)
+// Maximum number of slabs visited when looking for free slots in the slabs
+// of a thread
+#define GSET_SLAB_NB_SCAN 8
 
-// Add an array of data at the tail of the set
-// Inputs:
-//   that: the set
-//   arr: the array of data
-#define GSETADDARR__(N, T)             \
-void GSetAddArr_ ## N(                 \
-  GSet* const that,                    \
-             size_t const size,        \
-             T const* const arr) {     \
-  FOR(i, size) {                       \
-    GSetElem* elem = GSetElemAlloc();  \
-    elem->data.N = arr[i];             \
-    GSetAddElem(that, elem);           \
-  }                                    \
-}
+// Identifier of the thread (0 until it allocates its first slab), its
+// slabs, the one it currently allocates from, and the one where the next
+// search for free slots starts
+static _Thread_local size_t GSetSlabThread = 0;
+static _Thread_local GSetSlab* GSetSlabOwned = NULL;
+static _Thread_local GSetSlab* GSetSlabCur = NULL;
+static _Thread_local GSetSlab* GSetSlabScan = NULL;
 
-#define GSETADDARRPTR__(N, T)          \
-void GSetAddArr_ ## N(                 \
-  GSet* const that,                    \
-             size_t const size,        \
-             T const* const arr) {     \
-  FOR(i, size) {                       \
-    GSetElem* elem = GSetElemAlloc();  \
-    elem->data.N = ((void**)arr)[i];   \
-    GSetAddElem(that, elem);           \
-  }                                    \
-}
+// Number of identifiers given to threads
+static atomic_size_t GSetSlabNbThread = 0;
 
-GSETADDARR__(Char, char)
-GSETADDARR__(UChar, unsigned char)
-GSETADDARR__(Int, int)
-GSETADDARR__(UInt, unsigned int)
-GSETADDARR__(Long, long)
-GSETADDARR__(ULong, unsigned long)
-GSETADDARR__(Float, float)
-GSETADDARR__(Double, double)
-GSETADDARRPTR__(Ptr, void)
+// Key used to release the slabs of a thread when it exits
+static pthread_key_t GSetSlabKey;
+static pthread_once_t GSetSlabKeyOnce = PTHREAD_ONCE_INIT;
+static bool GSetSlabHasKey = false;
 
-// Add data before the current position of an iterator
-// Inputs:
-//   that: the set iterator
-//   data: the data
-#define GSETITERADDBEFORE__(N, T)               \
-void GSetIterAddBefore_ ## N(                   \
-  GSetIter* const that,                         \
-          T const data,                         \
-      GSet* const set) {                        \
-  GSetElem* elem = GSetElemAlloc();             \
-  elem->data.N = data;                          \
-  GSetElemAddElemBefore(that->elem, elem, set); \
-}
-GSETITERADDBEFORE__(Char, char)
-GSETITERADDBEFORE__(UChar, unsigned char)
-GSETITERADDBEFORE__(Int, int)
-GSETITERADDBEFORE__(UInt, unsigned int)
-GSETITERADDBEFORE__(Long, long)
-GSETITERADDBEFORE__(ULong, unsigned long)
-GSETITERADDBEFORE__(Float, float)
-GSETITERADDBEFORE__(Double, double)
-GSETITERADDBEFORE__(Ptr, void*)
+// Structure of a node of a concurrent queue. Nodes are allocated from the
+// same slabs as the elements of sets
+struct GSetConcNode {
 
-// Pop data from the head of the set
-// Input:
-//   that: the set
-// Output:
-//   Remove the data at the head of the set and return it
-#define GSETPOP__(N, T)                                \
-T GSetPop_ ## N(                                       \
-  GSet* const that) {                                  \
-  if (that->size == 0) Raise(TryCatchExc_OutOfRange);  \
-  GSetElem* elem = GSetPopElem(that);                  \
-  T data = elem->data.N;                               \
-  GSetElemFree(&elem);                                 \
-  return data;                                         \
-}
+  // Next node in the queue, toward the tail
+  _Atomic(struct GSetConcNode*) next;
 
-GSETPOP__(Char, char)
-GSETPOP__(UChar, unsigned char)
-GSETPOP__(Int, int)
-GSETPOP__(UInt, unsigned int)
-GSETPOP__(Long, long)
-GSETPOP__(ULong, unsigned long)
-GSETPOP__(Float, float)
-GSETPOP__(Double, double)
-GSETPOP__(Ptr, void*)
+  // Data of the node
+  union GSetElemData data;
 
-// Drop data from the tail of the set
-// Input:
-//   that: the set
-// Output:
-//   Remove the data at the tail of the set and return it
-#define GSETDROP__(N, T)                               \
-T GSetDrop_ ## N(                                      \
-  GSet* const that) {                                  \
-  if (that->size == 0) Raise(TryCatchExc_OutOfRange);  \
-  GSetElem* elem = GSetDropElem(that);                 \
-  T data = elem->data.N;                               \
-  GSetElemFree(&elem);                                 \
-  return data;                                         \
-}
+};
+typedef struct GSetConcNode GSetConcNode;
+_Static_assert(
+  sizeof(GSetConcNode) <= sizeof(GSetElem),
+  "GSetConcNode must fit in a slab slot");
 
-GSETDROP__(Char, char)
-GSETDROP__(UChar, unsigned char)
-GSETDROP__(Int, int)
-GSETDROP__(UInt, unsigned int)
-GSETDROP__(Long, long)
-GSETDROP__(ULong, unsigned long)
-GSETDROP__(Float, float)
-GSETDROP__(Double, double)
-GSETDROP__(Ptr, void*)
+// Structure of a concurrent queue (Vyukov's intrusive multi-producers
+// single-consumer queue). The tail, written by the producers, and the head,
+// owned by the consumer, are kept on separate cache lines
+struct GSetConc {
 
-// Append data from a set to the end of another
-// Input:
-//   that: the set where data are added
-//   tho: the set containing data to add
-void GSetAppend_(
-        GSet* const that,
-  GSet const* const tho) {
+  // Last node of the queue, where producers add nodes
+  _Alignas(GSET_CACHE_LINE) _Atomic(GSetConcNode*) last;
 
-  // Appending a set to itself will create infinite loop
-  if (that == tho) Raise(TryCatchExc_InfiniteLoop);
+  // First node of the queue, where the consumer pops nodes
+  _Alignas(GSET_CACHE_LINE) GSetConcNode* first;
 
-  // If the set source is empty, nothing to do
-  if (tho->size == 0) return;
+  // Stub node, keeping the queue never empty of nodes
+  GSetConcNode stub;
 
-  // Iterator on the data to copy
-  GSetIter* iter = NULL;
+  // Slab of the popped nodes not released yet, the chain of these nodes
+  // linked as elements, and their number
+  GSetSlab* releaseSlab;
+  GSetElem* releaseFirst;
+  GSetElem* releaseLast;
+  size_t nbRelease;
 
-  Try {
+};
 
-    // Loop on the element of the set source
-    iter = GSetIterAlloc(GSetIterForward);
-    GSetIterReset_(
-      iter,
-      tho);
-    do {
+// Structure of a ring queue for one producer and one consumer. Each side
+// owns its index on its own cache line, and keeps a copy of the index of
+// the other side which it refreshes only when the ring looks full (for the
+// producer) or empty (for the consumer)
+struct GSetSpsc {
 
-      // Add the data from the source to the destination
-      GSetElem* elem = GSetElemAlloc();
-      elem->data = iter->elem->data;
-      GSetAddElem(
-        that,
-        elem);
+  // Index of the next slot to write, and the last known index of the
+  // consumer, used by the producer
+  _Alignas(GSET_CACHE_LINE) atomic_size_t tail;
+  size_t headCache;
 
-    } while (GSetIterNext_(iter));
+  // Index of the next slot to read, and the last known index of the
+  // producer, used by the consumer
+  _Alignas(GSET_CACHE_LINE) atomic_size_t head;
+  size_t tailCache;
 
-  } EndCatch;
+  // Number of slots minus one (the number of slots is a power of 2) and
+  // slots, read only once the queue is created
+  _Alignas(GSET_CACHE_LINE) size_t mask;
+  union GSetElemData* slots;
 
-  // Free memory
-  GSetIterFree_(&iter);
+};
 
-  // Forward the exception if any
-  ForwardExc();
+// Initial number of slots of a work-stealing deque
+#define GSET_DEQUE_NB_SLOT 64
 
-}
+// Structure of the array of slots of a work-stealing deque. When the
+// array is full it is replaced by a larger one, and kept until the deque
+// is freed as thieves may still be reading it
+struct GSetDequeArr {
 
-// Merge a set into another. The merged set is empty after this operation
-// Input:
-//   that: the extended set
-//   tho: the merged set
-void GSetMerge_(
-  GSet* const that,
-  GSet* const tho) {
+  // Number of slots minus one (the number of slots is a power of 2)
+  int64_t mask;
 
-  // Merging a set to itself will create infinite loop
-  if (that == tho) Raise(TryCatchExc_InfiniteLoop);
+  // Previous, smaller, array of the deque
+  struct GSetDequeArr* prev;
 
-  // If the merged set is empty, nothing to do
-  if (tho->size == 0) return;
+  // Slots
+  _Atomic(void*) slots[];
 
-  // If that is empty
-  if (that->size == 0) {
+};
+typedef struct GSetDequeArr GSetDequeArr;
 
-    // Simply copy tho in that
-    *that = *tho;
+// Structure of a work-stealing deque (Chase and Lev, with the memory
+// orderings of Le et al.). The owner works at the bottom of the array,
+// which is the head of the deque, and thieves at the top, which is its
+// tail. The indices only grow, a slot is at index modulo the array size
+struct GSetDeque {
 
-  // Else, that is not empty
-  } else {
+  // Index of the oldest data, incremented by thieves and by the owner
+  // when it takes the last data
+  _Alignas(GSET_CACHE_LINE) _Atomic(int64_t) top;
 
-    // Check for overflow
-    if (that->size > SIZE_MAX - tho->size) Raise(TryCatchExc_IntOverflow);
+  // Index of the slot after the newest data, modified by the owner only
+  _Alignas(GSET_CACHE_LINE) _Atomic(int64_t) bottom;
 
-    // Connect the tail of that to the head of tho
-    that->last->next = tho->first;
-    tho->first->prev = that->last;
+  // Current array of slots
+  _Atomic(GSetDequeArr*) arr;
 
-    // Update the last element of that
-    that->last = tho->last;
+};
 
-    // Update the size of that
-    that->size += tho->size;
+// Initial number of slots of a blocking queue without maximum capacity
+#define GSET_BLOCKINGQUEUE_NB_SLOT 64
 
-  }
+// Structure of a blocking queue. The data are stored in a ring of slots,
+// whose number is a power of 2, grown as needed if the queue has no
+// maximum capacity
+struct GSetBlockingQueue {
 
-  // Empty tho
-  tho->first = NULL;
-  tho->last = NULL;
-  tho->size = 0;
+  // Mutex protecting the queue
+  pthread_mutex_t mutex;
 
-}
+  // Conditions signaled when data are added and when data are popped or
+  // the queue is closed
+  pthread_cond_t notEmpty;
+  pthread_cond_t notFull;
 
-// Return the number of element in the set
-// Input:
-//   that: the set
-// Output:
-//   Return the number of element.
-size_t GSetGetSize_(
-  GSet const* const that) {
+  // Number of threads waiting for data and for room, the conditions are
+  // signaled only if there are waiting threads
+  size_t nbWaitPop;
+  size_t nbWaitAdd;
 
-  return that->size;
+  // Maximum number of data, 0 if there is no maximum
+  size_t capacity;
 
-}
+  // Number of slots minus one, index of the slot at the head and number
+  // of data
+  size_t mask;
+  size_t head;
+  size_t size;
 
-// Empty the set. Memory used by data in it is not freed.
-// To empty the set and free data, use GSet<N>Flush() instead.
-// Input:
-//   that: the set
-void GSetEmpty_(
-  GSet* const that) {
+  // Slots
+  union GSetElemData* slots;
 
-  // Loop until the set is empty
-  while (GSetGetSize_(that) > 0) {
+  // Flag memorising if the queue is closed
+  bool isClosed;
 
-    // Pop the element
-    GSetElem* elem = GSetPopElem(that);
+};
 
-    // Free the element, in memory of L3-37
-    GSetElemFree(&elem);
+// Structure of a shard of a sharded set, aligned on a cache line so that
+// threads using different shards don't share the line of their mutex
+struct GSetShard {
 
-  }
+  // Mutex protecting the set
+  _Alignas(GSET_CACHE_LINE) pthread_mutex_t mutex;
 
-}
+  // Set of the data of the shard
+  GSet* set;
 
-// Shuffle the set
-// Input:
-//   that: the set
-void GSetShuffle_(
-  GSet* const that) {
+};
+typedef struct GSetShard GSetShard;
 
-  // If the array has less than 2 elements, nothing to do
-  if (that->size < 2) return;
+// Structure of a sharded set
+struct GSetSharded {
 
-  // Convert the GSet into an array of pointers to data
-  union GSetElemData* arr = NULL;
-  MALLOC(arr, sizeof(union GSetElemData) * that->size);
-  GSetElem* ptr = that->first;
-  size_t i = 0;
-  while (ptr != NULL) {
+  // Number of shards minus one (the number of shards is a power of 2)
+  size_t mask;
 
-    arr[i] = ptr->data;
-    ptr = ptr->next;
-    ++i;
+  // Shards
+  GSetShard* shards;
 
-  }
+};
 
-  // Shuffle the array
-  // (Fischer-Yates-Durstenfeld-Knuth algorithm)
-  for (size_t i = that->size - 1; i > 0; --i) {
+// Version of the binary format of GSetSave_<N> (2 since the header has 4
+// reserved bytes), size in bytes of its header (a multiple of 8 so that the
+// data of a mapped file are aligned),
+// value written in the header to detect the byte order of the machine
+// which saved the data, and number of data written or read at once
+#define GSET_IO_VERSION 2
+#define GSET_IO_HEADER_SIZE 24
+#define GSET_IO_MARK 0x01020304UL
+#define GSET_IO_BLOCK 4096
+
+// Size in bytes of the buffer in which GSetParseText_<N> reads the text,
+// and of the buffer in which a real number is copied to be converted by
+// strtof or strtod when it can't be converted exactly by GSetParseReal
+#define GSET_TEXT_BUFFER 65536
+#define GSET_TEXT_TOKEN 64
+
+// Structure of a read-only view of a file saved with GSetSave_<N>
+struct GSetMap {
+
+  // Address and size in bytes of the mapping of the file
+  void* addr;
+  size_t sizeFile;
+
+  // Data, following the header in the mapped file, their number and size
+  // in bytes
+  unsigned char const* data;
+  size_t size;
+  size_t sizeData;
 
-     size_t j = (size_t)round(rnd() * (double)i);
-     if (i != j) {
+};
 
-       union GSetElemData ptr = arr[j];
-       arr[j] = arr[i];
-       arr[i] = ptr;
+// Structure of an iterator on a read-only view
+struct GSetMapIter {
 
-     }
+  // View the iterator is on, set when the iterator is reset
+  GSetMap const* map;
 
-  }
+  // Index of the current data, SIZE_MAX if the iterator is not on a data
+  size_t pos;
 
-  // Copy the shuffled data back in the elements
-  ptr = that->first;
-  i = 0;
-  while (ptr != NULL) {
+  // Type of iteration
+  GSetIterType type;
 
-    ptr->data = arr[i];
-    ptr = ptr->next;
-    ++i;
+  // Filter on the iterator
+  GSetIterFilter filter;
 
-  }
+};
 
-  // Free memory used by the temporary array
-  free(arr);
+// Structure of the state of the parsing of a text by GSetParseText_<N>
+struct GSetTextParser {
 
-}
+  // Flags of the characters delimiting the numbers
+  bool isDelim[UCHAR_MAX + 1];
 
-// Sort the elements of a GSet
-// Inputs:
-//   that: the set to sort
-//   cmp: the comparison function used to sort
-// It uses qsort, see man page for details. Elements are sorted in ascending
-// order, relative to the comparison function cmp(a,b) which much returns
-// a negative value if a<b, a positive value if a>b, and 0 if a=b
-#define GSETSORT__(N, T)                                 \
-void GSetSort_ ## N(                                     \
-  GSet* const that,                                      \
-          int (* const cmp)(void const*, void const*),   \
-         bool const inc) {                               \
-  if (that->size < 2) return;                            \
-  T* arr = NULL;                                         \
-  MALLOC(arr, sizeof(T) * that->size);                   \
-  GSetElem* ptr = that->first;                           \
-  size_t i = 0;                                          \
-  while (ptr != NULL) {                                  \
+  // Offset in the text of the beginning of the chunk being parsed, or of
+  // the invalid number once one has been found
+  size_t offset;
+
+  // Number of the current line and offset of its beginning
+  size_t line;
+  size_t lineStart;
+
+  // Number of data added to the set
+  size_t nb;
+
+  // Flag raised when an invalid number has been found
+  bool isInvalid;
+
+};
+typedef struct GSetTextParser GSetTextParser;
+
+// Number of data in the blocks of a compressed set
+#define GSET_PACK_BLOCK 128
+
+// Structure of a block of a compressed set
+struct GSetPackedBlock {
+
+  // First data of the block
+  unsigned long first;
+
+  // Index in the words of the compressed set of the first word of the
+  // differences between consecutive data of the block
+  size_t offset;
+
+  // Number of bits of each difference
+  unsigned char width;
+
+};
+typedef struct GSetPackedBlock GSetPackedBlock;
+
+// Structure of a compressed set of integers
+struct GSetPacked {
+
+  // Type of the data
+  GSetKeyType type;
+
+  // Number of data
+  size_t size;
+
+  // Flag raised if the data are sorted in increasing order
+  bool isSorted;
+
+  // Blocks and their number
+  GSetPackedBlock* blocks;
+  size_t nbBlock;
+
+  // Bit-packed differences between consecutive data of the blocks, number
+  // of words used and allocated
+  uint64_t* words;
+  size_t nbWord;
+  size_t nbWordAlloc;
+
+};
+
+// Structure of an iterator on a compressed set
+struct GSetPackedIter {
+
+  // Compressed set the iterator is on, set when the iterator is reset
+  GSetPacked const* packed;
+
+  // Index of the current data, SIZE_MAX if the iterator is not on a data
+  size_t pos;
+
+  // Index of the decoded block, SIZE_MAX if none, and its data
+  size_t iBlock;
+  unsigned long block[GSET_PACK_BLOCK];
+
+  // Type of iteration
+  GSetIterType type;
+
+  // Filter on the iterator
+  GSetIterFilter filter;
+
+};
+
+// ================== Private functions declaration =========================
+
+// Create a new GSetElem
+// Output:
+//   Return the new GSetElem.
+static GSetElem GSetElemCreate(
+  void);
+
+// Allocate memory for a new GSetElem
+// Output:
+//   Return the new GSetElem.
+static GSetElem* GSetElemAlloc(
+  void);
+
+// Free the memory used by a GSetElem, do not free the memory used by the data
+// it contains.
+// Input:
+//   that: the GSetElem to be freed
+static void GSetElemFree(
+  GSetElem** const that);
+
+// Allocate memory for a chain of new GSetElem, linked together, and copy
+// in them the data of a chain of existing elements. The elements are taken
+// from the slabs by runs and the data copied in a straight loop, without
+// exception frame
+// Inputs:
+//    src: the first element of the existing chain
+//     nb: the number of elements, greater than 0 and not greater than the
+//         number of elements in the existing chain
+//   last: receives the last element of the new chain
+// Output:
+//   Return the first element of the new chain
+static GSetElem* GSetElemAllocCopy(
+  GSetElem const* src,
+     size_t const nb,
+  GSetElem** const last);
+
+// Allocate memory for a chain of new GSetElem, linked together, whose data
+// are left to be set by the caller
+// Inputs:
+//     nb: the number of elements, greater than 0
+//   last: receives the last element of the chain
+// Output:
+//   Return the first element of the chain
+static GSetElem* GSetElemAllocChain(
+      size_t const nb,
+  GSetElem** const last);
+
+// Free the memory used by a chain of GSetElem, do not free the memory used
+// by the data they contain
+// Input:
+//   that: the first element of the chain, the chain ends with a NULL next
+static void GSetElemFreeChain(
+  GSetElem* that);
+
+// Get an element for a new data in a set, taken from the spare elements of
+// a bounded set or newly allocated. Raise TryCatchExc_OutOfRange if the set
+// is bounded and full.
+// Input:
+//   that: the set
+// Output:
+//   Return the element
+static GSetElem* GSetElemTake(
+  GSet* const that);
+
+// Get an element for a new data added at the head or tail of a set. If the
+// set is bounded, full and its policy is GSetBounded_Overwrite, the element
+// at the other end of the set is removed and returned (or retired, and the
+// element taken as with GSetElemTake, in concurrent-read mode), else the
+// element is taken as with GSetElemTake.
+// Inputs:
+//     that: the set
+//   atHead: true if the data is added at the head, false if at the tail
+// Output:
+//   Return the element
+static GSetElem* GSetElemTakeAtEnd(
+       GSet* const that,
+  bool const atHead);
+
+// Release an element removed from a set. It is kept as a spare element if
+// the set is bounded and misses spare elements, else it is freed.
+// Inputs:
+//   that: the set
+//   elem: the element
+static void GSetElemRelease(
+       GSet* const that,
+  GSetElem** const elem);
+
+// Release a chain of elements removed from a set, as with GSetElemRelease
+// Inputs:
+//    that: the set
+//   first: the first element of the chain
+//    last: the last element of the chain, its next pointer is NULL
+//      nb: the number of elements in the chain
+static void GSetElemReleaseChain(
+       GSet* const that,
+   GSetElem* const first,
+   GSetElem* const last,
+  size_t const nb);
+
+// Allocate a new slab for the thread and make it its current slab
+// Output:
+//   Return the new slab, or NULL if the allocation failed
+static GSetSlab* GSetSlabNew(
+  void);
+
+// Give the thread a current slab with a free slot: the current one after
+// taking back the slots freed by other threads, another slab of the thread
+// with enough free slots, or a new slab
+// Output:
+//   Return the slab, or NULL if the allocation failed
+static GSetSlab* GSetSlabRefill(
+  void);
+
+// Take back the slots of a slab of the thread freed by other threads
+// Input:
+//   that: the slab
+// Output:
+//   Return true if slots have been taken back
+static bool GSetSlabCollect(
+  GSetSlab* const that);
+
+// Get the number of elements allocated and not freed yet in a slab of the
+// thread. It may be temporarily overestimated while other threads are
+// freeing elements of the slab.
+// Input:
+//   that: the slab
+// Output:
+//   Return the number of elements
+static size_t GSetSlabNbLive(
+  GSetSlab const* const that);
+
+// Remove a slab with no allocated element from the slabs of the thread and
+// free it
+// Input:
+//   that: the slab
+static void GSetSlabDrop(
+  GSetSlab* const that);
+
+// Give back to their slab the slots of freed elements
+// Inputs:
+//   that: the slab
+//  first: the first slot, the slots are linked by their 'next'
+//   last: the last slot
+//     nb: the number of slots
+static void GSetSlabFree(
+   GSetSlab* const that,
+   GSetElem* const first,
+   GSetElem* const last,
+  size_t const nb);
+
+// Release references on a slab, and free it if it has no more references
+// Inputs:
+//   that: the slab
+//     nb: the number of references
+static void GSetSlabRelease(
+  GSetSlab* const that,
+     size_t const nb);
+
+// Release the slabs of a thread when it exits
+// Input:
+//   unused: unused, for compatibility with the destructors of pthread keys
+static void GSetSlabThreadExit(
+  void* unused);
+
+// Release the slabs of the thread calling exit()
+static void GSetSlabAtExit(
+  void);
+
+// Create the key used to release the slabs of a thread when it exits
+static void GSetSlabKeyCreate(
+  void);
+
+// Take a free slot in the current slab of the thread, refilled if it has
+// none, reusing the slots of freed elements first
+// Output:
+//   Return the slot, of the size of a GSetElem.
+static void* GSetSlabAllocSlot(
+  void);
+
+// Take consecutive free slots in the current slab of the thread, refilled
+// if it has none. Slots never allocated are taken first, slots of freed
+// elements are taken one by one
+// Inputs:
+//      nb: the number of slots wanted, greater than 0
+//   nbRun: receives the number of slots taken, not greater than 'nb'
+// Output:
+//   Return the first slot, or NULL if the allocation failed.
+static GSetElem* GSetSlabAllocRun(
+  size_t const nb,
+  size_t* const nbRun);
+
+// Allocate memory for a new node of a concurrent queue
+// Output:
+//   Return the new node.
+static GSetConcNode* GSetConcNodeAlloc(
+  void);
+
+// Link a node at the tail of a concurrent queue
+// Inputs:
+//   that: the queue
+//   node: the node
+static void GSetConcLink(
+      GSetConc* const that,
+  GSetConcNode* const node);
+
+// Unlink the node at the head of a concurrent queue
+// Input:
+//   that: the queue
+// Output:
+//   Return the node, or NULL if no node is available.
+static GSetConcNode* GSetConcUnlink(
+  GSetConc* const that);
+
+// Release a node popped from a concurrent queue. Releases are grouped per
+// slab to reduce the number of atomic operations on the slabs' counters
+// Inputs:
+//   that: the queue
+//   node: the node
+static void GSetConcRelease(
+      GSetConc* const that,
+  GSetConcNode* const node);
+
+// Get the number of data the producer of a ring queue can add
+// Inputs:
+//   that: the queue
+//     nb: the number of data the producer wants to add
+// Output:
+//   Return the number of data which can be added, not greater than 'nb'.
+static size_t GSetSpscReserve(
+  GSetSpsc* const that,
+     size_t const nb);
+
+// Get the number of data the consumer of a ring queue can pop
+// Inputs:
+//   that: the queue
+//     nb: the number of data the consumer wants to pop
+// Output:
+//   Return the number of data which can be popped, not greater than 'nb'.
+static size_t GSetSpscAvailable(
+  GSetSpsc* const that,
+     size_t const nb);
+
+// Allocate memory for a new array of slots of a work-stealing deque
+// Inputs:
+//   nbSlot: the number of slots, a power of 2
+//     prev: the array replaced by the new one (may be NULL)
+// Output:
+//   Return the new array, or NULL if the allocation failed.
+static GSetDequeArr* GSetDequeArrAlloc(
+  int64_t const nbSlot,
+  GSetDequeArr* const prev);
+
+// Wait, with the mutex of a blocking queue locked, until there is room in
+// the queue, and make sure the slots can receive the new data
+// Inputs:
+//   that: the queue
+//     nb: the number of data to be added
+// Output:
+//   Return the number of data which can be added, not greater than 'nb', 0
+//   if the queue is closed.
+static size_t GSetBlockingQueueWaitRoom(
+  GSetBlockingQueue* const that,
+             size_t const nb);
+
+// Wait, with the mutex of a blocking queue locked, until there are data
+// in the queue or it is closed
+// Inputs:
+//       that: the queue
+//         nb: the number of data to be popped
+//   deadline: the time until which to wait, NULL to wait without limit
+// Output:
+//   Return the number of data which can be popped, not greater than 'nb',
+//   0 if the queue is closed and empty or the deadline has passed.
+static size_t GSetBlockingQueueWaitData(
+      GSetBlockingQueue* const that,
+                  size_t const nb,
+  struct timespec const* const deadline);
+
+// Remove, with the mutex of a blocking queue locked, data at the head of
+// the queue and wake up the threads waiting for room
+// Inputs:
+//   that: the queue
+//     nb: the number of data to be removed
+static void GSetBlockingQueueTake(
+  GSetBlockingQueue* const that,
+             size_t const nb);
+
+// Wake up the threads waiting on a condition of a blocking queue
+// Inputs:
+//     cond: the condition
+//   nbWait: the number of waiting threads
+//       nb: the number of data added or removed
+static void GSetBlockingQueueWake(
+  pthread_cond_t* const cond,
+     size_t const nbWait,
+     size_t const nb);
+
+// Get the time after a given delay
+// Input:
+//   timeout: the delay, in seconds
+// Output:
+//   Return the time after the delay.
+static struct timespec GSetBlockingQueueDeadline(
+  double const timeout);
+
+// Get the shard of a data in a sharded set and lock its mutex. The shard
+// is selected by the high bits of the hash of the data, the hash index of
+// the shard's set using the low bits.
+// Inputs:
+//   that: the set
+//   type: the type of the data
+//   data: the data
+// Output:
+//   Return the locked shard.
+static GSetShard* GSetShardedLock(
+         GSetSharded* const that,
+          GSetKeyType const type,
+  union GSetElemData const* const data);
+
+// Link a chain of new elements at the tail of a set
+// Inputs:
+//    that: the set
+//   first: the first element of the chain
+//    last: the last element of the chain, its next pointer is NULL
+//      nb: the number of elements in the chain
+static void GSetAppendChain(
+       GSet* const that,
+   GSetElem* const first,
+   GSetElem* const last,
+      size_t const nb);
+
+// Reverse the order of the bytes of each data of an array
+// Inputs:
+//        arr: the array
+//   sizeData: the size in bytes of one data
+//         nb: the number of data
+static void GSetSwapBytes(
+    void* const arr,
+  size_t const sizeData,
+  size_t const nb);
+
+// Write the header of the binary format of GSetSave_<N> in a stream
+// Inputs:
+//     stream: the stream
+//       type: the type of the data
+//   sizeData: the size in bytes of one data, 0 if it varies
+//         nb: the number of data
+static void GSetSaveHeader(
+        FILE* const stream,
+  GSetKeyType const type,
+       size_t const sizeData,
+       size_t const nb);
+
+// Read the header of the binary format of GSetSave_<N> from a stream and
+// check it matches the expected data. Raise TryCatchExc_IOError if it
+// doesn't.
+// Inputs:
+//      stream: the stream
+//        type: the type of the data
+//    sizeData: the size in bytes of one data, 0 if it varies
+//   isSwapped: receives true if the data were saved on a machine of the
+//              other byte order
+// Output:
+//   Return the number of data.
+static size_t GSetLoadHeader(
+        FILE* const stream,
+  GSetKeyType const type,
+       size_t const sizeData,
+        bool* const isSwapped);
+
+// Parse the header of the binary format of GSetSave_<N> and check it
+// matches the expected data
+// Inputs:
+//      header: the header
+//        type: the type of the data
+//    sizeData: the size in bytes of one data, 0 if it varies
+//   isSwapped: receives true if the data were saved on a machine of the
+//              other byte order
+//          nb: receives the number of data
+// Output:
+//   Return true if the header is valid and matches the expected data, else
+//   false.
+static bool GSetParseHeader(
+  unsigned char const* const header,
+            GSetKeyType const type,
+                 size_t const sizeData,
+                  bool* const isSwapped,
+                size_t* const nb);
+
+// Map in memory a file saved with GSetSave_<N> and get a read-only view on
+// its data
+// Inputs:
+//       path: the path to the file
+//       type: the type of the data
+//   sizeData: the size in bytes of one data
+// Output:
+//   Return the new GSetMap.
+static GSetMap* GSetMapOpen(
+  char const* const path,
+  GSetKeyType const type,
+       size_t const sizeData);
+
+// Move an iterator on a read-only view, by steps in a given direction, to
+// the next data matching its filter
+// Inputs:
+//   that: the iterator
+//   step: 1 to move toward the end of the view, SIZE_MAX (i.e. -1) to move
+//         toward its beginning
+// Output:
+//   Return true if the iterator could move, else false (it stays on its
+//   current data).
+static bool GSetMapIterMove(
+  GSetMapIter* const that,
+        size_t const step);
+
+// Initialise the state of the parsing of a text
+// Inputs:
+//     that: the state
+//   delims: the characters delimiting the numbers, if NULL spaces, tabs,
+//           line ends, commas and semicolons
+static void GSetTextParserInit(
+  GSetTextParser* const that,
+      char const* const delims);
+
+// Get the current position of the parsing of a text
+// Inputs:
+//   that: the state of the parsing
+//    pos: receives the position, may be NULL
+static void GSetTextParserGetPos(
+  GSetTextParser const* const that,
+          GSetTextPos* const pos);
+
+// Parse a decimal integer with an optional sign at the beginning of a
+// text, in one pass up to the first delimiter
+// Inputs:
+//      text: the text
+//       len: the number of characters in the text
+//   isDelim: the flags of the delimiter characters
+//       end: receives the index of the first delimiter after the integer
+//            (len if there is none), or of the first invalid character
+//     isNeg: receives true if the integer has a minus sign
+//       mag: receives the magnitude of the integer
+// Output:
+//   Return true if the characters before 'end' are a valid integer whose
+//   magnitude fits an unsigned long long, else false.
+static bool GSetParseInteger(
+          char const* const text,
+               size_t const len,
+          bool const* const isDelim,
+              size_t* const end,
+                 bool* const isNeg,
+  unsigned long long* const mag);
+
+// Parse a real number in the format of the C locale: an optional sign and
+// a decimal mantissa with an optional fractional part and exponent, or
+// "inf", "infinity", "nan" (case insensitive)
+// Inputs:
+//       tok: the characters of the number
+//       len: the number of characters
+//   isFloat: true to round the number to float, false to round it to
+//            double
+//       val: receives the number
+// Output:
+//   Return true if the characters are a valid number in the range of
+//   float or double, else false.
+static bool GSetParseReal(
+  char const* const tok,
+       size_t const len,
+         bool const isFloat,
+      double* const val);
+
+// Convert a real number, already checked by GSetParseReal, with strtof or
+// strtod after replacing its decimal point with the one of the current
+// locale
+// Inputs:
+//       tok: the characters of the number
+//       len: the number of characters
+//   isFloat: true to convert with strtof, false to convert with strtod
+//       val: receives the number
+// Output:
+//   Return true if the number is in the range of float or double, else
+//   false.
+static bool GSetParseRealSlow(
+  char const* const tok,
+       size_t const len,
+         bool const isFloat,
+      double* const val);
+
+// Check if characters are a given lower case word, ignoring their case
+// Inputs:
+//    tok: the characters
+//    len: the number of characters
+//   word: the word
+// Output:
+//   Return true if the characters are the word, else false.
+static bool GSetTextIsWord(
+  char const* const tok,
+       size_t const len,
+  char const* const word);
+
+// Create a new empty compressed set
+// Inputs:
+//   type: the type of the data
+//   size: the number of data which will be encoded
+// Output:
+//   Return the new GSetPacked, with its blocks allocated.
+static GSetPacked* GSetPackedCreate(
+  GSetKeyType const type,
+       size_t const size);
+
+// Encode a block of data at the end of a compressed set
+// Inputs:
+//   that: the compressed set
+//   data: the data, as unsigned long
+//     nb: the number of data, in [1, GSET_PACK_BLOCK]
+static void GSetPackedAddBlock(
+          GSetPacked* const that,
+  unsigned long const* const data,
+                size_t const nb);
+
+// Decode a block of a compressed set
+// Inputs:
+//     that: the compressed set
+//   iBlock: the index of the block
+//     data: receives the data of the block, as unsigned long
+// Output:
+//   Return the number of data in the block.
+static size_t GSetPackedDecodeBlock(
+  GSetPacked const* const that,
+             size_t const iBlock,
+     unsigned long* const data);
+
+// Move an iterator on a compressed set, by steps in a given direction, to
+// the next data matching its filter, decoding the blocks it enters
+// Inputs:
+//   that: the iterator
+//   step: 1 to move toward the end of the set, SIZE_MAX (i.e. -1) to move
+//         toward its beginning
+// Output:
+//   Return true if the iterator could move, else false (it stays on its
+//   current data).
+static bool GSetPackedIterMove(
+  GSetPackedIter* const that,
+           size_t const step);
+
+// Check if a block of a compressed set sorted in increasing order contains
+// the data at a given distance from the first data of the block. The
+// differences are summed until the distance is reached or passed.
+// Inputs:
+//     that: the compressed set
+//   iBlock: the index of the block
+//     dist: the distance, as unsigned long, from the first data of the
+//           block to the data
+// Output:
+//   Return true if the block contains the data, else false.
+static bool GSetPackedBlockContains(
+  GSetPacked const* const that,
+             size_t const iBlock,
+      unsigned long const dist);
+
+// Add an element before a given element
+// Inputs:
+//   that: the GSetElem before which the new element must be added
+//   elem: the GSetElem to be added
+//    set: the GSet containing 'that'
+static void GSetElemAddElemBefore(
+  GSetElem* const that,
+  GSetElem* const elem,
+      GSet* const set);
+
+// Create a new GSet
+// Output:
+//   Return the new GSet.
+static GSet GSetCreate(
+  void);
+
+// Set a link which may be followed by the readers of a set in
+// concurrent-read mode (the next or previous element of an element, the
+// first or last element of the set). In that mode the link is stored with
+// release semantics, so the readers following it see the linked element
+// initialised
+// Inputs:
+//    set: the set
+//   link: the link
+//   elem: the linked element (may be NULL)
+static inline void GSetEpochLink(
+  GSet const* const set,
+   GSetElem** const link,
+   GSetElem* const elem);
+
+// Get a link followed by an iterator, with an acquire load if the set was
+// in concurrent-read mode when the iterator was reset
+// Inputs:
+//   that: the iterator
+//   link: the link
+// Output:
+//   Return the linked element (may be NULL)
+static inline GSetElem* GSetIterLink(
+         GSetIter const* const that,
+  GSetElem* const* const link);
+
+// Retire an element removed from a set in concurrent-read mode, and free
+// the retired elements which can't be accessed by the readers anymore
+// Inputs:
+//   that: the set
+//   elem: the element
+static void GSetEpochRetire(
+       GSet* const that,
+  GSetElem* const elem);
+
+// Advance the epoch of a set in concurrent-read mode if all the readers in
+// a read section have entered the current epoch, and free the elements
+// retired two epochs before
+// Input:
+//   that: the epoch-based reclamation of the set
+// Output:
+//   Return true if the epoch has advanced, false else.
+static bool GSetEpochAdvance(
+  GSetEpoch* const that);
+
+// Free the elements retired in a bag
+// Input:
+//   that: the bag
+static void GSetEpochBagEmpty(
+  GSetEpochBag* const that);
+
+// Free the epoch-based reclamation of a set and its retired elements
+// Input:
+//   that: the epoch-based reclamation
+static void GSetEpochFree(
+  GSetEpoch** const that);
+
+// Push an element at the head of the set
+// Inputs:
+//   that: the set
+//   elem: the element
+static void GSetPushElem(
+      GSet* const that,
+  GSetElem* const elem);
+
+// Add an element at the tail of the set
+// Inputs:
+//   that: the set
+//   elem: the element
+static void GSetAddElem(
+      GSet* const that,
+  GSetElem* const elem);
+
+// Pop an element from the head of the set
+// Input:
+//   that: the set
+// Output:
+//   Return the element
+static GSetElem* GSetPopElem(
+  GSet* const that);
+
+// Drop an element from the tail of the set
+// Input:
+//   that: the set
+// Output:
+//   Return the element
+static GSetElem* GSetDropElem(
+  GSet* const that);
+
+// Remove an element from the set, the element is not freed
+// Inputs:
+//   that: the set
+//   elem: the element
+static void GSetRemoveElem(
+      GSet* const that,
+  GSetElem* const elem);
+
+// Update what depends on the elements of a set (its hash index) after an
+// element has been linked into it
+// Inputs:
+//   that: the set
+//   elem: the linked element
+static void GSetNotifyAdd(
+      GSet* const that,
+  GSetElem* const elem);
+
+// Update what depends on the elements of a set (its hash index) before an
+// element is unlinked from it
+// Inputs:
+//   that: the set
+//   elem: the element about to be unlinked
+static void GSetNotifyRemove(
+      GSet* const that,
+  GSetElem* const elem);
+
+// Update what depends on the elements of a set (its hash index) after the
+// data of its elements have been modified or moved between elements
+// Input:
+//   that: the set
+static void GSetNotifyUpdate(
+  GSet* const that);
+
+// Attach a new hash index to a set and index its elements
+// Inputs:
+//   that: the set
+//   type: the type of keys
+//   hash: the user defined hash function (for GSetKeyType_User)
+//     eq: the user defined equality function (for GSetKeyType_User)
+static void GSetIndexAttach(
+         GSet* const that,
+  GSetKeyType const type,
+         GSetHashFun hash,
+           GSetEqFun eq);
+
+// Free the memory used by a hash index
+// Input:
+//   that: the index
+static void GSetIndexFree(
+  GSetIndex** const that);
+
+// Attach a new window aggregate to a set
+// Inputs:
+//   that: the set
+//   type: the type of data
+static void GSetWindowAttach(
+         GSet* const that,
+  GSetKeyType const type);
+
+// Free the memory used by a window aggregate
+// Input:
+//   that: the window aggregate
+static void GSetWindowFree(
+  GSetWindow** const that);
+
+// Invalidate a window aggregate, which will be recomputed at the next query
+// Input:
+//   that: the window aggregate (may be NULL)
+static void GSetWindowInvalidate(
+  GSetWindow* const that);
+
+// Update a window aggregate after an element has been linked into its set
+// Inputs:
+//   that: the set
+//   elem: the linked element
+static void GSetWindowAdd(
+      GSet* const that,
+  GSetElem* const elem);
+
+// Update a window aggregate before an element is unlinked from its set
+// Inputs:
+//   that: the set
+//   elem: the element about to be unlinked
+static void GSetWindowRemove(
+      GSet* const that,
+  GSetElem* const elem);
+
+// Recompute what is not up to date in the window aggregate of a set
+// Input:
+//   that: the set
+static void GSetWindowUpdate(
+  GSet const* const that);
+
+// Compare the data of two elements of a set with a window aggregate
+// Inputs:
+//   type: the type of data
+//      a: the first element
+//      b: the second element
+// Output:
+//   Return a negative value if a's data is less than b's data, a positive
+//   value if greater, 0 else
+static int GSetWindowCmp(
+  GSetKeyType const type,
+   GSetElem const* a,
+   GSetElem const* b);
+
+// Add or subtract the data of an element to the sum of a window aggregate
+// Inputs:
+//    that: the window aggregate
+//    elem: the element
+//   isAdd: true to add the data, false to subtract it
+static void GSetWindowSumElem(
+       GSetWindow* const that,
+   GSetElem const* const elem,
+        bool const isAdd);
+
+// Get the floating point sum of a window aggregate
+// Input:
+//   that: the window aggregate
+// Output:
+//   Return the sum
+static double GSetWindowSumFloat(
+  GSetWindow const* const that);
+
+// Add an element at the tail of a monotonic deque, after removing from its
+// tail the elements which can't be the minimum (or maximum) anymore
+// Inputs:
+//    that: the deque
+//    elem: the element
+//    type: the type of data
+//   order: 1 for the deque of the minimum, -1 for the one of the maximum
+// Output:
+//   Return false if the deque couldn't be extended, true else
+static bool GSetWindowDequePush(
+  GSetWindowDeque* const that,
+         GSetElem* const elem,
+       GSetKeyType const type,
+               int const order);
+
+// Get the hash of a data for a hash index
+// Inputs:
+//   that: the index
+//   data: the data
+// Output:
+//   Return the hash
+static size_t GSetIndexHash(
+        GSetIndex const* const that,
+  union GSetElemData const* const data);
+
+// Check the equality of two data for a hash index
+// Inputs:
+//   that: the index
+//      a: the first data
+//      b: the second data
+// Output:
+//   Return true if the data are equal, false else
+static bool GSetIndexEq(
+        GSetIndex const* const that,
+  union GSetElemData const* const a,
+  union GSetElemData const* const b);
+
+// Add an element to a hash index
+// Inputs:
+//   that: the index
+//   elem: the element
+static void GSetIndexAdd(
+  GSetIndex* const that,
+   GSetElem* const elem);
+
+// Remove an element from a hash index
+// Inputs:
+//   that: the index
+//   elem: the element
+static void GSetIndexRemove(
+  GSetIndex* const that,
+   GSetElem* const elem);
+
+// Search an element containing a data in a hash index
+// Inputs:
+//   that: the index
+//   data: the data
+// Output:
+//   Return one of the elements containing the data, or NULL if there is none
+static GSetElem* GSetIndexSearch(
+        GSetIndex const* const that,
+  union GSetElemData const* const data);
+
+// Empty a hash index and index all the elements of a set
+// Inputs:
+//   that: the index
+//    set: the set (if NULL the index is only emptied)
+static void GSetIndexRebuild(
+  GSetIndex* const that,
+  GSet const* const set);
+
+// Create a new GSetIter
+// Input:
+//   type: the type of iteration
+// Output:
+//   Return the new GSetIter.
+GSetIter GSetIterCreate(
+  GSetIterType const type);
+
+// Apply the function of a range on each of its elements
+// Input:
+//   arg: the GSetParallelRange
+// Output:
+//   Return NULL.
+static void* GSetParallelRangeRun(
+  void* arg);
+
+// Take the range at the head of the queue of the pool, process it, and
+// signal it's done. The pool must be locked by the calling thread, it is
+// unlocked while the range is processed.
+static void GSetPoolProcessHead(
+  void);
+
+// Function of the threads of the pool: process the queued ranges until
+// the pool is stopped
+// Input:
+//   unused: unused, for compatibility with pthread_create
+// Output:
+//   Return NULL.
+static void* GSetPoolWorker(
+  void* unused);
+
+// Stop the threads of the pool when the program exits
+static void GSetPoolAtExit(
+  void);
+
+// Process ranges with the threads of the pool and the calling thread
+// Inputs:
+//   ranges: the ranges
+//       nb: the number of ranges, the first one being processed by the
+//           calling thread
+static void GSetPoolRun(
+  GSetParallelRange* const ranges,
+        size_t const nb);
+
+// Combine a sorted set into another sorted set with a single merge pass
+// Inputs:
+//    that: the first set, receiving the result
+//     tho: the second set
+//     cmp: the comparison function the sets are sorted with
+//   flags: the flags (cf GSetAlgebraFlag)
+//      op: the operation
+static void GSetAlgebra(
+           GSet* const that,
+           GSet* const tho,
+  int (* const cmp)(void const*, void const*),
+             int const flags,
+   GSetAlgebraOp const op);
+
+// Search the first element of a sorted chain not lower than a data, with
+// an exponential search followed by a binary search
+// Inputs:
+//   elem: the head of the chain
+//   data: the data
+//    cmp: the comparison function the chain is sorted with
+// Output:
+//   Return the element, or NULL if all the elements are lower than the data
+static GSetElem* GSetElemLowerBound(
+                 GSetElem* const elem,
+  union GSetElemData const* const data,
+  int (* const cmp)(void const*, void const*));
+
+// Move down a head in the min-heap of a k-way merge until the heap property
+// is restored
+// Inputs:
+//   heap: the heap
+//     nb: the number of heads in the heap
+//      i: the position of the head to move
+//    cmp: the comparison function
+static void GSetMergeHeapSiftDown(
+  GSetMergeHead* const heap,
+          size_t const nb,
+                 size_t i,
+  int (* const cmp)(void const*, void const*));
+
+// Move a chain of elements from a set to another
+// Inputs:
+//     that: the set containing the chain
+//    first: the first element of the chain
+//     last: the last element of the chain
+//       nb: the number of elements in the chain
+//      dst: the set receiving the chain
+//   before: the element of dst before which the chain is inserted (NULL to
+//           insert it at the tail of dst)
+static void GSetMoveChain(
+       GSet* const that,
+   GSetElem* const first,
+   GSetElem* const last,
+      size_t const nb,
+       GSet* const dst,
+   GSetElem* const before);
+
+// Allocate memory for a new node of skip list
+// Inputs:
+//      elem: the element of the node
+//   nbLevel: the number of levels of the node
+// Output:
+//   Return the new node
+static GSetSkipNode* GSetSkipNodeAlloc(
+  GSetElem* const elem,
+     size_t const nbLevel);
+
+// Get the skip list of a sorted set, building it if the set has none or
+// if it was built with another comparison function
+// Inputs:
+//   that: the set, sorted according to cmp
+//    cmp: the comparison function
+// Output:
+//   Return the skip list
+static GSetSkipList* GSetSkipListGet(
+  GSet* const that,
+  int (* const cmp)(void const*, void const*));
+
+// Free the memory used by a skip list
+// Input:
+//   that: the skip list
+static void GSetSkipListFree(
+  GSetSkipList** const that);
+
+// Get a random number of levels for a new node of a skip list
+// Input:
+//   that: the skip list
+// Output:
+//   Return the number of levels, in [1, GSET_SKIP_MAX_LEVEL]
+static size_t GSetSkipListRandLevel(
+  GSetSkipList* const that);
+
+// Search the first node of a skip list whose data is not lower (or greater
+// if upper is true) than a data
+// Inputs:
+//     that: the skip list
+//     data: the data
+//    upper: the flag to search for the upper bound instead of the lower one
+//   update: if not NULL, receives for each level the last node before the
+//           searched one
+// Output:
+//   Return the node, or NULL if there is none
+static GSetSkipNode* GSetSkipListSearch(
+  GSetSkipList const* const that,
+          void const* const data,
+                 bool const upper,
+        GSetSkipNode** const update);
+
+// Remove the node of an element from a skip list
+// Inputs:
+//   that: the skip list
+//   elem: the element
+static void GSetSkipListRemove(
+  GSetSkipList* const that,
+      GSetElem* const elem);
+
+// Move an iterator on the first element of a sorted set whose data is not
+// lower (or greater if upper is true) than a data
+// Inputs:
+//    that: the iterator
+//     set: the set, sorted according to cmp
+//    data: the data
+//     cmp: the comparison function
+//   upper: the flag to search for the upper bound instead of the lower one
+// Output:
+//   Return true if the iterator has been moved, false if there is no such
+//   element
+static bool GSetIterBound(
+   GSetIter* const that,
+       GSet* const set,
+  void const* const data,
+  int (* const cmp)(void const*, void const*),
+        bool const upper);
+
+// ================== Public functions definition =========================
+
+// Function to get the commit id of the library
+// Output:
+//   Return a string containing the result of `git rev-parse HEAD` at
+//   compilation time
+char const* GSetGetCommitId(
+  void) {
+
+  // Return the commit id
+  #define STRINGIFY(x) #x
+  #define STRINGIFY_VALUE_OF(x) STRINGIFY(x)
+  return STRINGIFY_VALUE_OF(COMMIT);
+
+}
+
+// Allocate memory for a new GSet
+// Output:
+//   Return the new GSet.
+GSet* GSetAlloc(
+  void) {
+
+  // Allocate memory for the GSet
+  GSet* that = NULL;
+  MALLOC(that, sizeof(GSet));
+
+  // Create the GSet
+  *that = GSetCreate();
+
+  // Return the GSet
+  return that;
+
+}
+
+// Allocate memory for a new GSet, without raising exception
+// Output:
+//   Return the new GSet, or NULL if the allocation failed.
+GSet* GSetAllocNoExc(
+  void) {
+
+  // Allocate memory for the GSet
+  GSet* that = malloc(sizeof(GSet));
+
+  // Create the GSet
+  if (that != NULL) *that = GSetCreate();
+
+  // Return the GSet
+  return that;
+
+}
+
+// Allocate memory for a new bounded GSet. The elements for the data are
+// allocated once here and reused, adding data to or removing data from the
+// set then doesn't allocate or free memory.
+// Inputs:
+//   capacity: the maximum number of data in the set (greater than 0)
+//     policy: the policy when data are added to the set while it is full
+// Output:
+//   Return the new GSet.
+GSet* GSetAllocBounded(
+       size_t const capacity,
+  GSetBoundedPolicy const policy) {
+
+  // Check the capacity
+  if (capacity == 0) Raise(TryCatchExc_OutOfRange);
+
+  // Allocate memory for the GSet
+  GSet* that = GSetAlloc();
+  that->capacity = capacity;
+  that->policy = policy;
+
+  // Allocate the elements, freeing the set if the allocation fails
+  Try {
+
+    GSetElem* last = NULL;
+    while (that->nbSpare < capacity) {
+
+      GSetElem* elem = GSetElemAlloc();
+      if (last == NULL) that->spare = elem;
+      else last->next = elem;
+      last = elem;
+      ++(that->nbSpare);
+
+    }
+
+  } CatchDefault {
+
+    GSetFree_(&that);
+
+  } EndCatch;
+  ForwardExc();
+
+  // Return the GSet
+  return that;
+
+}
+
+// Empty the GSet with GSetEmpty() and free the memory it used.
+// Input:
+//   that: the GSet to be freed
+void GSetFree_(
+  GSet** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Empty the GSet
+  GSetEmpty_(*that);
+
+  // Free the hash index
+  GSetIndexFree(&((*that)->index));
+  GSetSkipListFree(&((*that)->skipList));
+  GSetWindowFree(&((*that)->window));
+  GSetEpochFree(&((*that)->epoch));
+
+  // Free the spare elements
+  GSetElemFreeChain((*that)->spare);
+
+  // Free the memory
+  free(*that);
+  *that = NULL;
+
+}
+
+// Push data at the head of the set
+// Inputs:
+//   that: the set
+//   data: the data
+#define GSETPUSH__(N, T)                                                     \
+void GSetPush_ ## N(                                                         \
+  GSet* const that,                                                          \
+             T const data) {                                                 \
+  GSetElem* elem = GSetElemTakeAtEnd(that, true);                            \
+  elem->data.N = data;                                                       \
+  GSetPushElem(that, elem);                                                  \
+}
+
+GSETPUSH__(Char, char)
+GSETPUSH__(UChar, unsigned char)
+GSETPUSH__(Int, int)
+GSETPUSH__(UInt, unsigned int)
+GSETPUSH__(Long, long)
+GSETPUSH__(ULong, unsigned long)
+GSETPUSH__(Float, float)
+GSETPUSH__(Double, double)
+GSETPUSH__(Ptr, void*)
+
+// Push an array of data at the head of the set
+// Inputs:
+//   that: the set
+//   arr: the array of data
+#define GSETPUSHARR__(N, T)            \
+void GSetPushArr_ ## N(                \
+     GSet* const that,                 \
+    size_t const size,                 \
+  T const* const arr) {                \
+  FOR(i, size) {                       \
+    GSetElem* elem =                   \
+      GSetElemTakeAtEnd(that, true);   \
+    elem->data.N = arr[i];             \
+    GSetPushElem(that, elem);          \
+  }                                    \
+}
+
+#define GSETPUSHARRPTR__(N, T)         \
+void GSetPushArr_ ## N(                \
+     GSet* const that,                 \
+    size_t const size,                 \
+  T const* const arr) {                \
+  FOR(i, size) {                       \
+    GSetElem* elem =                   \
+      GSetElemTakeAtEnd(that, false);  \
+    elem->data.N = ((void**)arr)[i];   \
+    GSetAddElem(that, elem);           \
+  }                                    \
+}
+
+GSETPUSHARR__(Char, char)
+GSETPUSHARR__(UChar, unsigned char)
+GSETPUSHARR__(Int, int)
+GSETPUSHARR__(UInt, unsigned int)
+GSETPUSHARR__(Long, long)
+GSETPUSHARR__(ULong, unsigned long)
+GSETPUSHARR__(Float, float)
+GSETPUSHARR__(Double, double)
+GSETPUSHARRPTR__(Ptr, void)
+
+// Add data at the tail of the set
+// Inputs:
+//   that: the set
+//   data: the data
+#define GSETADD__(N, T)                                                      \
+void GSetAdd_ ## N(                                                          \
+  GSet* const that,                                                          \
+             T const data) {                                                 \
+  GSetElem* elem = GSetElemTakeAtEnd(that, false);                           \
+  elem->data.N = data;                                                       \
+  GSetAddElem(that, elem);                                                   \
+}
+
+GSETADD__(Char, char)
+GSETADD__(UChar, unsigned char)
+GSETADD__(Int, int)
+GSETADD__(UInt, unsigned int)
+GSETADD__(Long, long)
+GSETADD__(ULong, unsigned long)
+GSETADD__(Float, float)
+GSETADD__(Double, double)
+GSETADD__(Ptr, void*)
+
+// Add an array of data at the tail of the set
+// Inputs:
+//   that: the set
+//   arr: the array of data
+#define GSETADDARR__(N, T)             \
+void GSetAddArr_ ## N(                 \
+  GSet* const that,                    \
+             size_t const size,        \
+             T const* const arr) {     \
+  FOR(i, size) {                       \
+    GSetElem* elem =                   \
+      GSetElemTakeAtEnd(that, false);  \
+    elem->data.N = arr[i];             \
+    GSetAddElem(that, elem);           \
+  }                                    \
+}
+
+#define GSETADDARRPTR__(N, T)          \
+void GSetAddArr_ ## N(                 \
+  GSet* const that,                    \
+             size_t const size,        \
+             T const* const arr) {     \
+  FOR(i, size) {                       \
+    GSetElem* elem =                   \
+      GSetElemTakeAtEnd(that, false);  \
+    elem->data.N = ((void**)arr)[i];   \
+    GSetAddElem(that, elem);           \
+  }                                    \
+}
+
+GSETADDARR__(Char, char)
+GSETADDARR__(UChar, unsigned char)
+GSETADDARR__(Int, int)
+GSETADDARR__(UInt, unsigned int)
+GSETADDARR__(Long, long)
+GSETADDARR__(ULong, unsigned long)
+GSETADDARR__(Float, float)
+GSETADDARR__(Double, double)
+GSETADDARRPTR__(Ptr, void)
+
+// Add data before the current position of an iterator
+// Inputs:
+//   that: the set iterator
+//   data: the data
+#define GSETITERADDBEFORE__(N, T)               \
+void GSetIterAddBefore_ ## N(                   \
+  GSetIter* const that,                         \
+          T const data,                         \
+      GSet* const set) {                        \
+  GSetElem* elem = GSetElemTake(set);           \
+  elem->data.N = data;                          \
+  GSetElemAddElemBefore(that->elem, elem, set); \
+}
+GSETITERADDBEFORE__(Char, char)
+GSETITERADDBEFORE__(UChar, unsigned char)
+GSETITERADDBEFORE__(Int, int)
+GSETITERADDBEFORE__(UInt, unsigned int)
+GSETITERADDBEFORE__(Long, long)
+GSETITERADDBEFORE__(ULong, unsigned long)
+GSETITERADDBEFORE__(Float, float)
+GSETITERADDBEFORE__(Double, double)
+GSETITERADDBEFORE__(Ptr, void*)
+
+// Pop data from the head of the set
+// Input:
+//   that: the set
+// Output:
+//   Remove the data at the head of the set and return it
+#define GSETPOP__(N, T)                                \
+T GSetPop_ ## N(                                       \
+  GSet* const that) {                                  \
+  if (that->size == 0) Raise(TryCatchExc_OutOfRange);  \
+  GSetElem* elem = GSetPopElem(that);                  \
+  T data = elem->data.N;                               \
+  GSetElemRelease(that, &elem);                        \
+  return data;                                         \
+}
+
+GSETPOP__(Char, char)
+GSETPOP__(UChar, unsigned char)
+GSETPOP__(Int, int)
+GSETPOP__(UInt, unsigned int)
+GSETPOP__(Long, long)
+GSETPOP__(ULong, unsigned long)
+GSETPOP__(Float, float)
+GSETPOP__(Double, double)
+GSETPOP__(Ptr, void*)
+
+// Drop data from the tail of the set
+// Input:
+//   that: the set
+// Output:
+//   Remove the data at the tail of the set and return it
+#define GSETDROP__(N, T)                               \
+T GSetDrop_ ## N(                                      \
+  GSet* const that) {                                  \
+  if (that->size == 0) Raise(TryCatchExc_OutOfRange);  \
+  GSetElem* elem = GSetDropElem(that);                 \
+  T data = elem->data.N;                               \
+  GSetElemRelease(that, &elem);                        \
+  return data;                                         \
+}
+
+GSETDROP__(Char, char)
+GSETDROP__(UChar, unsigned char)
+GSETDROP__(Int, int)
+GSETDROP__(UInt, unsigned int)
+GSETDROP__(Long, long)
+GSETDROP__(ULong, unsigned long)
+GSETDROP__(Float, float)
+GSETDROP__(Double, double)
+GSETDROP__(Ptr, void*)
+
+// Pop data from the head of the set, without raising exception
+// Inputs:
+//   that: the set
+//   data: receives the data (may be NULL)
+// Output:
+//   If the set is not empty, remove the data at its head, copy it into
+//   'data' and return true. Else, return false.
+#define GSETTRYPOP__(N, T)                     \
+bool GSetTryPop_ ## N(                         \
+  GSet* const that,                            \
+     T* const data) {                          \
+  if (that->size == 0) return false;           \
+  GSetElem* elem = GSetPopElem(that);          \
+  if (data != NULL) *data = elem->data.N;      \
+  GSetElemRelease(that, &elem);                \
+  return true;                                 \
+}
+
+GSETTRYPOP__(Char, char)
+GSETTRYPOP__(UChar, unsigned char)
+GSETTRYPOP__(Int, int)
+GSETTRYPOP__(UInt, unsigned int)
+GSETTRYPOP__(Long, long)
+GSETTRYPOP__(ULong, unsigned long)
+GSETTRYPOP__(Float, float)
+GSETTRYPOP__(Double, double)
+GSETTRYPOP__(Ptr, void*)
+
+// Drop data from the tail of the set, without raising exception
+// Inputs:
+//   that: the set
+//   data: receives the data (may be NULL)
+// Output:
+//   If the set is not empty, remove the data at its tail, copy it into
+//   'data' and return true. Else, return false.
+#define GSETTRYDROP__(N, T)                    \
+bool GSetTryDrop_ ## N(                        \
+  GSet* const that,                            \
+     T* const data) {                          \
+  if (that->size == 0) return false;           \
+  GSetElem* elem = GSetDropElem(that);         \
+  if (data != NULL) *data = elem->data.N;      \
+  GSetElemRelease(that, &elem);                \
+  return true;                                 \
+}
+
+GSETTRYDROP__(Char, char)
+GSETTRYDROP__(UChar, unsigned char)
+GSETTRYDROP__(Int, int)
+GSETTRYDROP__(UInt, unsigned int)
+GSETTRYDROP__(Long, long)
+GSETTRYDROP__(ULong, unsigned long)
+GSETTRYDROP__(Float, float)
+GSETTRYDROP__(Double, double)
+GSETTRYDROP__(Ptr, void*)
+
+// Pop several data from the head of the set at once. The popped elements
+// are unlinked as one chain and released by slab.
+// Inputs:
+//   that: the set
+//     nb: the number of data to pop
+//    arr: the array receiving the data, in the order they are popped (may
+//         be NULL)
+// Output:
+//   Remove the min(nb, size of the set) data at the head of the set, copy
+//   them into 'arr' and return their number
+#define GSETPOPARR__(N, T)                                                   \
+size_t GSetPopArr_ ## N(                                                     \
+  GSet* const that,                                                          \
+  size_t const nb,                                                           \
+     T* const arr) {                                                         \
+  size_t nbPop = (nb < that->size ? nb : that->size);                        \
+  if (nbPop == 0) return 0;                                                  \
+  bool notify =                                                              \
+    (that->index != NULL || that->skipList != NULL || that->window != NULL); \
+  GSetElem* first = that->first;                                             \
+  GSetElem* last = NULL;                                                     \
+  GSetElem* elem = first;                                                    \
+  FOR(iElem, nbPop) {                                                        \
+    if (notify) GSetNotifyRemove(that, elem);                                \
+    if (arr != NULL) arr[iElem] = elem->data.N;                              \
+    last = elem;                                                             \
+    elem = elem->next;                                                       \
+  }                                                                          \
+  GSetEpochLink(that, &(that->first), elem);                                 \
+  if (elem != NULL) GSetEpochLink(that, &(elem->prev), NULL);                \
+  else GSetEpochLink(that, &(that->last), NULL);                             \
+  GSetEpochLink(that, &(last->next), NULL);                                  \
+  that->size -= nbPop;                                                       \
+  GSetElemReleaseChain(that, first, last, nbPop);                            \
+  return nbPop;                                                              \
+}
+
+GSETPOPARR__(Char, char)
+GSETPOPARR__(UChar, unsigned char)
+GSETPOPARR__(Int, int)
+GSETPOPARR__(UInt, unsigned int)
+GSETPOPARR__(Long, long)
+GSETPOPARR__(ULong, unsigned long)
+GSETPOPARR__(Float, float)
+GSETPOPARR__(Double, double)
+GSETPOPARR__(Ptr, void*)
+
+// Drop several data from the tail of the set at once. The dropped elements
+// are unlinked as one chain and released by slab.
+// Inputs:
+//   that: the set
+//     nb: the number of data to drop
+//    arr: the array receiving the data, in the order they are dropped (may
+//         be NULL)
+// Output:
+//   Remove the min(nb, size of the set) data at the tail of the set, copy
+//   them into 'arr' and return their number
+#define GSETDROPARR__(N, T)                                                  \
+size_t GSetDropArr_ ## N(                                                    \
+  GSet* const that,                                                          \
+  size_t const nb,                                                           \
+     T* const arr) {                                                         \
+  size_t nbDrop = (nb < that->size ? nb : that->size);                       \
+  if (nbDrop == 0) return 0;                                                 \
+  bool notify =                                                              \
+    (that->index != NULL || that->skipList != NULL || that->window != NULL); \
+  GSetElem* first = NULL;                                                    \
+  GSetElem* last = that->last;                                               \
+  GSetElem* elem = last;                                                     \
+  FOR(iElem, nbDrop) {                                                       \
+    if (notify) GSetNotifyRemove(that, elem);                                \
+    if (arr != NULL) arr[iElem] = elem->data.N;                              \
+    first = elem;                                                            \
+    elem = elem->prev;                                                       \
+  }                                                                          \
+  GSetEpochLink(that, &(that->last), elem);                                  \
+  if (elem != NULL) GSetEpochLink(that, &(elem->next), NULL);                \
+  else GSetEpochLink(that, &(that->first), NULL);                            \
+  that->size -= nbDrop;                                                      \
+  GSetElemReleaseChain(that, first, last, nbDrop);                           \
+  return nbDrop;                                                             \
+}
+
+GSETDROPARR__(Char, char)
+GSETDROPARR__(UChar, unsigned char)
+GSETDROPARR__(Int, int)
+GSETDROPARR__(UInt, unsigned int)
+GSETDROPARR__(Long, long)
+GSETDROPARR__(ULong, unsigned long)
+GSETDROPARR__(Float, float)
+GSETDROPARR__(Double, double)
+GSETDROPARR__(Ptr, void*)
+
+// Append data from a set to the end of another
+// Input:
+//   that: the set where data are added
+//   tho: the set containing data to add
+void GSetAppend_(
+        GSet* const that,
+  GSet const* const tho) {
+
+  // Appending a set to itself will create infinite loop
+  if (that == tho) Raise(TryCatchExc_InfiniteLoop);
+
+  // If the set source is empty, nothing to do
+  if (tho->size == 0) return;
+
+  // If the set is bounded, add the data one by one to apply its policy
+  if (that->capacity > 0) {
+
+    for (GSetElem const* src = tho->first; src != NULL; src = src->next) {
+
+      GSetElem* elem = GSetElemTakeAtEnd(that, false);
+      elem->data = src->data;
+      GSetAddElem(that, elem);
+
+    }
+
+    return;
+
+  }
+
+  // Check for overflow
+  if (that->size > SIZE_MAX - tho->size) Raise(TryCatchExc_IntOverflow);
+
+  // Allocate all the new elements at once, copy the data and link them at
+  // the tail of the set
+  GSetElem* last = NULL;
+  GSetElem* first = GSetElemAllocCopy(tho->first, tho->size, &last);
+  GSetAppendChain(that, first, last, tho->size);
+
+}
+
+// Clone a set. The hash index and skip list of the set are not cloned.
+// Input:
+//   that: the set
+// Output:
+//   Return the clone of the set
+GSet* GSetClone_(
+  GSet const* const that) {
+
+  // Allocate all the new elements at once and copy the data
+  GSetElem* first = NULL;
+  GSetElem* last = NULL;
+  if (that->size > 0)
+    first = GSetElemAllocCopy(that->first, that->size, &last);
+
+  // Allocate the clone
+  GSet* clone = malloc(sizeof(GSet));
+  if (clone == NULL) {
+
+    GSetElemFreeChain(first);
+    Raise(TryCatchExc_MallocFailed);
+
+  }
+
+  *clone = GSetCreate();
+  clone->first = first;
+  clone->last = last;
+  clone->size = that->size;
+  return clone;
+
+}
+
+// Merge a set into another. The merged set is empty after this operation
+// Input:
+//   that: the extended set
+//   tho: the merged set
+void GSetMerge_(
+  GSet* const that,
+  GSet* const tho) {
+
+  // Merging a set to itself will create infinite loop
+  if (that == tho) Raise(TryCatchExc_InfiniteLoop);
+
+  // If the merged set is empty, nothing to do
+  if (tho->size == 0) return;
+
+  // Check for overflow
+  if (that->size > SIZE_MAX - tho->size) Raise(TryCatchExc_IntOverflow);
+
+  // Move the elements of tho from its index to the one of that. that may
+  // not be sorted anymore
+  if (tho->index != NULL) GSetIndexRebuild(tho->index, NULL);
+  GSetSkipListFree(&(tho->skipList));
+  GSetSkipListFree(&(that->skipList));
+  GSetWindowInvalidate(tho->window);
+  GSetWindowInvalidate(that->window);
+  if (that->index != NULL)
+    for (GSetElem* ptr = tho->first; ptr != NULL; ptr = ptr->next)
+      GSetIndexAdd(that->index, ptr);
+
+  // If that is empty
+  if (that->size == 0) {
+
+    // Simply copy the elements of tho in that
+    that->first = tho->first;
+    that->last = tho->last;
+    that->size = tho->size;
+
+  // Else, that is not empty
+  } else {
+
+    // Connect the tail of that to the head of tho
+    that->last->next = tho->first;
+    tho->first->prev = that->last;
+
+    // Update the last element of that
+    that->last = tho->last;
+
+    // Update the size of that
+    that->size += tho->size;
+
+  }
+
+  // Empty tho
+  tho->first = NULL;
+  tho->last = NULL;
+  tho->size = 0;
+
+}
+
+// Union of two sets sorted with the same comparison function, the result
+// replacing the first set
+// Inputs:
+//    that: the first set
+//     tho: the second set
+//     cmp: the comparison function
+//   flags: the flags (cf GSetAlgebraFlag)
+void GSetUnion_(
+           GSet* const that,
+           GSet* const tho,
+  int (* const cmp)(void const*, void const*),
+             int const flags) {
+
+  GSetAlgebra(that, tho, cmp, flags, GSetAlgebraOp_Union);
+
+}
+
+// Intersection of two sets sorted with the same comparison function, the
+// result replacing the first set
+// Inputs:
+//    that: the first set
+//     tho: the second set
+//     cmp: the comparison function
+//   flags: the flags (cf GSetAlgebraFlag)
+void GSetIntersect_(
+           GSet* const that,
+           GSet* const tho,
+  int (* const cmp)(void const*, void const*),
+             int const flags) {
+
+  GSetAlgebra(that, tho, cmp, flags, GSetAlgebraOp_Intersect);
+
+}
+
+// Difference of two sets sorted with the same comparison function, the
+// result replacing the first set
+// Inputs:
+//    that: the first set
+//     tho: the second set
+//     cmp: the comparison function
+//   flags: the flags (cf GSetAlgebraFlag)
+void GSetDifference_(
+           GSet* const that,
+           GSet* const tho,
+  int (* const cmp)(void const*, void const*),
+             int const flags) {
+
+  GSetAlgebra(that, tho, cmp, flags, GSetAlgebraOp_Difference);
+
+}
+
+// Symmetric difference of two sets sorted with the same comparison
+// function, the result replacing the first set
+// Inputs:
+//    that: the first set
+//     tho: the second set
+//     cmp: the comparison function
+//   flags: the flags (cf GSetAlgebraFlag)
+void GSetSymDiff_(
+           GSet* const that,
+           GSet* const tho,
+  int (* const cmp)(void const*, void const*),
+             int const flags) {
+
+  GSetAlgebra(that, tho, cmp, flags, GSetAlgebraOp_SymDiff);
+
+}
+
+// Merge sets sorted with the same comparison function into another sorted
+// set, with a k-way merge relinking their elements. The merged sets are
+// empty after this operation
+// Inputs:
+//   that: the extended set
+//   sets: the merged sets
+//     nb: the number of merged sets
+//    cmp: the comparison function
+void GSetMergeSorted_(
+         GSet* const that,
+  GSet* const* const sets,
+         size_t const nb,
+  int (* const cmp)(void const*, void const*)) {
+
+  // Check for overflow (a set given several times being counted once
+  // per occurrence)
+  size_t size = that->size;
+  FOR(iSet, nb) {
+
+    if (sets[iSet] == that) continue;
+    if (size > SIZE_MAX - sets[iSet]->size) Raise(TryCatchExc_IntOverflow);
+    size += sets[iSet]->size;
+
+  }
+
+  // Allocate the heap, the elements of that being one of the chains
+  GSetMergeHead* heap = NULL;
+  MALLOC(heap, sizeof(GSetMergeHead) * (nb + 1));
+
+  // Detach the chains of elements from their set. A set given several
+  // times is empty after its first occurrence and then skipped
+  size_t nbHead = 0;
+  size = 0;
+  GSetWindowInvalidate(that->window);
+  FOR(iSet, nb + 1) {
+
+    GSet* const set = (iSet == 0 ? that : sets[iSet - 1]);
+    if (set->size == 0) continue;
+    size += set->size;
+    GSetSkipListFree(&(set->skipList));
+    GSetWindowInvalidate(set->window);
+    if (set != that) {
+
+      if (set->index != NULL) GSetIndexRebuild(set->index, NULL);
+      if (that->index != NULL)
+        for (GSetElem* ptr = set->first; ptr != NULL; ptr = ptr->next)
+          GSetIndexAdd(that->index, ptr);
+
+    }
+
+    heap[nbHead] = (GSetMergeHead) {
+
+      .elem = set->first,
+      .last = set->last,
+      .rank = iSet,
+
+    };
+    ++nbHead;
+    set->first = NULL;
+    set->last = NULL;
+    set->size = 0;
+
+  }
+
+  // Heapify
+  for (size_t iHead = nbHead / 2; iHead > 0; --iHead)
+    GSetMergeHeapSiftDown(heap, nbHead, iHead - 1, cmp);
+
+  // Relink the lowest head of the heap at the tail of the result until one
+  // chain only remains, which is then relinked as a whole
+  GSetElem* first = NULL;
+  GSetElem* last = NULL;
+  while (nbHead > 0) {
+
+    GSetElem* elem = heap[0].elem;
+    elem->prev = last;
+    if (last != NULL) last->next = elem;
+    else first = elem;
+    if (nbHead == 1) {
+
+      last = heap[0].last;
+      break;
+
+    }
+
+    last = elem;
+    heap[0].elem = elem->next;
+    if (heap[0].elem == NULL) {
+
+      --nbHead;
+      heap[0] = heap[nbHead];
+
+    }
+
+    GSetMergeHeapSiftDown(heap, nbHead, 0, cmp);
+
+  }
+
+  free(heap);
+
+  // Update that
+  that->first = first;
+  that->last = last;
+  that->size = size;
+
+}
+
+// Remove from a set, in a single pass, the elements whose data satisfy a
+// predicate. The removed elements are freed (but not their data), or moved
+// without allocation at the tail of another set
+// Inputs:
+//     that: the set
+//      fun: the predicate, same interface as a filter of iterator, returns
+//           true for the data to remove
+//   params: the parameters of the predicate
+//      out: the set receiving the removed elements, or NULL to free them
+// Output:
+//   Return the number of removed elements
+size_t GSetRemoveIf_(
+         GSet* const that,
+  GSetIterFilterFun fun,
+               void* params,
+         GSet* const out) {
+
+  // Moving elements to the same set would loop on them forever
+  if (that == out) Raise(TryCatchExc_InfiniteLoop);
+
+  // Check for overflow
+  if (out != NULL && out->size > SIZE_MAX - that->size)
+    Raise(TryCatchExc_IntOverflow);
+
+  // Loop on the elements
+  size_t nb = 0;
+  GSetElem* ptr = that->first;
+  while (ptr != NULL) {
+
+    GSetElem* next = ptr->next;
+    if (fun(&(ptr->data), params)) {
+
+      // Unlink the element and relink it in out, or free it
+      GSetRemoveElem(that, ptr);
+      if (out != NULL) {
+
+        ptr->next = NULL;
+        GSetAddElem(out, ptr);
+
+      } else {
+
+        GSetElemRelease(that, &ptr);
+
+      }
+
+      ++nb;
+
+    }
+
+    ptr = next;
+
+  }
+
+  return nb;
+
+}
+
+// Move the elements of a set from the current element of an iterator to
+// the tail, at the tail of another set. The elements are relinked in O(1),
+// their number is counted in O(min(k, n - k)), and indexed in O(k) if a
+// set has a hash index
+// Inputs:
+//   that: the set
+//   iter: the iterator on the set
+//    out: the set receiving the elements
+void GSetSplitAt_(
+            GSet* const that,
+  GSetIter const* const iter,
+            GSet* const out) {
+
+  // Moving elements to the same set would corrupt it
+  if (that == out) Raise(TryCatchExc_InfiniteLoop);
+
+  // If the iterator has no current element, nothing to do
+  GSetElem* const elem = iter->elem;
+  if (elem == NULL) return;
+
+  // Count the moved elements from the element toward the tail and the kept
+  // elements from the head toward the element at the same time, and stop
+  // as soon as one of the two counts is known
+  size_t nb = 0;
+  size_t nbKept = 0;
+  GSetElem* fwd = elem;
+  GSetElem* head = that->first;
+  while (fwd != NULL && head != elem) {
+
+    fwd = fwd->next;
+    ++nb;
+    head = head->next;
+    ++nbKept;
+
+  }
+
+  if (fwd != NULL) nb = that->size - nbKept;
+
+  GSetMoveChain(that, elem, that->last, nb, out, NULL);
+
+}
+
+// Move all the elements of a set before the current element of an iterator
+// on another set (at its tail if the iterator has no current element), in
+// O(1) or O(k) if a set has a hash index. The moved set is empty after
+// this operation
+// Inputs:
+//   that: the iterator
+//    set: the set of the iterator
+//    src: the moved set
+void GSetSpliceBefore_(
+  GSetIter const* const that,
+            GSet* const set,
+            GSet* const src) {
+
+  // Splicing a set into itself would corrupt it
+  if (set == src) Raise(TryCatchExc_InfiniteLoop);
+
+  if (src->size == 0) return;
+  GSetMoveChain(src, src->first, src->last, src->size, set, that->elem);
+
+}
+
+// Move the elements of a set from the current element of an iterator up
+// to the current element of another iterator (included) at the tail of
+// another set. The elements are relinked in O(1) and counted in O(k)
+// Inputs:
+//   that: the set
+//   from: the iterator on the first moved element
+//     to: the iterator on the last moved element
+//    dst: the set receiving the elements
+void GSetMoveRange_(
+            GSet* const that,
+  GSetIter const* const from,
+  GSetIter const* const to,
+            GSet* const dst) {
+
+  // Moving elements to the same set would corrupt it
+  if (that == dst) Raise(TryCatchExc_InfiniteLoop);
+
+  // Count the moved elements, the last one must follow the first one
+  if (from->elem == NULL || to->elem == NULL) Raise(TryCatchExc_OutOfRange);
+  size_t nb = 1;
+  GSetElem* ptr = from->elem;
+  while (ptr != to->elem) {
+
+    ptr = ptr->next;
+    if (ptr == NULL) Raise(TryCatchExc_OutOfRange);
+    ++nb;
+
+  }
+
+  GSetMoveChain(that, from->elem, to->elem, nb, dst, NULL);
+
+}
+
+// Return the number of element in the set
+// Input:
+//   that: the set
+// Output:
+//   Return the number of element.
+size_t GSetGetSize_(
+  GSet const* const that) {
+
+  return that->size;
+
+}
+
+// Return the capacity of the set
+// Input:
+//   that: the set
+// Output:
+//   Return the maximum number of element of a bounded set, 0 for an unbounded
+//   set.
+size_t GSetGetCapacity_(
+  GSet const* const that) {
+
+  return that->capacity;
+
+}
+
+// Empty the set. Memory used by data in it is not freed.
+// To empty the set and free data, use GSet<N>Flush() instead.
+// Input:
+//   that: the set
+void GSetEmpty_(
+  GSet* const that) {
+
+  // Empty the hash index at once rather than element by element
+  if (that->index != NULL) GSetIndexRebuild(that->index, NULL);
+  GSetSkipListFree(&(that->skipList));
+  GSetWindowInvalidate(that->window);
+
+  // Loop until the set is empty
+  while (GSetGetSize_(that) > 0) {
+
+    // Pop the element
+    GSetElem* elem = GSetPopElem(that);
+
+    // Free the element, in memory of L3-37
+    GSetElemRelease(that, &elem);
+
+  }
+
+}
+
+// Shuffle the set
+// Input:
+//   that: the set
+void GSetShuffle_(
+  GSet* const that) {
+
+  // If the array has less than 2 elements, nothing to do
+  if (that->size < 2) return;
+
+  // Convert the GSet into an array of pointers to data
+  union GSetElemData* arr = NULL;
+  MALLOC(arr, sizeof(union GSetElemData) * that->size);
+  GSetElem* ptr = that->first;
+  size_t i = 0;
+  while (ptr != NULL) {
+
+    arr[i] = ptr->data;
+    ptr = ptr->next;
+    ++i;
+
+  }
+
+  // Shuffle the array
+  // (Fischer-Yates-Durstenfeld-Knuth algorithm)
+  for (size_t i = that->size - 1; i > 0; --i) {
+
+     size_t j = (size_t)round(rnd() * (double)i);
+     if (i != j) {
+
+       union GSetElemData ptr = arr[j];
+       arr[j] = arr[i];
+       arr[i] = ptr;
+
+     }
+
+  }
+
+  // Copy the shuffled data back in the elements
+  ptr = that->first;
+  i = 0;
+  while (ptr != NULL) {
+
+    ptr->data = arr[i];
+    ptr = ptr->next;
+    ++i;
+
+  }
+
+  // Free memory used by the temporary array
+  free(arr);
+
+  // Update the index
+  GSetNotifyUpdate(that);
+
+}
+
+// Sort the elements of a GSet
+// Inputs:
+//   that: the set to sort
+//   cmp: the comparison function used to sort
+// It uses qsort, see man page for details. Elements are sorted in ascending
+// order, relative to the comparison function cmp(a,b) which much returns
+// a negative value if a<b, a positive value if a>b, and 0 if a=b
+#define GSETSORT__(N, T)                                 \
+void GSetSort_ ## N(                                     \
+  GSet* const that,                                      \
+          int (* const cmp)(void const*, void const*),   \
+         bool const inc) {                               \
+  if (that->size < 2) return;                            \
+  T* arr = NULL;                                         \
+  MALLOC(arr, sizeof(T) * that->size);                   \
+  GSetElem* ptr = that->first;                           \
+  size_t i = 0;                                          \
+  while (ptr != NULL) {                                  \
     arr[i] = ptr->data.N;                                \
     ptr = ptr->next;                                     \
     ++i;                                                 \
@@ -627,860 +2933,7667 @@ void GSetSort_ ## N(                                     \
       ++i;                                               \
     }                                                    \
     free(arr);                                           \
+    GSetNotifyUpdate(that);                              \
   } CatchDefault {                                       \
     free(arr); Raise(TryCatchGetLastExc());              \
   } EndCatch;                                            \
 }
 
-GSETSORT__(Char, char)
-GSETSORT__(UChar, unsigned char)
-GSETSORT__(Int, int)
-GSETSORT__(UInt, unsigned int)
-GSETSORT__(Long, long)
-GSETSORT__(ULong, unsigned long)
-GSETSORT__(Float, float)
-GSETSORT__(Double, double)
-GSETSORT__(Ptr, void*)
+GSETSORT__(Char, char)
+GSETSORT__(UChar, unsigned char)
+GSETSORT__(Int, int)
+GSETSORT__(UInt, unsigned int)
+GSETSORT__(Long, long)
+GSETSORT__(ULong, unsigned long)
+GSETSORT__(Float, float)
+GSETSORT__(Double, double)
+GSETSORT__(Ptr, void*)
+
+// Apply a built-in operation on each data of a set, the result replacing
+// the data in the set
+// Inputs:
+//   that: the set
+//     op: the operation
+//      a: the first parameter of the operation
+//      b: the second parameter of the operation (unused by some operations)
+// The switch on the operation is done once, out of the loop on elements
+#define GSETAPPLY__(N, T)                                        \
+void GSetApply_ ## N(                                            \
+         GSet* const that,                                       \
+  GSetApplyOp const op,                                          \
+            T const a,                                           \
+            T const b) {                                         \
+  GSetElem* ptr = that->first;                                   \
+  switch (op) {                                                  \
+    case GSetApplyOp_Scale:                                      \
+      for (; ptr != NULL; ptr = ptr->next)                       \
+        ptr->data.N = a * ptr->data.N;                           \
+      break;                                                     \
+    case GSetApplyOp_Offset:                                     \
+      for (; ptr != NULL; ptr = ptr->next)                       \
+        ptr->data.N = ptr->data.N + a;                           \
+      break;                                                     \
+    case GSetApplyOp_Affine:                                     \
+      for (; ptr != NULL; ptr = ptr->next)                       \
+        ptr->data.N = a * ptr->data.N + b;                       \
+      break;                                                     \
+    case GSetApplyOp_Clamp:                                      \
+      for (; ptr != NULL; ptr = ptr->next) {                     \
+        T v = ptr->data.N;                                       \
+        ptr->data.N = (v < a ? a : (v > b ? b : v));             \
+      }                                                          \
+      break;                                                     \
+    default:                                                     \
+      Raise(TryCatchExc_NotYetImplemented);                      \
+  }                                                              \
+  GSetNotifyUpdate(that);                                        \
+}
+
+GSETAPPLY__(Int, int)
+GSETAPPLY__(UInt, unsigned int)
+GSETAPPLY__(Long, long)
+GSETAPPLY__(ULong, unsigned long)
+GSETAPPLY__(Float, float)
+GSETAPPLY__(Double, double)
+
+// Apply a user defined function on each data of a set
+// Inputs:
+//     that: the set
+//      fun: the function
+//   params: the parameters of the function
+void GSetApplyWith_(
+  GSet* const that,
+   GSetApplyFun fun,
+          void* params) {
+
+  // Loop on the elements and apply the function on their data
+  for (GSetElem* ptr = that->first; ptr != NULL; ptr = ptr->next)
+    fun(
+      &(ptr->data),
+      params);
+
+  // Update the index
+  GSetNotifyUpdate(that);
+
+}
+
+// Remove the duplicate data of a set, keeping the first occurrence of each
+// data
+// Inputs:
+//   that: the set
+//   mode: the mode
+//    key: an empty index defining the type of keys and used to memorise
+//         the already seen data in GSetUniqueHash mode
+// Output:
+//   Return the number of removed elements
+static size_t GSetUniqueWithKey(
+           GSet* const that,
+  GSetUniqueMode const mode,
+      GSetIndex* const key) {
+
+  // Chain of removed elements, freed in bulk at the end
+  GSetElem* removed = NULL;
+  size_t nbRemoved = 0;
+
+  // Loop on the elements
+  GSetElem* ptr = that->first;
+  while (ptr != NULL) {
+
+    GSetElem* next = ptr->next;
+
+    // Check if the element is a duplicate
+    bool isDuplicate = false;
+    if (mode == GSetUniqueSorted) {
+
+      isDuplicate =
+        (ptr->prev != NULL &&
+         GSetIndexEq(key, &(ptr->prev->data), &(ptr->data)));
+
+    } else {
+
+      isDuplicate = (GSetIndexSearch(key, &(ptr->data)) != NULL);
+      if (isDuplicate == false) GSetIndexAdd(key, ptr);
+
+    }
+
+    // Remove the duplicate
+    if (isDuplicate) {
+
+      GSetRemoveElem(that, ptr);
+      ptr->next = removed;
+      removed = ptr;
+      ++nbRemoved;
+
+    }
+
+    ptr = next;
+
+  }
+
+  // Free the removed elements
+  while (removed != NULL) {
+
+    GSetElem* elem = removed;
+    removed = removed->next;
+    GSetElemRelease(that, &elem);
+
+  }
+
+  return nbRemoved;
+
+}
+
+// Remove the duplicate data of a set, keeping the first occurrence of each
+// data
+// Inputs:
+//   that: the set
+//   mode: the mode
+// Output:
+//   Return the number of removed elements
+#define GSETUNIQUE__(N, T)                                                   \
+size_t GSetUnique_ ## N(                                                     \
+             GSet* const that,                                               \
+  GSetUniqueMode const mode) {                                               \
+  if (that->size < 2) return 0;                                              \
+  GSetIndex key = {                                                          \
+    .type = GSetKeyType_ ## N, .hash = NULL, .eq = NULL,                     \
+    .nbSlot = 16, .nbUsed = 0, .slots = NULL                                 \
+  };                                                                         \
+  if (that->index != NULL) {                                                 \
+    key.type = that->index->type;                                            \
+    key.hash = that->index->hash;                                            \
+    key.eq = that->index->eq;                                                \
+  }                                                                          \
+  if (mode == GSetUniqueSorted) return GSetUniqueWithKey(that, mode, &key);  \
+  if (mode != GSetUniqueHash) Raise(TryCatchExc_NotYetImplemented);          \
+  while (key.nbSlot < 2 * that->size) key.nbSlot *= 2;                       \
+  key.slots = calloc(key.nbSlot, sizeof(GSetIndexSlot));                     \
+  if (key.slots == NULL) Raise(TryCatchExc_MallocFailed);                    \
+  size_t nbRemoved = 0;                                                      \
+  Try {                                                                      \
+    nbRemoved = GSetUniqueWithKey(that, mode, &key);                         \
+  } EndCatch;                                                                \
+  free(key.slots);                                                           \
+  ForwardExc();                                                              \
+  return nbRemoved;                                                          \
+}
+
+GSETUNIQUE__(Char, char)
+GSETUNIQUE__(UChar, unsigned char)
+GSETUNIQUE__(Int, int)
+GSETUNIQUE__(UInt, unsigned int)
+GSETUNIQUE__(Long, long)
+GSETUNIQUE__(ULong, unsigned long)
+GSETUNIQUE__(Float, float)
+GSETUNIQUE__(Double, double)
+GSETUNIQUE__(Ptr, void*)
+
+// Gather the data of the set from a given element into a buffer
+// Inputs:
+//   ptr: the first element to gather, updated to the element following the
+//        last gathered one
+//   buf: the buffer, of size GSET_BLOCK_SIZE
+// Output:
+//   Return the number of gathered data
+#define GSETGATHER__(N, T)                                 \
+static size_t GSetGather_ ## N(                            \
+  GSetElem const** const ptr,                              \
+                T* const buf) {                            \
+  size_t nb = 0;                                           \
+  GSetElem const* elem = *ptr;                             \
+  while (elem != NULL && nb < GSET_BLOCK_SIZE) {           \
+    buf[nb] = elem->data.N;                                \
+    ++nb;                                                  \
+    elem = elem->next;                                     \
+  }                                                        \
+  *ptr = elem;                                             \
+  return nb;                                               \
+}
+
+// Sum of a block of data, accumulated into R (unsigned long for integer
+// data, so that an overflow wraps around instead of being undefined)
+// Inputs:
+//   arr: the data
+//    nb: the number of data
+// Output:
+//   Return the sum
+#define GSETSUMBLOCK__(N, T, R)                            \
+GSET_KERNEL static R GSetSumBlock_ ## N(                   \
+  T const* const arr,                                      \
+      size_t const nb) {                                   \
+  R acc[GSET_NB_LANE] = {0};                               \
+  size_t i = 0;                                            \
+  for (; i + GSET_NB_LANE <= nb; i += GSET_NB_LANE)        \
+    FOR(j, GSET_NB_LANE) acc[j] += (R)(arr[i + j]);        \
+  for (; i < nb; ++i) acc[0] += (R)(arr[i]);               \
+  for (size_t j = GSET_NB_LANE / 2; j > 0; j /= 2)         \
+    FOR(k, j) acc[k] += acc[k + j];                        \
+  return acc[0];                                           \
+}
+
+// Minimum and maximum of a block of data
+// Inputs:
+//   arr: the data
+//    nb: the number of data (must be at least 1)
+//   min: the minimum, updated with the block's data
+//   max: the maximum, updated with the block's data
+#define GSETMINMAXBLOCK__(N, T)                            \
+GSET_KERNEL static void GSetMinMaxBlock_ ## N(             \
+  T const* const arr,                                      \
+      size_t const nb,                                     \
+        T* const min,                                      \
+        T* const max) {                                    \
+  T mins[GSET_NB_LANE];                                    \
+  T maxs[GSET_NB_LANE];                                    \
+  FOR(j, GSET_NB_LANE) {                                   \
+    mins[j] = *min;                                        \
+    maxs[j] = *max;                                        \
+  }                                                        \
+  size_t i = 0;                                            \
+  for (; i + GSET_NB_LANE <= nb; i += GSET_NB_LANE)        \
+    FOR(j, GSET_NB_LANE) {                                 \
+      T v = arr[i + j];                                    \
+      mins[j] = (v < mins[j] ? v : mins[j]);               \
+      maxs[j] = (v > maxs[j] ? v : maxs[j]);               \
+    }                                                      \
+  for (; i < nb; ++i) {                                    \
+    mins[0] = (arr[i] < mins[0] ? arr[i] : mins[0]);       \
+    maxs[0] = (arr[i] > maxs[0] ? arr[i] : maxs[0]);       \
+  }                                                        \
+  FOR(j, GSET_NB_LANE) {                                   \
+    if (mins[j] < *min) *min = mins[j];                    \
+    if (maxs[j] > *max) *max = maxs[j];                    \
+  }                                                        \
+}
+
+// Sum of the squared deviations from a mean of a block of data
+// Inputs:
+//    arr: the data
+//     nb: the number of data
+//   mean: the mean
+// Output:
+//   Return the sum
+#define GSETDEVBLOCK__(N, T)                               \
+GSET_KERNEL static double GSetDevBlock_ ## N(              \
+  T const* const arr,                                      \
+      size_t const nb,                                     \
+    double const mean) {                                   \
+  double acc[GSET_NB_LANE] = {0};                          \
+  size_t i = 0;                                            \
+  for (; i + GSET_NB_LANE <= nb; i += GSET_NB_LANE)        \
+    FOR(j, GSET_NB_LANE) {                                 \
+      double d = (double)(arr[i + j]) - mean;              \
+      acc[j] += d * d;                                     \
+    }                                                      \
+  for (; i < nb; ++i) {                                    \
+    double d = (double)(arr[i]) - mean;                    \
+    acc[0] += d * d;                                       \
+  }                                                        \
+  for (size_t j = GSET_NB_LANE / 2; j > 0; j /= 2)         \
+    FOR(k, j) acc[k] += acc[k + j];                        \
+  return acc[0];                                           \
+}
+
+// Mean and sum of squared deviations from the mean of the data of a set.
+// Each block is reduced exactly with two passes on the gathered data, and
+// the blocks are combined with the parallel algorithm of Chan et al., which
+// keeps the result accurate on large sets.
+// Inputs:
+//   that: the set
+//   mean: where to store the mean
+//     m2: where to store the sum of squared deviations
+// Raise TryCatchExc_OutOfRange if the set is empty
+#define GSETMOMENTS__(N, T)                                                  \
+static void GSetMoments_ ## N(                                               \
+  GSet const* const that,                                                    \
+      double* const mean,                                                    \
+      double* const m2) {                                                    \
+  if (that->size == 0) Raise(TryCatchExc_OutOfRange);                        \
+  T buf[GSET_BLOCK_SIZE];                                                    \
+  GSetElem const* ptr = that->first;                                         \
+  double nbAcc = 0.0;                                                        \
+  *mean = 0.0;                                                               \
+  *m2 = 0.0;                                                                 \
+  while (ptr != NULL) {                                                      \
+    size_t nb = GSetGather_ ## N(&ptr, buf);                                 \
+    double meanBlock = 0.0;                                                  \
+    FOR(i, nb) meanBlock += (double)(buf[i]);                                \
+    meanBlock /= (double)nb;                                                 \
+    double m2Block = GSetDevBlock_ ## N(buf, nb, meanBlock);                 \
+    double nbNew = nbAcc + (double)nb;                                       \
+    double delta = meanBlock - *mean;                                        \
+    *mean += delta * (double)nb / nbNew;                                     \
+    *m2 += m2Block + delta * delta * nbAcc * (double)nb / nbNew;             \
+    nbAcc = nbNew;                                                           \
+  }                                                                          \
+}
+
+// Get the sum of the data of a set (integer types)
+// Input:
+//   that: the set
+// Output:
+//   Return the sum (0 if the set is empty)
+#define GSETSUM__(N, T, R)                                \
+R GSetSum_ ## N(                                          \
+  GSet const* const that) {                               \
+  T buf[GSET_BLOCK_SIZE];                                 \
+  GSetElem const* ptr = that->first;                      \
+  unsigned long sum = 0;                                  \
+  while (ptr != NULL) {                                   \
+    size_t nb = GSetGather_ ## N(&ptr, buf);              \
+    sum += GSetSumBlock_ ## N(buf, nb);                   \
+  }                                                       \
+  return (R)sum;                                          \
+}
+
+// Get the sum of the data of a set (floating point types). The sums of
+// blocks are combined with the Kahan-Babuska (Neumaier) compensated
+// summation. Once the sum is not finite the compensation is meaningless
+// (inf - inf) and the sum is returned as is.
+// Input:
+//   that: the set
+// Output:
+//   Return the sum (0 if the set is empty)
+#define GSETSUMFLOAT__(N, T)                              \
+double GSetSum_ ## N(                                     \
+  GSet const* const that) {                               \
+  T buf[GSET_BLOCK_SIZE];                                 \
+  GSetElem const* ptr = that->first;                      \
+  double sum = 0.0;                                       \
+  double comp = 0.0;                                      \
+  while (ptr != NULL) {                                   \
+    size_t nb = GSetGather_ ## N(&ptr, buf);              \
+    double sumBlock = GSetSumBlock_ ## N(buf, nb);        \
+    double t = sum + sumBlock;                            \
+    if (fabs(sum) >= fabs(sumBlock))                      \
+      comp += (sum - t) + sumBlock;                       \
+    else                                                  \
+      comp += (sumBlock - t) + sum;                       \
+    sum = t;                                              \
+  }                                                       \
+  return (isfinite(sum) ? sum + comp : sum);              \
+}
+
+// Get the minimum and maximum of the data of a set
+// Inputs:
+//   that: the set
+//    min: where to store the minimum (may be NULL)
+//    max: where to store the maximum (may be NULL)
+// Raise TryCatchExc_OutOfRange if the set is empty
+#define GSETMINMAX__(N, T)                                \
+void GSetMinMax_ ## N(                                    \
+  GSet const* const that,                                 \
+           T* const min,                                  \
+           T* const max) {                                \
+  if (that->size == 0) Raise(TryCatchExc_OutOfRange);     \
+  T buf[GSET_BLOCK_SIZE];                                 \
+  GSetElem const* ptr = that->first;                      \
+  T mn = ptr->data.N;                                     \
+  T mx = mn;                                              \
+  while (ptr != NULL) {                                   \
+    size_t nb = GSetGather_ ## N(&ptr, buf);              \
+    GSetMinMaxBlock_ ## N(buf, nb, &mn, &mx);             \
+  }                                                       \
+  if (min != NULL) *min = mn;                             \
+  if (max != NULL) *max = mx;                             \
+}
+
+// Get the mean of the data of a set
+// Input:
+//   that: the set
+// Output:
+//   Return the mean
+// Raise TryCatchExc_OutOfRange if the set is empty
+#define GSETMEAN__(N, T)                                  \
+double GSetMean_ ## N(                                    \
+  GSet const* const that) {                               \
+  double mean = 0.0;                                      \
+  double m2 = 0.0;                                        \
+  GSetMoments_ ## N(that, &mean, &m2);                    \
+  return mean;                                            \
+}
+
+// Get the (population) variance of the data of a set
+// Input:
+//   that: the set
+// Output:
+//   Return the variance
+// Raise TryCatchExc_OutOfRange if the set is empty
+#define GSETVARIANCE__(N, T)                              \
+double GSetVariance_ ## N(                                \
+  GSet const* const that) {                               \
+  double mean = 0.0;                                      \
+  double m2 = 0.0;                                        \
+  GSetMoments_ ## N(that, &mean, &m2);                    \
+  return m2 / (double)(that->size);                       \
+}
+
+#define GSETREDUCTION__(N, T, R)  \
+  GSETGATHER__(N, T)              \
+  GSETSUMBLOCK__(N, T, R)         \
+  GSETMINMAXBLOCK__(N, T)         \
+  GSETDEVBLOCK__(N, T)            \
+  GSETMOMENTS__(N, T)             \
+  GSETMINMAX__(N, T)              \
+  GSETMEAN__(N, T)                \
+  GSETVARIANCE__(N, T)
+
+GSETREDUCTION__(Int, int, unsigned long)
+GSETREDUCTION__(UInt, unsigned int, unsigned long)
+GSETREDUCTION__(Long, long, unsigned long)
+GSETREDUCTION__(ULong, unsigned long, unsigned long)
+GSETREDUCTION__(Float, float, double)
+GSETREDUCTION__(Double, double, double)
+GSETSUM__(Int, int, long)
+GSETSUM__(UInt, unsigned int, unsigned long)
+GSETSUM__(Long, long, long)
+GSETSUM__(ULong, unsigned long, unsigned long)
+GSETSUMFLOAT__(Float, float)
+GSETSUMFLOAT__(Double, double)
+
+// Attach a window aggregate to a numeric set
+// Input:
+//   that: the set
+#define GSETATTACHWINDOW__(N, T)                \
+void GSetAttachWindow_ ## N(                    \
+  GSet* const that) {                           \
+  GSetWindowAttach(that, GSetKeyType_ ## N);    \
+}
+
+GSETATTACHWINDOW__(Int, int)
+GSETATTACHWINDOW__(UInt, unsigned int)
+GSETATTACHWINDOW__(Long, long)
+GSETATTACHWINDOW__(ULong, unsigned long)
+GSETATTACHWINDOW__(Float, float)
+GSETATTACHWINDOW__(Double, double)
+
+// Detach and free the window aggregate of a set, if any
+// Input:
+//   that: the set
+void GSetDetachWindow_(
+  GSet* const that) {
+
+  GSetWindowFree(&(that->window));
+
+}
+
+// Check if a set has a window aggregate
+// Input:
+//   that: the set
+// Output:
+//   Return true if the set has a window aggregate, false else
+bool GSetHasWindow_(
+  GSet const* const that) {
+
+  return (that->window != NULL);
+
+}
+
+// Get the sum of the data of a set from its window aggregate, or as
+// GSetSum if it has none
+// Input:
+//   that: the set
+// Output:
+//   Return the sum (0 if the set is empty)
+#define GSETWINDOWSUM__(N, T, R, Sum)                      \
+R GSetWindowSum_ ## N(                                     \
+  GSet const* const that) {                                \
+  GSetWindow const* window = that->window;                 \
+  if (window == NULL || window->type != GSetKeyType_ ## N) \
+    return GSetSum_ ## N(that);                            \
+  GSetWindowUpdate(that);                                  \
+  return Sum;                                              \
+}
+
+GSETWINDOWSUM__(Int, int, long, (long)(window->sum.ul))
+GSETWINDOWSUM__(UInt, unsigned int, unsigned long, window->sum.ul)
+GSETWINDOWSUM__(Long, long, long, (long)(window->sum.ul))
+GSETWINDOWSUM__(ULong, unsigned long, unsigned long, window->sum.ul)
+GSETWINDOWSUM__(Float, float, double, GSetWindowSumFloat(window))
+GSETWINDOWSUM__(Double, double, double, GSetWindowSumFloat(window))
+
+// Get the minimum or maximum of the data of a set from its window
+// aggregate, or as GSetMinMax if it has none
+// Input:
+//   that: the set
+// Output:
+//   Return the minimum or maximum
+// Raise TryCatchExc_OutOfRange if the set is empty
+#define GSETWINDOWMINMAX__(N, T, Fun, Deque, Min, Max)       \
+T GSetWindow ## Fun ## _ ## N(                              \
+  GSet const* const that) {                                 \
+  if (that->size == 0) Raise(TryCatchExc_OutOfRange);       \
+  GSetWindow const* window = that->window;                  \
+  if (window == NULL || window->type != GSetKeyType_ ## N) { \
+    T data;                                                 \
+    GSetMinMax_ ## N(that, Min, Max);                       \
+    return data;                                            \
+  }                                                         \
+  GSetWindowUpdate(that);                                   \
+  return window->Deque.elems[window->Deque.head]->data.N;   \
+}
+
+// Get the mean of the data of a set from its window aggregate, or as
+// GSetMean if it has none
+// Input:
+//   that: the set
+// Output:
+//   Return the mean
+// Raise TryCatchExc_OutOfRange if the set is empty
+#define GSETWINDOWMEAN__(N, T)                                \
+double GSetWindowMean_ ## N(                                  \
+  GSet const* const that) {                                   \
+  if (that->size == 0) Raise(TryCatchExc_OutOfRange);         \
+  GSetWindow const* window = that->window;                    \
+  if (window == NULL || window->type != GSetKeyType_ ## N)    \
+    return GSetMean_ ## N(that);                              \
+  return                                                      \
+    (double)GSetWindowSum_ ## N(that) / (double)(that->size); \
+}
+
+#define GSETWINDOW__(N, T)                          \
+  GSETWINDOWMINMAX__(N, T, Min, min, &data, NULL)   \
+  GSETWINDOWMINMAX__(N, T, Max, max, NULL, &data)   \
+  GSETWINDOWMEAN__(N, T)
+
+GSETWINDOW__(Int, int)
+GSETWINDOW__(UInt, unsigned int)
+GSETWINDOW__(Long, long)
+GSETWINDOW__(ULong, unsigned long)
+GSETWINDOW__(Float, float)
+GSETWINDOW__(Double, double)
+
+// Switch a set to concurrent-read mode: reader threads can iterate on the
+// set without lock while one writer thread adds and removes data. The
+// removed elements are freed only once no reader can access them anymore
+// (epoch-based reclamation). Readers only write their own slot, on its own
+// cache line, when entering and leaving a read section, so they don't
+// contend with each other. In this mode the writer sets the links between
+// elements, and the head and tail of the set, with release stores
+// (GSetEpochLink), and the iterators follow them with acquire loads
+// (GSetIterLink), so readers see new elements only once they are
+// initialised. An iterator uses these loads if the set was in this mode
+// when it was last reset, hence readers reset their iterators in their
+// read sections. A bounded set with the overwrite policy retires the
+// element removed from its other end instead of recycling it. Readers see
+// the set as it is being modified, not as a snapshot.
+// Input:
+//   that: the set
+void GSetAttachEpoch_(
+  GSet* const that) {
+
+  // If the set is already in concurrent-read mode, nothing to do
+  if (that->epoch != NULL) return;
+
+  // Allocate memory, aligned on the cache lines
+  GSetEpoch* epoch = aligned_alloc(GSET_CACHE_LINE, sizeof(GSetEpoch));
+  if (epoch == NULL) Raise(TryCatchExc_MallocFailed);
+
+  // Initialise the epoch-based reclamation
+  atomic_init(&(epoch->global), 1);
+  for (size_t i = 0; i < 3; ++i)
+    epoch->bags[i] = (GSetEpochBag){ .elems = NULL, .nb = 0, .size = 0 };
+  epoch->nbRetire = 0;
+  for (size_t i = 0; i < GSET_EPOCH_NB_READER; ++i)
+    atomic_init(&(epoch->readers[i].epoch), 0);
+  atomic_thread_fence(memory_order_release);
+  that->epoch = epoch;
+
+}
+
+// Switch a set back from concurrent-read mode, freeing the removed
+// elements not freed yet. No reader must be accessing the set.
+// Input:
+//   that: the set
+void GSetDetachEpoch_(
+  GSet* const that) {
+
+  GSetEpochFree(&(that->epoch));
+
+}
+
+// Check if a set is in concurrent-read mode
+// Input:
+//   that: the set
+// Output:
+//   Return true if the set is in concurrent-read mode, false else
+bool GSetHasEpoch_(
+  GSet const* const that) {
+
+  return (that->epoch != NULL);
+
+}
+
+// Enter a read section on a set in concurrent-read mode. The elements the
+// reader accesses until it leaves the section are not freed. The reader
+// must reset its iterators in the section.
+// Input:
+//   that: the set
+// Output:
+//   Return the slot of the reader, to be given to GSetEpochLeave.
+size_t GSetEpochEnter_(
+  GSet* const that) {
+
+  // Starting from the slot last used by the thread, announce the current
+  // epoch in the first free slot. If all the slots are used, wait for a
+  // reader to leave
+  static _Thread_local size_t hint = 0;
+  GSetEpoch* epoch = that->epoch;
+  size_t slot = hint;
+  while (true) {
+
+    uint64_t global = atomic_load(&(epoch->global));
+    uint64_t unused = 0;
+    if (atomic_compare_exchange_strong(
+      &(epoch->readers[slot].epoch), &unused, global)) {
+
+      hint = slot;
+      return slot;
+
+    }
+
+    slot = (slot + 1) % GSET_EPOCH_NB_READER;
+
+  }
+
+}
+
+// Leave a read section on a set in concurrent-read mode
+// Inputs:
+//   that: the set
+//   slot: the slot returned by GSetEpochEnter
+void GSetEpochLeave_(
+  GSet* const that,
+  size_t const slot) {
+
+  atomic_store_explicit(
+    &(that->epoch->readers[slot].epoch), 0, memory_order_release);
+
+}
+
+// Free the removed elements of a set in concurrent-read mode which can't
+// be accessed by the readers anymore. Must be called by the writer thread.
+// Input:
+//   that: the set
+// Output:
+//   Return the number of removed elements still waiting to be freed.
+size_t GSetEpochReclaim_(
+  GSet* const that) {
+
+  GSetEpoch* epoch = that->epoch;
+  if (epoch == NULL) return 0;
+
+  // Advancing twice frees all the retired elements if there is no reader
+  // in a read section
+  if (GSetEpochAdvance(epoch)) (void)GSetEpochAdvance(epoch);
+  return epoch->bags[0].nb + epoch->bags[1].nb + epoch->bags[2].nb;
+
+}
+
+// Allocate memory for a new GSetIter
+// Input:
+//   type: the type of iteration
+// Output:
+//   Return the new GSetIter.
+GSetIter* GSetIterAlloc(
+  GSetIterType const type) {
+
+  // Allocate memory for the GSet
+  GSetIter* that = NULL;
+  MALLOC(that, sizeof(GSetIter));
+
+  // Create the GSet
+  *that = GSetIterCreate(type);
+
+  // Return the GSet
+  return that;
+
+}
+
+// Free the memory used by a GSetIter.
+// Input:
+//   that: the GSetIter to be freed
+void GSetIterFree_(
+  GSetIter** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Free the memory
+  free(*that);
+  *that = NULL;
+
+}
+
+// Get the current data from a set
+// Input:
+//   that: the iterator
+// Output:
+//   Return the current data
+#define GSETITERGET__(N, T)                               \
+T GSetIterGet_ ## N(                                      \
+  GSetIter const* const that) {                           \
+  if (that->elem == NULL) Raise(TryCatchExc_OutOfRange);  \
+  T data = that->elem->data.N;                            \
+  return data;                                            \
+}
+
+GSETITERGET__(Char, char)
+GSETITERGET__(UChar, unsigned char)
+GSETITERGET__(Int, int)
+GSETITERGET__(UInt, unsigned int)
+GSETITERGET__(Long, long)
+GSETITERGET__(ULong, unsigned long)
+GSETITERGET__(Float, float)
+GSETITERGET__(Double, double)
+GSETITERGET__(Ptr, void*)
+
+// Pick the current data from a set
+// Input:
+//   that: the iterator
+//   set: the associated set
+// Output:
+//   Remove the current data from the set and return it
+#define GSETITERPICK__(N, T)                                                 \
+T GSetIterPick_ ## N(                                                        \
+  GSetIter* const that,                                                      \
+  GSet* const set) {                                                         \
+  if (that->elem == NULL) Raise(TryCatchExc_OutOfRange);                     \
+  T data = that->elem->data.N;                                               \
+  GSetElem* elem = that->elem;                                               \
+  if (GSetIterNext_(that) == false)                                          \
+    if (GSetIterPrev_(that) == false)                                        \
+      that->elem = NULL;                                                     \
+  GSetRemoveElem(set, elem);                                                 \
+  GSetElemRelease(set, &elem);                                               \
+  return data;                                                               \
+}
+
+GSETITERPICK__(Char, char)
+GSETITERPICK__(UChar, unsigned char)
+GSETITERPICK__(Int, int)
+GSETITERPICK__(UInt, unsigned int)
+GSETITERPICK__(Long, long)
+GSETITERPICK__(ULong, unsigned long)
+GSETITERPICK__(Float, float)
+GSETITERPICK__(Double, double)
+GSETITERPICK__(Ptr, void*)
+
+// Get the current data from a set, without raising exception
+// Inputs:
+//   that: the iterator
+//   data: receives the data
+// Output:
+//   If the iterator is on an element, copy its data into 'data' and return
+//   true. Else, return false.
+#define GSETITERTRYGET__(N, T)                 \
+bool GSetIterTryGet_ ## N(                     \
+  GSetIter const* const that,                  \
+               T* const data) {                \
+  if (that->elem == NULL) return false;        \
+  *data = that->elem->data.N;                  \
+  return true;                                 \
+}
+
+GSETITERTRYGET__(Char, char)
+GSETITERTRYGET__(UChar, unsigned char)
+GSETITERTRYGET__(Int, int)
+GSETITERTRYGET__(UInt, unsigned int)
+GSETITERTRYGET__(Long, long)
+GSETITERTRYGET__(ULong, unsigned long)
+GSETITERTRYGET__(Float, float)
+GSETITERTRYGET__(Double, double)
+GSETITERTRYGET__(Ptr, void*)
+
+// Pick the current data from a set, without raising exception
+// Inputs:
+//   that: the iterator
+//    set: the associated set
+//   data: receives the data (may be NULL)
+// Output:
+//   If the iterator is on an element, remove it from the set, copy its data
+//   into 'data' and return true. Else, return false.
+#define GSETITERTRYPICK__(N, T)                \
+bool GSetIterTryPick_ ## N(                    \
+  GSetIter* const that,                        \
+      GSet* const set,                         \
+         T* const data) {                      \
+  if (that->elem == NULL) return false;        \
+  GSetElem* elem = that->elem;                 \
+  if (data != NULL) *data = elem->data.N;      \
+  if (GSetIterNext_(that) == false)            \
+    if (GSetIterPrev_(that) == false)          \
+      that->elem = NULL;                       \
+  GSetRemoveElem(set, elem);                   \
+  GSetElemRelease(set, &elem);                 \
+  return true;                                 \
+}
+
+GSETITERTRYPICK__(Char, char)
+GSETITERTRYPICK__(UChar, unsigned char)
+GSETITERTRYPICK__(Int, int)
+GSETITERTRYPICK__(UInt, unsigned int)
+GSETITERTRYPICK__(Long, long)
+GSETITERTRYPICK__(ULong, unsigned long)
+GSETITERTRYPICK__(Float, float)
+GSETITERTRYPICK__(Double, double)
+GSETITERTRYPICK__(Ptr, void*)
+
+// Reset the iterator to its first element
+// Input:
+//   that: the iterator
+//    set: the associated set
+void GSetIterReset_(
+    GSetIter* const that,
+  GSet const* const set) {
+
+  // In concurrent-read mode, the links are read with acquire loads
+  that->isConcurrent = (set->epoch != NULL);
+
+  // Switch according to the type of iterator
+  switch (that->type) {
+
+    case GSetIterForward:
+      that->elem = GSetIterLink(that, &(set->first));
+      break;
+
+    case GSetIterBackward:
+      that->elem = GSetIterLink(that, &(set->last));
+      break;
+
+    default:
+      Raise(TryCatchExc_NotYetImplemented);
+
+  }
+
+  // Ensure the current element matches the current filter if any
+  if (that->elem != NULL && that->filter.fun != NULL) {
+
+    bool filtered =
+      that->filter.fun(
+        &(that->elem->data),
+        that->filter.params);
+    while (
+      that->elem != NULL &&
+      filtered == false) {
+
+      if (GSetIterNext_(that) == false)
+        that->elem = NULL;
+      else
+        filtered =
+          that->filter.fun(
+            &(that->elem->data),
+            that->filter.params);
+
+    }
+
+  }
+
+}
+
+// Check if the iterator is ready
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator is on an element of its set, false else
+//   (either it's because the set is empty, or the iterator's filter has
+//   no matching element in the set)
+bool GSetIterIsReady_(
+    GSetIter* const that) {
+
+  if (that->elem == NULL)
+    return false;
+  else
+    return true;
+
+}
+
+// Move the iterator to the next element
+// Input:
+//   that: the iterator
+// Output:
+// Return true if the iterator could move to the next element, else false
+bool GSetIterNext_(
+  GSetIter* const that) {
+
+  if (that->elem == NULL) return false;
+
+  // Variable to memorise the returned flag
+  bool flag = false;
+
+  // Switch according to the type of iterator
+  switch (that->type) {
+
+    case GSetIterForward: {
+
+      // Each link is read once, as a writer may modify it if the set is in
+      // concurrent-read mode
+      GSetElem* nextElem = GSetIterLink(that, &(that->elem->next));
+      if (nextElem != NULL && that->filter.fun != NULL) {
+
+        bool filtered =
+          that->filter.fun(
+            &(nextElem->data),
+            that->filter.params);
+        while (
+          nextElem != NULL &&
+          filtered == false) {
+
+          nextElem = GSetIterLink(that, &(nextElem->next));
+          if (nextElem != NULL)
+            filtered =
+              that->filter.fun(
+                &(nextElem->data),
+                that->filter.params);
+
+        }
+
+      }
+
+      if (nextElem != NULL) {
+
+        that->elem = nextElem;
+        flag = true;
+
+      }
+
+      break;
+
+    }
+
+    case GSetIterBackward: {
+
+      // Each link is read once, as a writer may modify it if the set is in
+      // concurrent-read mode
+      GSetElem* prevElem = GSetIterLink(that, &(that->elem->prev));
+      if (prevElem != NULL && that->filter.fun != NULL) {
+
+        bool filtered =
+          that->filter.fun(
+            &(prevElem->data),
+            that->filter.params);
+        while (
+          prevElem != NULL &&
+          filtered == false) {
+
+          prevElem = GSetIterLink(that, &(prevElem->prev));
+          if (prevElem != NULL)
+            filtered =
+              that->filter.fun(
+                &(prevElem->data),
+                that->filter.params);
+
+        }
+
+      }
+
+      if (prevElem != NULL) {
+
+        that->elem = prevElem;
+        flag = true;
+
+      }
+
+      break;
+
+    }
+
+    default:
+      Raise(TryCatchExc_NotYetImplemented);
+
+  }
+
+  // Return the flag
+  return flag;
+
+}
+
+// Move the iterator to the previous element
+// Input:
+//   that: the iterator
+// Output:
+// Return true if the iterator could move to the previous element, else false
+bool GSetIterPrev_(
+  GSetIter* const that) {
+
+  if (that->elem == NULL) return false;
+
+  // Variable to memorise the returned flag
+  bool flag = false;
+
+  // Switch according to the type of iterator
+  switch (that->type) {
+
+    case GSetIterForward: {
+
+      // Each link is read once, as a writer may modify it if the set is in
+      // concurrent-read mode
+      GSetElem* prevElem = GSetIterLink(that, &(that->elem->prev));
+      if (prevElem != NULL && that->filter.fun != NULL) {
+
+        bool filtered =
+          that->filter.fun(
+            &(prevElem->data),
+            that->filter.params);
+        while (
+          prevElem != NULL &&
+          filtered == false) {
+
+          prevElem = GSetIterLink(that, &(prevElem->prev));
+          if (prevElem != NULL)
+            filtered =
+              that->filter.fun(
+                &(prevElem->data),
+                that->filter.params);
+
+        }
+
+      }
+
+      if (prevElem != NULL) {
+
+        that->elem = prevElem;
+        flag = true;
+
+      }
+
+      break;
+
+    }
+
+    case GSetIterBackward: {
+
+      // Each link is read once, as a writer may modify it if the set is in
+      // concurrent-read mode
+      GSetElem* nextElem = GSetIterLink(that, &(that->elem->next));
+      if (nextElem != NULL && that->filter.fun != NULL) {
+
+        bool filtered =
+          that->filter.fun(
+            &(nextElem->data),
+            that->filter.params);
+        while (
+          nextElem != NULL &&
+          filtered == false) {
+
+          nextElem = GSetIterLink(that, &(nextElem->next));
+          if (nextElem != NULL)
+            filtered =
+              that->filter.fun(
+                &(nextElem->data),
+                that->filter.params);
+
+        }
+
+      }
+
+      if (nextElem != NULL) {
+
+        that->elem = nextElem;
+        flag = true;
+
+      }
+
+      break;
+
+    }
+
+    default:
+      Raise(TryCatchExc_NotYetImplemented);
+
+  }
+
+  // Return the flag
+  return flag;
+
+}
+
+// Check if an iterator is on its first element
+// Input:
+//   that: the iterator
+// Output:
+// Return true if the iterator is on its first element, else false
+bool GSetIterIsFirst_(
+  GSetIter* const that) {
+
+  if (that->elem == NULL) Raise(TryCatchExc_OutOfRange);
+
+  // Try to go the the previous element with a clone of the iterator and
+  // return true if it couldn't move
+  GSetIter clone = *that;
+  return (GSetIterPrev_(&clone) == false);
+
+}
+
+// Check if an iterator is on its last element
+// Input:
+//   that: the iterator
+// Output:
+// Return true if the iterator is on its last element, else false
+bool GSetIterIsLast_(
+  GSetIter* const that) {
+
+  if (that->elem == NULL) Raise(TryCatchExc_OutOfRange);
+
+  // Try to go the the previous element with a clone of the iterator and
+  // return true if it couldn't move
+  GSetIter clone = *that;
+  return (GSetIterNext_(&clone) == false);
+
+}
+
+// Clone an iterator
+// Input:
+//   that: the iterator
+// Output:
+//   Return a clone of the iterator
+GSetIter* GSetIterClone_(
+  GSetIter const* const that) {
+
+  // Allocate memory for the clone
+  GSetIter* clone = GSetIterAlloc(that->type);
+
+  // Copy the iterator
+  *clone = *that;
+
+  // Return the clone
+  return clone;
+
+}
+
+// Set the type of an iterator
+// Input:
+//   that: the iterator
+//   type: the type
+void GSetIterSetType_(
+     GSetIter* const that,
+  GSetIterType const type) {
+
+  // Set the type
+  that->type = type;
+
+}
+
+// Get the type of an iterator
+// Input:
+//   that: the iterator
+// Return the type of the iterator
+GSetIterType GSetIterGetType_(
+  GSetIter const* const that) {
+
+  // Return the type
+  return that->type;
+
+}
+
+// Set the filter of an iterator
+// Inputs:
+//     that: the iterator
+//      fun: the filter's function
+//   params: the parameters of the filter's function
+void GSetIterSetFilter_(
+    GSetIter* const that,
+  GSetIterFilterFun fun,
+              void* params) {
+
+  that->filter.fun = fun;
+  that->filter.params = params;
+
+}
+
+// Get the filter's function parameters
+// Input:
+//     that: the iterator
+// Output:
+//   Return the parameters of the filter's function
+void* GSetIterGetFilterParam_(
+  GSetIter* const that) {
+
+  return that->filter.params;
+
+}
+
+// Count the number of elements enumerated by an iterator
+// Inputs:
+//   that: the iterator
+//    set: the set
+// Output:
+//   Return the number of elements
+size_t GSetIterCount_(
+  GSetIter const* const that,
+      GSet const* const set) {
+
+  // Create a clone to leave the iterator unchanged
+  GSetIter clone = *that;
+
+  // Variable to memorise the number of elements
+  size_t nb = 0;
+
+  // Count the elements
+  GSetIterReset_(
+    &clone,
+    set);
+  if (clone.elem != NULL) {
+
+    nb = 1;
+    while (GSetIterNext_(&clone) == true) ++nb;
+
+  }
+
+  // Return the number of element
+  return nb;
+
+}
+
+// Apply a function on each element enumerated by an iterator, using several
+// threads.
+// Inputs:
+//       that: the iterator
+//        set: the associated set
+//        fun: the function applied on each element
+//     params: the parameters of fun and reduce
+//   nbThread: the number of threads (0 is treated as 1)
+//       accs: array of nbThread accumulators of sizeAcc bytes (may be NULL)
+//    sizeAcc: the size in bytes of one accumulator
+//     reduce: the function combining the accumulators (may be NULL)
+void GSetIterParallelForEach_(
+   GSetIter const* const that,
+       GSet const* const set,
+           GSetParallelFun fun,
+                     void* params,
+              size_t const nbThread,
+                     void* accs,
+              size_t const sizeAcc,
+             GSetReduceFun reduce) {
+
+  // Get the number of enumerated elements, without filter it's simply the
+  // size of the set and the elements are traversed only once
+  size_t nbElem =
+    (that->filter.fun == NULL ? set->size : GSetIterCount_(that, set));
+  if (nbElem == 0) return;
+
+  // Get the number of ranges, no more than the number of elements
+  size_t nbRange = (nbThread == 0 ? 1 : nbThread);
+  if (nbRange > nbElem) nbRange = nbElem;
+
+  // Allocate memory for the ranges
+  GSetParallelRange* ranges = NULL;
+  MALLOC(ranges, sizeof(GSetParallelRange) * nbRange);
+
+  // Split the enumerated elements into ranges of balanced sizes with one
+  // pass on the elements
+  GSetIter iter = *that;
+  GSetIterReset_(&iter, set);
+  FOR(iRange, nbRange) {
+
+    ranges[iRange] = (GSetParallelRange) {
+
+      .iter = iter,
+      .nb = nbElem / nbRange + (iRange < nbElem % nbRange ? 1 : 0),
+      .fun = fun,
+      .params = params,
+      .acc = (accs != NULL ? (char*)accs + iRange * sizeAcc : NULL),
+      .next = NULL,
+      .nbPending = NULL,
+
+    };
+    if (iRange < nbRange - 1)
+      FOR(iElem, ranges[iRange].nb) GSetIterNext_(&iter);
+
+  }
+
+  // Process the ranges, the first one in the calling thread and the other
+  // ones in the threads of the pool
+  if (nbRange == 1) GSetParallelRangeRun(ranges);
+  else GSetPoolRun(ranges, nbRange);
+
+  // Combine the accumulators
+  if (accs != NULL && reduce != NULL)
+    for (size_t iRange = 1; iRange < nbRange; ++iRange)
+      reduce(accs, ranges[iRange].acc, params);
+
+  // Free memory
+  free(ranges);
+
+}
+
+// Apply a function on each element of a set, using several threads.
+// Inputs:
+//        set: the set
+//        fun: the function applied on each element
+//     params: the parameters of fun and reduce
+//   nbThread: the number of threads (0 is treated as 1)
+//       accs: array of nbThread accumulators of sizeAcc bytes (may be NULL)
+//    sizeAcc: the size in bytes of one accumulator
+//     reduce: the function combining the accumulators (may be NULL)
+void GSetParallelForEach_(
+  GSet const* const set,
+      GSetParallelFun fun,
+                void* params,
+         size_t const nbThread,
+                void* accs,
+         size_t const sizeAcc,
+        GSetReduceFun reduce) {
+
+  GSetIter iter = GSetIterCreate(GSetIterForward);
+  GSetIterParallelForEach_(
+    &iter,
+    set,
+    fun,
+    params,
+    nbThread,
+    accs,
+    sizeAcc,
+    reduce);
+
+}
+
+// Allocate memory for a new concurrent queue. Data can be added to the
+// queue by several threads simultaneously, without lock, while one thread
+// pops them.
+// Output:
+//   Return the new GSetConc.
+GSetConc* GSetConcAlloc(
+  void) {
+
+  // Allocate memory, aligned on the cache lines
+  GSetConc* that = aligned_alloc(GSET_CACHE_LINE, sizeof(GSetConc));
+  if (that == NULL) Raise(TryCatchExc_MallocFailed);
+
+  // Initialise the queue with only the stub node
+  atomic_init(&(that->stub.next), NULL);
+  atomic_init(&(that->last), &(that->stub));
+  that->first = &(that->stub);
+  that->releaseSlab = NULL;
+  that->releaseFirst = NULL;
+  that->releaseLast = NULL;
+  that->nbRelease = 0;
+
+  // Return the new queue
+  return that;
+
+}
+
+// Free the memory used by a concurrent queue and the data still in it. No
+// thread must be using the queue.
+// Input:
+//   that: the GSetConc to be freed
+void GSetConcFree_(
+  GSetConc** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Release the nodes still in the queue
+  GSetConcNode* node = GSetConcUnlink(*that);
+  while (node != NULL) {
+
+    GSetConcRelease(*that, node);
+    node = GSetConcUnlink(*that);
+
+  }
+
+  if ((*that)->releaseSlab != NULL) {
+
+    GSetSlabFree(
+      (*that)->releaseSlab, (*that)->releaseFirst, (*that)->releaseLast,
+      (*that)->nbRelease);
+
+  }
+
+  // Free memory
+  free(*that);
+  *that = NULL;
+
+}
+
+// Add data at the tail of a concurrent queue. Can be called by several
+// threads simultaneously.
+// Inputs:
+//   that: the queue
+//   data: the data
+#define GSETCONCADD__(N, T)                   \
+void GSetConcAdd_ ## N(                       \
+  GSetConc* const that,                       \
+          T const data) {                     \
+  GSetConcNode* node = GSetConcNodeAlloc();   \
+  node->data.N = data;                        \
+  GSetConcLink(that, node);                   \
+}
+
+GSETCONCADD__(Char, char)
+GSETCONCADD__(UChar, unsigned char)
+GSETCONCADD__(Int, int)
+GSETCONCADD__(UInt, unsigned int)
+GSETCONCADD__(Long, long)
+GSETCONCADD__(ULong, unsigned long)
+GSETCONCADD__(Float, float)
+GSETCONCADD__(Double, double)
+GSETCONCADD__(Ptr, void*)
+
+// Pop data from the head of a concurrent queue, without blocking. Must be
+// called by one thread at a time.
+// Inputs:
+//   that: the queue
+//   data: receives the data (may be NULL)
+// Output:
+//   If a data is available, remove it from the queue, copy it into 'data'
+//   and return true. Else, return false. False may be returned while the
+//   queue is not empty if a thread is in the middle of adding a data.
+#define GSETCONCPOP__(N, T)                   \
+bool GSetConcPop_ ## N(                       \
+  GSetConc* const that,                       \
+         T* const data) {                     \
+  GSetConcNode* node = GSetConcUnlink(that);  \
+  if (node == NULL) return false;             \
+  if (data != NULL) *data = node->data.N;     \
+  GSetConcRelease(that, node);                \
+  return true;                                \
+}
+
+GSETCONCPOP__(Char, char)
+GSETCONCPOP__(UChar, unsigned char)
+GSETCONCPOP__(Int, int)
+GSETCONCPOP__(UInt, unsigned int)
+GSETCONCPOP__(Long, long)
+GSETCONCPOP__(ULong, unsigned long)
+GSETCONCPOP__(Float, float)
+GSETCONCPOP__(Double, double)
+GSETCONCPOP__(Ptr, void*)
+
+// Allocate memory for a new ring queue for one producer thread and one
+// consumer thread. Data are stored in an array of fixed capacity, and
+// added and popped without lock.
+// Input:
+//   capacity: the minimum number of data the queue can hold, rounded up
+//             to a power of 2, greater than 0
+// Output:
+//   Return the new GSetSpsc.
+GSetSpsc* GSetSpscAlloc(
+  size_t const capacity) {
+
+  // Get the number of slots
+  if (capacity == 0 || capacity > (SIZE_MAX >> 1) / sizeof(union GSetElemData))
+    Raise(TryCatchExc_OutOfRange);
+  size_t nbSlot = 1;
+  while (nbSlot < capacity) nbSlot <<= 1;
+
+  // Allocate memory, aligned on the cache lines
+  GSetSpsc* that = aligned_alloc(GSET_CACHE_LINE, sizeof(GSetSpsc));
+  if (that == NULL) Raise(TryCatchExc_MallocFailed);
+  size_t sizeSlots = nbSlot * sizeof(union GSetElemData);
+  if (sizeSlots % GSET_CACHE_LINE != 0)
+    sizeSlots += GSET_CACHE_LINE - sizeSlots % GSET_CACHE_LINE;
+  that->slots = aligned_alloc(GSET_CACHE_LINE, sizeSlots);
+  if (that->slots == NULL) {
+
+    free(that);
+    Raise(TryCatchExc_MallocFailed);
+
+  }
+
+  // Initialise the queue
+  atomic_init(&(that->tail), 0);
+  atomic_init(&(that->head), 0);
+  that->headCache = 0;
+  that->tailCache = 0;
+  that->mask = nbSlot - 1;
+
+  // Return the new queue
+  return that;
+
+}
+
+// Free the memory used by a ring queue. No thread must be using the queue.
+// Input:
+//   that: the GSetSpsc to be freed
+void GSetSpscFree_(
+  GSetSpsc** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Free memory
+  free((*that)->slots);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Get the number of data a ring queue can hold
+// Input:
+//   that: the queue
+// Output:
+//   Return the capacity of the queue.
+size_t GSetSpscGetCapacity_(
+  GSetSpsc const* const that) {
+
+  return that->mask + 1;
+
+}
+
+// Get the number of data in a ring queue
+// Input:
+//   that: the queue
+// Output:
+//   Return the number of data. If the producer or the consumer is using
+//   the queue simultaneously, the result may be already outdated.
+size_t GSetSpscGetSize_(
+  GSetSpsc const* const that) {
+
+  // Read the head first, the tail being read after can't be behind it
+  size_t head = atomic_load_explicit(
+    (atomic_size_t*)&(that->head), memory_order_acquire);
+  size_t tail = atomic_load_explicit(
+    (atomic_size_t*)&(that->tail), memory_order_acquire);
+  return tail - head;
+
+}
+
+// Add an array of data at the tail of a ring queue, as many as the free
+// room in the queue allows. Must be called by the producer thread only.
+// Inputs:
+//   that: the queue
+//     nb: the number of data in the array
+//    arr: the array of data
+// Output:
+//   Return the number of data added, from the beginning of the array.
+#define GSETSPSCADDARR__(N, T)                                   \
+size_t GSetSpscAddArr_ ## N(                                     \
+  GSetSpsc* const that,                                          \
+     size_t const nb,                                            \
+   T const* const arr) {                                         \
+  size_t nbAdd = GSetSpscReserve(that, nb);                      \
+  size_t tail =                                                  \
+    atomic_load_explicit(&(that->tail), memory_order_relaxed);   \
+  for (size_t i = 0; i < nbAdd; ++i)                             \
+    that->slots[(tail + i) & that->mask].N = arr[i];             \
+  atomic_store_explicit(                                         \
+    &(that->tail), tail + nbAdd, memory_order_release);          \
+  return nbAdd;                                                  \
+}
+
+GSETSPSCADDARR__(Char, char)
+GSETSPSCADDARR__(UChar, unsigned char)
+GSETSPSCADDARR__(Int, int)
+GSETSPSCADDARR__(UInt, unsigned int)
+GSETSPSCADDARR__(Long, long)
+GSETSPSCADDARR__(ULong, unsigned long)
+GSETSPSCADDARR__(Float, float)
+GSETSPSCADDARR__(Double, double)
+GSETSPSCADDARR__(Ptr, void*)
+
+// Add data at the tail of a ring queue. Must be called by the producer
+// thread only.
+// Inputs:
+//   that: the queue
+//   data: the data
+// Output:
+//   Return true if the data was added, or false if the queue is full.
+#define GSETSPSCADD__(N, T)                              \
+bool GSetSpscAdd_ ## N(                                  \
+  GSetSpsc* const that,                                  \
+          T const data) {                                \
+  return (GSetSpscAddArr_ ## N(that, 1, &data) == 1);    \
+}
+
+GSETSPSCADD__(Char, char)
+GSETSPSCADD__(UChar, unsigned char)
+GSETSPSCADD__(Int, int)
+GSETSPSCADD__(UInt, unsigned int)
+GSETSPSCADD__(Long, long)
+GSETSPSCADD__(ULong, unsigned long)
+GSETSPSCADD__(Float, float)
+GSETSPSCADD__(Double, double)
+GSETSPSCADD__(Ptr, void*)
+
+// Pop data from the head of a ring queue into an array, as many as
+// available up to the size of the array, without blocking. Must be called
+// by the consumer thread only.
+// Inputs:
+//   that: the queue
+//     nb: the size of the array
+//    arr: receives the data (may be NULL)
+// Output:
+//   Return the number of data popped.
+#define GSETSPSCPOPARR__(N, T)                                   \
+size_t GSetSpscPopArr_ ## N(                                     \
+  GSetSpsc* const that,                                          \
+     size_t const nb,                                            \
+         T* const arr) {                                         \
+  size_t nbPop = GSetSpscAvailable(that, nb);                    \
+  size_t head =                                                  \
+    atomic_load_explicit(&(that->head), memory_order_relaxed);   \
+  if (arr != NULL)                                               \
+    for (size_t i = 0; i < nbPop; ++i)                           \
+      arr[i] = that->slots[(head + i) & that->mask].N;           \
+  atomic_store_explicit(                                         \
+    &(that->head), head + nbPop, memory_order_release);          \
+  return nbPop;                                                  \
+}
+
+GSETSPSCPOPARR__(Char, char)
+GSETSPSCPOPARR__(UChar, unsigned char)
+GSETSPSCPOPARR__(Int, int)
+GSETSPSCPOPARR__(UInt, unsigned int)
+GSETSPSCPOPARR__(Long, long)
+GSETSPSCPOPARR__(ULong, unsigned long)
+GSETSPSCPOPARR__(Float, float)
+GSETSPSCPOPARR__(Double, double)
+GSETSPSCPOPARR__(Ptr, void*)
+
+// Pop data from the head of a ring queue, without blocking. Must be
+// called by the consumer thread only.
+// Inputs:
+//   that: the queue
+//   data: receives the data (may be NULL)
+// Output:
+//   If the queue is not empty, remove the data at its head, copy it into
+//   'data' and return true. Else, return false.
+#define GSETSPSCPOP__(N, T)                              \
+bool GSetSpscPop_ ## N(                                  \
+  GSetSpsc* const that,                                  \
+         T* const data) {                                \
+  return (GSetSpscPopArr_ ## N(that, 1, data) == 1);     \
+}
+
+GSETSPSCPOP__(Char, char)
+GSETSPSCPOP__(UChar, unsigned char)
+GSETSPSCPOP__(Int, int)
+GSETSPSCPOP__(UInt, unsigned int)
+GSETSPSCPOP__(Long, long)
+GSETSPSCPOP__(ULong, unsigned long)
+GSETSPSCPOP__(Float, float)
+GSETSPSCPOP__(Double, double)
+GSETSPSCPOP__(Ptr, void*)
+
+// Allocate memory for a new work-stealing deque of pointers. The owner
+// thread of the deque pushes and pops data at its head, while other
+// threads steal data at its tail.
+// Output:
+//   Return the new GSetDeque.
+GSetDeque* GSetDequeAlloc(
+  void) {
+
+  // Allocate memory, aligned on the cache lines
+  GSetDeque* that = aligned_alloc(GSET_CACHE_LINE, sizeof(GSetDeque));
+  if (that == NULL) Raise(TryCatchExc_MallocFailed);
+  GSetDequeArr* arr = GSetDequeArrAlloc(GSET_DEQUE_NB_SLOT, NULL);
+  if (arr == NULL) {
+
+    free(that);
+    Raise(TryCatchExc_MallocFailed);
+
+  }
+
+  // Initialise the deque
+  atomic_init(&(that->top), 0);
+  atomic_init(&(that->bottom), 0);
+  atomic_init(&(that->arr), arr);
+
+  // Return the new deque
+  return that;
+
+}
+
+// Free the memory used by a work-stealing deque, not the data still in
+// it. No thread must be using the deque.
+// Input:
+//   that: the GSetDeque to be freed
+void GSetDequeFree(
+  GSetDeque** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Free the current array and the ones it replaced
+  GSetDequeArr* arr =
+    atomic_load_explicit(&((*that)->arr), memory_order_relaxed);
+  while (arr != NULL) {
+
+    GSetDequeArr* prev = arr->prev;
+    free(arr);
+    arr = prev;
+
+  }
+
+  // Free memory
+  free(*that);
+  *that = NULL;
+
+}
+
+// Push data at the head of a work-stealing deque. Must be called by the
+// owner thread only.
+// Inputs:
+//   that: the deque
+//   data: the data
+void GSetDequePush(
+  GSetDeque* const that,
+       void* const data) {
+
+  int64_t bottom =
+    atomic_load_explicit(&(that->bottom), memory_order_relaxed);
+  int64_t top = atomic_load_explicit(&(that->top), memory_order_acquire);
+  GSetDequeArr* arr =
+    atomic_load_explicit(&(that->arr), memory_order_relaxed);
+
+  // If the array is full, replace it with a larger one
+  if (bottom - top > arr->mask) {
+
+    GSetDequeArr* larger = GSetDequeArrAlloc((arr->mask + 1) * 2, arr);
+    if (larger == NULL) Raise(TryCatchExc_MallocFailed);
+    for (int64_t i = top; i < bottom; ++i) {
+
+      void* slot = atomic_load_explicit(
+        arr->slots + (i & arr->mask), memory_order_relaxed);
+      atomic_store_explicit(
+        larger->slots + (i & larger->mask), slot, memory_order_relaxed);
+
+    }
+
+    atomic_store_explicit(&(that->arr), larger, memory_order_release);
+    arr = larger;
+
+  }
+
+  // Store the data, then publish it
+  atomic_store_explicit(
+    arr->slots + (bottom & arr->mask), data, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+  atomic_store_explicit(&(that->bottom), bottom + 1, memory_order_relaxed);
+
+}
+
+// Pop data from the head of a work-stealing deque. Must be called by the
+// owner thread only.
+// Inputs:
+//   that: the deque
+//   data: receives the data (may be NULL)
+// Output:
+//   If the deque is not empty, remove the data at its head, copy it into
+//   'data' and return true. Else, or if a thief stole the last data
+//   simultaneously, return false.
+bool GSetDequePop(
+  GSetDeque* const that,
+      void** const data) {
+
+  // Reserve the data at the head, then check no thief reserved it too
+  int64_t bottom =
+    atomic_load_explicit(&(that->bottom), memory_order_relaxed) - 1;
+  GSetDequeArr* arr =
+    atomic_load_explicit(&(that->arr), memory_order_relaxed);
+  atomic_store_explicit(&(that->bottom), bottom, memory_order_relaxed);
+  atomic_thread_fence(memory_order_seq_cst);
+  int64_t top = atomic_load_explicit(&(that->top), memory_order_relaxed);
+
+  // If the deque is empty, restore the bottom index
+  if (top > bottom) {
+
+    atomic_store_explicit(&(that->bottom), bottom + 1, memory_order_relaxed);
+    return false;
+
+  }
+
+  void* slot = atomic_load_explicit(
+    arr->slots + (bottom & arr->mask), memory_order_relaxed);
+  bool isTaken = true;
+
+  // If it is the last data, race with the thieves for it
+  if (top == bottom) {
+
+    isTaken = atomic_compare_exchange_strong_explicit(
+      &(that->top), &top, top + 1,
+      memory_order_seq_cst, memory_order_relaxed);
+    atomic_store_explicit(&(that->bottom), bottom + 1, memory_order_relaxed);
+
+  }
+
+  if (isTaken && data != NULL) *data = slot;
+  return isTaken;
+
+}
+
+// Steal data from the tail of a work-stealing deque. Can be called by
+// several threads simultaneously.
+// Inputs:
+//   that: the deque
+//   data: receives the data (may be NULL)
+// Output:
+//   If the deque is not empty, remove the data at its tail, copy it into
+//   'data' and return true. Else, or if another thread took the data at
+//   the tail simultaneously, return false.
+bool GSetDequeSteal(
+  GSetDeque* const that,
+      void** const data) {
+
+  int64_t top = atomic_load_explicit(&(that->top), memory_order_acquire);
+  atomic_thread_fence(memory_order_seq_cst);
+  int64_t bottom =
+    atomic_load_explicit(&(that->bottom), memory_order_acquire);
+  if (top >= bottom) return false;
+
+  // Read the data at the tail, then race with the owner and other thieves
+  // for it
+  GSetDequeArr* arr =
+    atomic_load_explicit(&(that->arr), memory_order_acquire);
+  void* slot = atomic_load_explicit(
+    arr->slots + (top & arr->mask), memory_order_relaxed);
+  bool isTaken = atomic_compare_exchange_strong_explicit(
+    &(that->top), &top, top + 1,
+    memory_order_seq_cst, memory_order_relaxed);
+  if (isTaken && data != NULL) *data = slot;
+  return isTaken;
+
+}
+
+// Get the number of data in a work-stealing deque
+// Input:
+//   that: the deque
+// Output:
+//   Return the number of data. If threads are using the deque
+//   simultaneously, the result may be already outdated.
+size_t GSetDequeGetSize(
+  GSetDeque const* const that) {
+
+  int64_t top = atomic_load_explicit(
+    (_Atomic(int64_t)*)&(that->top), memory_order_acquire);
+  int64_t bottom = atomic_load_explicit(
+    (_Atomic(int64_t)*)&(that->bottom), memory_order_acquire);
+  return (bottom > top ? (size_t)(bottom - top) : 0);
+
+}
+
+// Allocate memory for a new blocking queue. Data are added and popped by
+// any number of threads, which wait while the queue is full or empty.
+// Input:
+//   capacity: the maximum number of data in the queue, 0 for no maximum
+// Output:
+//   Return the new GSetBlockingQueue.
+GSetBlockingQueue* GSetBlockingQueueAlloc(
+  size_t const capacity) {
+
+  // Get the number of slots
+  if (capacity > (SIZE_MAX >> 1) / sizeof(union GSetElemData))
+    Raise(TryCatchExc_OutOfRange);
+  size_t nbSlot = (capacity == 0 ? GSET_BLOCKINGQUEUE_NB_SLOT : 1);
+  while (nbSlot < capacity) nbSlot <<= 1;
+
+  // Allocate memory
+  GSetBlockingQueue* that = malloc(sizeof(GSetBlockingQueue));
+  if (that == NULL) Raise(TryCatchExc_MallocFailed);
+  that->slots = malloc(nbSlot * sizeof(union GSetElemData));
+  if (that->slots == NULL) {
+
+    free(that);
+    Raise(TryCatchExc_MallocFailed);
+
+  }
+
+  // Create the mutex and conditions
+  int retMutex = pthread_mutex_init(&(that->mutex), NULL);
+  int retNotEmpty = pthread_cond_init(&(that->notEmpty), NULL);
+  int retNotFull = pthread_cond_init(&(that->notFull), NULL);
+  if (retMutex != 0 || retNotEmpty != 0 || retNotFull != 0) {
+
+    if (retMutex == 0) pthread_mutex_destroy(&(that->mutex));
+    if (retNotEmpty == 0) pthread_cond_destroy(&(that->notEmpty));
+    if (retNotFull == 0) pthread_cond_destroy(&(that->notFull));
+    free(that->slots);
+    free(that);
+    Raise(TryCatchExc_MallocFailed);
+
+  }
+
+  // Initialise the queue
+  that->nbWaitPop = 0;
+  that->nbWaitAdd = 0;
+  that->capacity = capacity;
+  that->mask = nbSlot - 1;
+  that->head = 0;
+  that->size = 0;
+  that->isClosed = false;
+
+  // Return the new queue
+  return that;
+
+}
+
+// Free the memory used by a blocking queue, not the data still in it. No
+// thread must be using the queue.
+// Input:
+//   that: the GSetBlockingQueue to be freed
+void GSetBlockingQueueFree_(
+  GSetBlockingQueue** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Free memory
+  pthread_cond_destroy(&((*that)->notFull));
+  pthread_cond_destroy(&((*that)->notEmpty));
+  pthread_mutex_destroy(&((*that)->mutex));
+  free((*that)->slots);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Close a blocking queue. Data can't be added anymore, the data still in
+// the queue can be popped, and the waiting threads are woken up.
+// Input:
+//   that: the queue
+void GSetBlockingQueueClose_(
+  GSetBlockingQueue* const that) {
+
+  pthread_mutex_lock(&(that->mutex));
+  that->isClosed = true;
+  pthread_cond_broadcast(&(that->notEmpty));
+  pthread_cond_broadcast(&(that->notFull));
+  pthread_mutex_unlock(&(that->mutex));
+
+}
+
+// Check if a blocking queue is closed
+// Input:
+//   that: the queue
+// Output:
+//   Return true if the queue is closed, else false.
+bool GSetBlockingQueueIsClosed_(
+  GSetBlockingQueue* const that) {
+
+  pthread_mutex_lock(&(that->mutex));
+  bool isClosed = that->isClosed;
+  pthread_mutex_unlock(&(that->mutex));
+  return isClosed;
+
+}
+
+// Get the number of data in a blocking queue
+// Input:
+//   that: the queue
+// Output:
+//   Return the number of data. If threads are using the queue
+//   simultaneously, the result may be already outdated.
+size_t GSetBlockingQueueGetSize_(
+  GSetBlockingQueue* const that) {
+
+  pthread_mutex_lock(&(that->mutex));
+  size_t size = that->size;
+  pthread_mutex_unlock(&(that->mutex));
+  return size;
+
+}
+
+// Get the maximum number of data in a blocking queue
+// Input:
+//   that: the queue
+// Output:
+//   Return the capacity of the queue, 0 if it has no maximum.
+size_t GSetBlockingQueueGetCapacity_(
+  GSetBlockingQueue const* const that) {
+
+  return that->capacity;
+
+}
+
+// Add an array of data at the tail of a blocking queue, waiting while the
+// queue is full. The data are added by as large blocks as the free room in
+// the queue allows, with one lock and one wake up of the waiting threads
+// per block.
+// Inputs:
+//   that: the queue
+//     nb: the number of data in the array
+//    arr: the array of data
+// Output:
+//   Return the number of data added, lower than 'nb' only if the queue has
+//   been closed.
+#define GSETBLOCKINGQUEUEADDARR__(N, T)                            \
+size_t GSetBlockingQueueAddArr_ ## N(                              \
+  GSetBlockingQueue* const that,                                   \
+             size_t const nb,                                      \
+           T const* const arr) {                                   \
+  size_t nbAdd = 0;                                                \
+  pthread_mutex_lock(&(that->mutex));                              \
+  while (nbAdd < nb) {                                             \
+    size_t nbBlock = GSetBlockingQueueWaitRoom(that, nb - nbAdd);  \
+    if (nbBlock == 0) break;                                       \
+    size_t tail = that->head + that->size;                         \
+    for (size_t i = 0; i < nbBlock; ++i)                           \
+      that->slots[(tail + i) & that->mask].N = arr[nbAdd + i];     \
+    that->size += nbBlock;                                         \
+    nbAdd += nbBlock;                                              \
+    GSetBlockingQueueWake(                                         \
+      &(that->notEmpty), that->nbWaitPop, nbBlock);                \
+  }                                                                \
+  pthread_mutex_unlock(&(that->mutex));                            \
+  return nbAdd;                                                    \
+}
+
+GSETBLOCKINGQUEUEADDARR__(Char, char)
+GSETBLOCKINGQUEUEADDARR__(UChar, unsigned char)
+GSETBLOCKINGQUEUEADDARR__(Int, int)
+GSETBLOCKINGQUEUEADDARR__(UInt, unsigned int)
+GSETBLOCKINGQUEUEADDARR__(Long, long)
+GSETBLOCKINGQUEUEADDARR__(ULong, unsigned long)
+GSETBLOCKINGQUEUEADDARR__(Float, float)
+GSETBLOCKINGQUEUEADDARR__(Double, double)
+GSETBLOCKINGQUEUEADDARR__(Ptr, void*)
+
+// Add data at the tail of a blocking queue, waiting while the queue is
+// full
+// Inputs:
+//   that: the queue
+//   data: the data
+// Output:
+//   Return true if the data was added, or false if the queue is closed.
+#define GSETBLOCKINGQUEUEADD__(N, T)                               \
+bool GSetBlockingQueueAdd_ ## N(                                   \
+  GSetBlockingQueue* const that,                                   \
+                  T const data) {                                  \
+  return (GSetBlockingQueueAddArr_ ## N(that, 1, &data) == 1);     \
+}
+
+GSETBLOCKINGQUEUEADD__(Char, char)
+GSETBLOCKINGQUEUEADD__(UChar, unsigned char)
+GSETBLOCKINGQUEUEADD__(Int, int)
+GSETBLOCKINGQUEUEADD__(UInt, unsigned int)
+GSETBLOCKINGQUEUEADD__(Long, long)
+GSETBLOCKINGQUEUEADD__(ULong, unsigned long)
+GSETBLOCKINGQUEUEADD__(Float, float)
+GSETBLOCKINGQUEUEADD__(Double, double)
+GSETBLOCKINGQUEUEADD__(Ptr, void*)
+
+// Pop data from the head of a blocking queue into an array, waiting while
+// the queue is empty, then popping all the available data up to the size
+// of the array with one lock
+// Inputs:
+//   that: the queue
+//     nb: the size of the array, greater than 0
+//    arr: receives the data (may be NULL)
+// Output:
+//   Return the number of data popped, 0 only if the queue is closed and
+//   empty.
+#define GSETBLOCKINGQUEUEPOPARR__(N, T)                            \
+size_t GSetBlockingQueuePopArr_ ## N(                              \
+  GSetBlockingQueue* const that,                                   \
+             size_t const nb,                                      \
+                 T* const arr) {                                   \
+  pthread_mutex_lock(&(that->mutex));                              \
+  size_t nbPop = GSetBlockingQueueWaitData(that, nb, NULL);        \
+  if (arr != NULL)                                                 \
+    for (size_t i = 0; i < nbPop; ++i)                             \
+      arr[i] = that->slots[(that->head + i) & that->mask].N;       \
+  GSetBlockingQueueTake(that, nbPop);                              \
+  pthread_mutex_unlock(&(that->mutex));                            \
+  return nbPop;                                                    \
+}
+
+GSETBLOCKINGQUEUEPOPARR__(Char, char)
+GSETBLOCKINGQUEUEPOPARR__(UChar, unsigned char)
+GSETBLOCKINGQUEUEPOPARR__(Int, int)
+GSETBLOCKINGQUEUEPOPARR__(UInt, unsigned int)
+GSETBLOCKINGQUEUEPOPARR__(Long, long)
+GSETBLOCKINGQUEUEPOPARR__(ULong, unsigned long)
+GSETBLOCKINGQUEUEPOPARR__(Float, float)
+GSETBLOCKINGQUEUEPOPARR__(Double, double)
+GSETBLOCKINGQUEUEPOPARR__(Ptr, void*)
+
+// Pop data from the head of a blocking queue, waiting while the queue is
+// empty
+// Inputs:
+//   that: the queue
+//   data: receives the data (may be NULL)
+// Output:
+//   Return true if a data was popped, or false if the queue is closed and
+//   empty.
+#define GSETBLOCKINGQUEUEPOP__(N, T)                               \
+bool GSetBlockingQueuePop_ ## N(                                   \
+  GSetBlockingQueue* const that,                                   \
+                 T* const data) {                                  \
+  return (GSetBlockingQueuePopArr_ ## N(that, 1, data) == 1);      \
+}
+
+GSETBLOCKINGQUEUEPOP__(Char, char)
+GSETBLOCKINGQUEUEPOP__(UChar, unsigned char)
+GSETBLOCKINGQUEUEPOP__(Int, int)
+GSETBLOCKINGQUEUEPOP__(UInt, unsigned int)
+GSETBLOCKINGQUEUEPOP__(Long, long)
+GSETBLOCKINGQUEUEPOP__(ULong, unsigned long)
+GSETBLOCKINGQUEUEPOP__(Float, float)
+GSETBLOCKINGQUEUEPOP__(Double, double)
+GSETBLOCKINGQUEUEPOP__(Ptr, void*)
+
+// Pop data from the head of a blocking queue, waiting at most a given time
+// while the queue is empty
+// Inputs:
+//      that: the queue
+//      data: receives the data (may be NULL)
+//   timeout: the maximum waiting time, in seconds
+// Output:
+//   Return true if a data was popped, or false if the queue is closed and
+//   empty or the waiting time has elapsed.
+#define GSETBLOCKINGQUEUETIMEDPOP__(N, T)                          \
+bool GSetBlockingQueueTimedPop_ ## N(                              \
+  GSetBlockingQueue* const that,                                   \
+                 T* const data,                                    \
+             double const timeout) {                               \
+  struct timespec deadline = GSetBlockingQueueDeadline(timeout);   \
+  pthread_mutex_lock(&(that->mutex));                              \
+  size_t nbPop = GSetBlockingQueueWaitData(that, 1, &deadline);    \
+  if (nbPop == 1 && data != NULL)                                  \
+    *data = that->slots[that->head].N;                             \
+  GSetBlockingQueueTake(that, nbPop);                              \
+  pthread_mutex_unlock(&(that->mutex));                            \
+  return (nbPop == 1);                                             \
+}
+
+GSETBLOCKINGQUEUETIMEDPOP__(Char, char)
+GSETBLOCKINGQUEUETIMEDPOP__(UChar, unsigned char)
+GSETBLOCKINGQUEUETIMEDPOP__(Int, int)
+GSETBLOCKINGQUEUETIMEDPOP__(UInt, unsigned int)
+GSETBLOCKINGQUEUETIMEDPOP__(Long, long)
+GSETBLOCKINGQUEUETIMEDPOP__(ULong, unsigned long)
+GSETBLOCKINGQUEUETIMEDPOP__(Float, float)
+GSETBLOCKINGQUEUETIMEDPOP__(Double, double)
+GSETBLOCKINGQUEUETIMEDPOP__(Ptr, void*)
+
+// Allocate memory for a new sharded set. The data are distributed by hash
+// over shards, each a set with a hash index protected by its own mutex,
+// so threads using different shards don't wait for each other.
+// Input:
+//   nbShard: the number of shards (greater than 0), rounded up to a power
+//            of 2
+// Output:
+//   Return the new GSetSharded.
+GSetSharded* GSetShardedAlloc(
+  size_t const nbShard) {
+
+  // Get the number of shards, the shard of a data is given by the high
+  // half of the bits of its hash
+  if (nbShard == 0 || nbShard > ((size_t)1 << (sizeof(size_t) * 4)))
+    Raise(TryCatchExc_OutOfRange);
+  size_t nb = 1;
+  while (nb < nbShard) nb <<= 1;
+
+  // Allocate memory
+  GSetSharded* that = malloc(sizeof(GSetSharded));
+  if (that == NULL) Raise(TryCatchExc_MallocFailed);
+  that->shards = aligned_alloc(GSET_CACHE_LINE, nb * sizeof(GSetShard));
+  if (that->shards == NULL) {
+
+    free(that);
+    Raise(TryCatchExc_MallocFailed);
+
+  }
+
+  // Create the shards, stopping at the first failure
+  size_t iShard = 0;
+  while (iShard < nb) {
+
+    GSetShard* shard = that->shards + iShard;
+    shard->set = GSetAllocNoExc();
+    if (shard->set == NULL) break;
+    if (pthread_mutex_init(&(shard->mutex), NULL) != 0) {
+
+      GSetFree_(&(shard->set));
+      break;
+
+    }
+
+    ++iShard;
+
+  }
+
+  // If a shard couldn't be created, free the created ones
+  if (iShard < nb) {
+
+    while (iShard > 0) {
+
+      --iShard;
+      pthread_mutex_destroy(&(that->shards[iShard].mutex));
+      GSetFree_(&(that->shards[iShard].set));
+
+    }
+
+    free(that->shards);
+    free(that);
+    Raise(TryCatchExc_MallocFailed);
+
+  }
+
+  // Initialise the set
+  that->mask = nb - 1;
+
+  // Return the new set
+  return that;
+
+}
+
+// Free the memory used by a sharded set, not the data it contains. No
+// thread must be using the set.
+// Input:
+//   that: the GSetSharded to be freed
+void GSetShardedFree_(
+  GSetSharded** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Free memory
+  for (size_t iShard = 0; iShard <= (*that)->mask; ++iShard) {
+
+    pthread_mutex_destroy(&((*that)->shards[iShard].mutex));
+    GSetFree_(&((*that)->shards[iShard].set));
+
+  }
+
+  free((*that)->shards);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Get the number of shards of a sharded set
+// Input:
+//   that: the set
+// Output:
+//   Return the number of shards.
+size_t GSetShardedGetNbShard_(
+  GSetSharded const* const that) {
+
+  return that->mask + 1;
+
+}
+
+// Get the number of data in a sharded set
+// Input:
+//   that: the set
+// Output:
+//   Return the number of data. If threads are using the set
+//   simultaneously, the result may be already outdated.
+size_t GSetShardedGetSize_(
+  GSetSharded* const that) {
+
+  size_t size = 0;
+  for (size_t iShard = 0; iShard <= that->mask; ++iShard) {
+
+    GSetShard* shard = that->shards + iShard;
+    pthread_mutex_lock(&(shard->mutex));
+    size += shard->set->size;
+    pthread_mutex_unlock(&(shard->mutex));
+
+  }
+
+  return size;
+
+}
+
+// Add a data to a sharded set if it doesn't contain it yet. The hash
+// index of a shard is attached when the first data is added to it, and the
+// shard is unlocked if an exception is raised.
+// Inputs:
+//   that: the set
+//   data: the data
+// Output:
+//   Return true if the data was added, false if it was already in the set.
+#define GSETSHARDEDADD__(N, T)                                  \
+bool GSetShardedAdd_ ## N(                                      \
+  GSetSharded* const that,                                      \
+            T const data) {                                     \
+  GSetShard* shard = GSetShardedLock(                           \
+    that, GSetKeyType_ ## N, &(union GSetElemData){.N = data}); \
+  bool isAdded = false;                                         \
+  Try {                                                         \
+    if (shard->set->index == NULL)                              \
+      GSetAttachIndex_ ## N(shard->set);                        \
+    if (GSetContains_ ## N(shard->set, data) == false) {        \
+      GSetAdd_ ## N(shard->set, data);                          \
+      isAdded = true;                                           \
+    }                                                           \
+  } CatchDefault {                                              \
+    pthread_mutex_unlock(&(shard->mutex));                      \
+  } EndCatch;                                                   \
+  ForwardExc();                                                 \
+  pthread_mutex_unlock(&(shard->mutex));                        \
+  return isAdded;                                               \
+}
+
+GSETSHARDEDADD__(Char, char)
+GSETSHARDEDADD__(UChar, unsigned char)
+GSETSHARDEDADD__(Int, int)
+GSETSHARDEDADD__(UInt, unsigned int)
+GSETSHARDEDADD__(Long, long)
+GSETSHARDEDADD__(ULong, unsigned long)
+GSETSHARDEDADD__(Float, float)
+GSETSHARDEDADD__(Double, double)
+GSETSHARDEDADD__(Ptr, void*)
+
+// Check if a sharded set contains a data
+// Inputs:
+//   that: the set
+//   data: the data
+// Output:
+//   Return true if the data is in the set, else false.
+#define GSETSHARDEDCONTAINS__(N, T)                             \
+bool GSetShardedContains_ ## N(                                 \
+  GSetSharded* const that,                                      \
+            T const data) {                                     \
+  GSetShard* shard = GSetShardedLock(                           \
+    that, GSetKeyType_ ## N, &(union GSetElemData){.N = data}); \
+  bool isIn = GSetContains_ ## N(shard->set, data);             \
+  pthread_mutex_unlock(&(shard->mutex));                        \
+  return isIn;                                                  \
+}
+
+GSETSHARDEDCONTAINS__(Char, char)
+GSETSHARDEDCONTAINS__(UChar, unsigned char)
+GSETSHARDEDCONTAINS__(Int, int)
+GSETSHARDEDCONTAINS__(UInt, unsigned int)
+GSETSHARDEDCONTAINS__(Long, long)
+GSETSHARDEDCONTAINS__(ULong, unsigned long)
+GSETSHARDEDCONTAINS__(Float, float)
+GSETSHARDEDCONTAINS__(Double, double)
+GSETSHARDEDCONTAINS__(Ptr, void*)
+
+// Remove a data from a sharded set
+// Inputs:
+//   that: the set
+//   data: the data
+// Output:
+//   Return true if the data was removed, false if it was not in the set.
+#define GSETSHARDEDREMOVE__(N, T)                               \
+bool GSetShardedRemove_ ## N(                                   \
+  GSetSharded* const that,                                      \
+            T const data) {                                     \
+  GSetShard* shard = GSetShardedLock(                           \
+    that, GSetKeyType_ ## N, &(union GSetElemData){.N = data}); \
+  bool isRemoved = GSetRemove_ ## N(shard->set, data);          \
+  pthread_mutex_unlock(&(shard->mutex));                        \
+  return isRemoved;                                             \
+}
+
+GSETSHARDEDREMOVE__(Char, char)
+GSETSHARDEDREMOVE__(UChar, unsigned char)
+GSETSHARDEDREMOVE__(Int, int)
+GSETSHARDEDREMOVE__(UInt, unsigned int)
+GSETSHARDEDREMOVE__(Long, long)
+GSETSHARDEDREMOVE__(ULong, unsigned long)
+GSETSHARDEDREMOVE__(Float, float)
+GSETSHARDEDREMOVE__(Double, double)
+GSETSHARDEDREMOVE__(Ptr, void*)
+
+// Apply a user defined function on each data of a sharded set. The shards
+// are locked one after the other, data added or removed by other threads
+// meanwhile may or may not be visited.
+// Inputs:
+//     that: the set
+//      fun: the function, it receives a pointer to the data and params, and
+//           must not modify the data nor use the set
+//   params: the parameters of the function
+void GSetShardedForEach_(
+  GSetSharded* const that,
+   GSetApplyFun fun,
+          void* params) {
+
+  for (size_t iShard = 0; iShard <= that->mask; ++iShard) {
+
+    GSetShard* shard = that->shards + iShard;
+    pthread_mutex_lock(&(shard->mutex));
+    for (GSetElem* ptr = shard->set->first; ptr != NULL; ptr = ptr->next)
+      fun(
+        &(ptr->data),
+        params);
+    pthread_mutex_unlock(&(shard->mutex));
+
+  }
+
+}
+
+// Save the data of a set in a stream, in binary format: a header (the
+// format version, the type and size of the data, the byte order of the
+// machine and the number of data) followed by the data, written by blocks
+// Inputs:
+//     that: the set
+//   stream: the stream, opened in binary mode
+#define GSETSAVE__(N, T)                                              \
+void GSetSave_ ## N(                                                  \
+  GSet const* const that,                                             \
+        FILE* const stream) {                                         \
+  GSetSaveHeader(stream, GSetKeyType_ ## N, sizeof(T), that->size);   \
+  T block[GSET_IO_BLOCK];                                             \
+  GSetElem const* elem = that->first;                                 \
+  while (elem != NULL) {                                              \
+    size_t nb = 0;                                                    \
+    for (; elem != NULL && nb < GSET_IO_BLOCK; elem = elem->next)     \
+      block[nb++] = elem->data.N;                                     \
+    if (fwrite(block, sizeof(T), nb, stream) != nb)                   \
+      Raise(TryCatchExc_IOError);                                     \
+  }                                                                   \
+}
+
+GSETSAVE__(Char, char)
+GSETSAVE__(UChar, unsigned char)
+GSETSAVE__(Int, int)
+GSETSAVE__(UInt, unsigned int)
+GSETSAVE__(Long, long)
+GSETSAVE__(ULong, unsigned long)
+GSETSAVE__(Float, float)
+GSETSAVE__(Double, double)
+
+// Add a block of data at the tail of a set, the elements being allocated
+// at once and linked in one operation (one by one if the set is bounded,
+// to apply its policy)
+// Inputs:
+//    that: the set
+//   block: the data
+//      nb: the number of data
+#define GSETADDBLOCK__(N, T)                                      \
+static void GSetAddBlock_ ## N(                                   \
+     GSet* const that,                                            \
+  T const* const block,                                           \
+    size_t const nb) {                                            \
+  if (nb == 0) return;                                            \
+  if (that->capacity > 0) {                                       \
+    GSetAddArr_ ## N(that, nb, block);                            \
+    return;                                                       \
+  }                                                               \
+  GSetElem* last = NULL;                                          \
+  GSetElem* first = GSetElemAllocChain(nb, &last);                \
+  GSetElem* elem = first;                                         \
+  FOR(i, nb) {                                                    \
+    elem->data.N = block[i];                                      \
+    elem = elem->next;                                            \
+  }                                                               \
+  GSetAppendChain(that, first, last, nb);                         \
+}
+
+GSETADDBLOCK__(Char, char)
+GSETADDBLOCK__(UChar, unsigned char)
+GSETADDBLOCK__(Int, int)
+GSETADDBLOCK__(UInt, unsigned int)
+GSETADDBLOCK__(Long, long)
+GSETADDBLOCK__(ULong, unsigned long)
+GSETADDBLOCK__(Float, float)
+GSETADDBLOCK__(Double, double)
+
+// Load data saved with GSetSave_<N> from a stream and add them at the tail
+// of a set. The data are read by blocks, and the elements of a block are
+// allocated at once and linked at the tail of the set in one operation
+// (one by one if the set is bounded, to apply its policy).
+// Inputs:
+//     that: the set
+//   stream: the stream, opened in binary mode
+// Output:
+//   Return the number of data added to the set
+#define GSETLOAD__(N, T)                                              \
+size_t GSetLoad_ ## N(                                                \
+  GSet* const that,                                                   \
+  FILE* const stream) {                                               \
+  bool isSwapped = false;                                             \
+  size_t nb =                                                         \
+    GSetLoadHeader(stream, GSetKeyType_ ## N, sizeof(T), &isSwapped); \
+  if (that->size > SIZE_MAX - nb) Raise(TryCatchExc_IntOverflow);     \
+  T block[GSET_IO_BLOCK];                                             \
+  size_t nbLoad = 0;                                                  \
+  while (nbLoad < nb) {                                               \
+    size_t nbBlock = nb - nbLoad;                                     \
+    if (nbBlock > GSET_IO_BLOCK) nbBlock = GSET_IO_BLOCK;             \
+    size_t nbRead = fread(block, sizeof(T), nbBlock, stream);         \
+    if (isSwapped) GSetSwapBytes(block, sizeof(T), nbRead);           \
+    GSetAddBlock_ ## N(that, block, nbRead);                          \
+    nbLoad += nbRead;                                                 \
+    if (nbRead < nbBlock) Raise(TryCatchExc_IOError);                 \
+  }                                                                   \
+  return nb;                                                          \
+}
+
+GSETLOAD__(Char, char)
+GSETLOAD__(UChar, unsigned char)
+GSETLOAD__(Int, int)
+GSETLOAD__(UInt, unsigned int)
+GSETLOAD__(Long, long)
+GSETLOAD__(ULong, unsigned long)
+GSETLOAD__(Float, float)
+GSETLOAD__(Double, double)
+
+// Save the data of a set of pointers in a stream, with the header of
+// GSetSave_<N> followed by the data written one by one by a user defined
+// function. Raise TryCatchExc_IOError if the function fails.
+// Inputs:
+//     that: the set
+//   stream: the stream, opened in binary mode
+//      fun: the function writing a data
+//   params: the parameters of the function
+void GSetSaveWith_(
+  GSet const* const that,
+        FILE* const stream,
+     GSetSaveFun fun,
+           void* params) {
+
+  GSetSaveHeader(stream, GSetKeyType_User, 0, that->size);
+  for (GSetElem const* elem = that->first; elem != NULL; elem = elem->next)
+    if (fun(elem->data.Ptr, stream, params) == false)
+      Raise(TryCatchExc_IOError);
+
+}
+
+// Load data saved with GSetSaveWith_ from a stream and add them at the tail
+// of a set of pointers, by blocks as in GSetLoad_<N>
+// Inputs:
+//     that: the set
+//   stream: the stream, opened in binary mode
+//      fun: the function reading a data
+//   params: the parameters of the function
+// Output:
+//   Return the number of data added to the set
+size_t GSetLoadWith_(
+        GSet* const that,
+        FILE* const stream,
+     GSetLoadFun fun,
+           void* params) {
+
+  // Read the header
+  bool isSwapped = false;
+  size_t nb = GSetLoadHeader(stream, GSetKeyType_User, 0, &isSwapped);
+  if (that->size > SIZE_MAX - nb) Raise(TryCatchExc_IntOverflow);
+
+  // Read the data by blocks
+  void* block[GSET_IO_BLOCK];
+  size_t nbLoad = 0;
+  while (nbLoad < nb) {
+
+    size_t nbBlock = nb - nbLoad;
+    if (nbBlock > GSET_IO_BLOCK) nbBlock = GSET_IO_BLOCK;
+    size_t nbRead = 0;
+    while (nbRead < nbBlock && fun(block + nbRead, stream, params))
+      ++nbRead;
+
+    // Add the data read to the set
+    if (nbRead > 0 && that->capacity > 0) {
+
+      GSetAddArr_Ptr(that, nbRead, block);
+
+    } else if (nbRead > 0) {
+
+      GSetElem* last = NULL;
+      GSetElem* first = GSetElemAllocChain(nbRead, &last);
+      GSetElem* elem = first;
+      FOR(i, nbRead) {
+
+        elem->data.Ptr = block[i];
+        elem = elem->next;
+
+      }
+
+      GSetAppendChain(that, first, last, nbRead);
+
+    }
+
+    nbLoad += nbRead;
+    if (nbRead < nbBlock) Raise(TryCatchExc_IOError);
+
+  }
+
+  return nb;
+
+}
+
+// Parse a number at the beginning of a text as a data of a set of integers
+// or reals
+// Inputs:
+//      text: the text
+//       len: the number of characters in the text
+//   isDelim: the flags of the delimiter characters
+//       end: receives the index of the first delimiter after the number
+//            (len if there is none), or of an invalid character before it
+//       val: receives the data
+// Output:
+//   Return true if the characters before 'end' are a valid number in the
+//   range of the type of data, else false.
+#define GSETPARSESIGNED__(N, T, Min, Max)                                 \
+static bool GSetParseToken_ ## N(                                         \
+  char const* const text,                                                 \
+       size_t const len,                                                  \
+  bool const* const isDelim,                                              \
+      size_t* const end,                                                  \
+           T* const val) {                                                \
+  bool isNeg = false;                                                     \
+  unsigned long long mag = 0;                                             \
+  bool isValid = GSetParseInteger(text, len, isDelim, end, &isNeg, &mag); \
+  if (isValid == false) return false;                                     \
+  if (isNeg == false) {                                                   \
+    if (mag > (unsigned long long)(Max)) return false;                    \
+    *val = (T)mag;                                                        \
+  } else if (mag == 0) {                                                  \
+    *val = 0;                                                             \
+  } else if (                                                             \
+    (Min) < 0 &&                                                          \
+    mag - 1 <= (unsigned long long)(-((Min) + 1))) {                      \
+    *val = (T)(-(long long)(mag - 1) - 1);                                \
+  } else return false;                                                    \
+  return true;                                                            \
+}
+
+#define GSETPARSEUNSIGNED__(N, T, Max)                                        \
+static bool GSetParseToken_ ## N(                                             \
+  char const* const text,                                                     \
+       size_t const len,                                                      \
+  bool const* const isDelim,                                                  \
+      size_t* const end,                                                      \
+           T* const val) {                                                    \
+  bool isNeg = false;                                                         \
+  unsigned long long mag = 0;                                                 \
+  bool isValid = GSetParseInteger(text, len, isDelim, end, &isNeg, &mag);     \
+  if (isValid == false) return false;                                         \
+  if ((isNeg && mag > 0) || mag > (unsigned long long)(Max)) return false;    \
+  *val = (T)mag;                                                              \
+  return true;                                                                \
+}
+
+#define GSETPARSEREAL__(N, T, IsFloat)                                    \
+static bool GSetParseToken_ ## N(                                         \
+  char const* const text,                                                 \
+       size_t const len,                                                  \
+  bool const* const isDelim,                                              \
+      size_t* const end,                                                  \
+           T* const val) {                                                \
+  size_t i = 0;                                                           \
+  while (i < len && isDelim[(unsigned char)(text[i])] == false) ++i;      \
+  *end = i;                                                               \
+  double res = 0.0;                                                       \
+  if (GSetParseReal(text, i, IsFloat, &res) == false) return false;       \
+  *val = (T)res;                                                          \
+  return true;                                                            \
+}
+
+GSETPARSESIGNED__(Char, char, CHAR_MIN, CHAR_MAX)
+GSETPARSEUNSIGNED__(UChar, unsigned char, UCHAR_MAX)
+GSETPARSESIGNED__(Int, int, INT_MIN, INT_MAX)
+GSETPARSEUNSIGNED__(UInt, unsigned int, UINT_MAX)
+GSETPARSESIGNED__(Long, long, LONG_MIN, LONG_MAX)
+GSETPARSEUNSIGNED__(ULong, unsigned long, ULONG_MAX)
+GSETPARSEREAL__(Float, float, true)
+GSETPARSEREAL__(Double, double, false)
+
+// Parse the numbers in a chunk of text and add them at the tail of a set,
+// by blocks of GSET_IO_BLOCK data (cf GSetAddBlock_<N>)
+// Inputs:
+//     that: the set
+//     text: the chunk
+//      len: the number of characters in the chunk
+//   isLast: true if the chunk ends the text, else its last number is left
+//           unparsed as it may continue in the next chunk
+//   parser: the state of the parsing, updated
+// Output:
+//   Return the number of characters parsed. If an invalid number was
+//   found, the parsing stops before it.
+#define GSETPARSECHUNK__(N, T)                                            \
+static size_t GSetParseChunk_ ## N(                                       \
+            GSet* const that,                                             \
+      char const* const text,                                             \
+           size_t const len,                                              \
+             bool const isLast,                                           \
+  GSetTextParser* const parser) {                                         \
+  T block[GSET_IO_BLOCK];                                                 \
+  size_t nbBlock = 0;                                                     \
+  size_t nbParsed = 0;                                                    \
+  size_t i = 0;                                                           \
+  while (true) {                                                          \
+    while (i < len && parser->isDelim[(unsigned char)(text[i])]) {        \
+      if (text[i] == '\n') {                                              \
+        ++(parser->line);                                                 \
+        parser->lineStart = parser->offset + i + 1;                       \
+      }                                                                   \
+      ++i;                                                                \
+    }                                                                     \
+    nbParsed = i;                                                         \
+    if (i == len) break;                                                  \
+    size_t end = 0;                                                       \
+    bool isValid = GSetParseToken_ ## N(                                  \
+      text + i, len - i, parser->isDelim, &end, block + nbBlock);         \
+    if (i + end == len && isLast == false) break;                         \
+    if (isValid == false) {                                               \
+      parser->isInvalid = true;                                           \
+      break;                                                              \
+    }                                                                     \
+    i += end;                                                             \
+    ++nbBlock;                                                            \
+    if (nbBlock == GSET_IO_BLOCK) {                                       \
+      GSetAddBlock_ ## N(that, block, nbBlock);                           \
+      parser->nb += nbBlock;                                              \
+      nbBlock = 0;                                                        \
+    }                                                                     \
+  }                                                                       \
+  GSetAddBlock_ ## N(that, block, nbBlock);                               \
+  parser->nb += nbBlock;                                                  \
+  parser->offset += nbParsed;                                             \
+  return nbParsed;                                                        \
+}
+
+GSETPARSECHUNK__(Char, char)
+GSETPARSECHUNK__(UChar, unsigned char)
+GSETPARSECHUNK__(Int, int)
+GSETPARSECHUNK__(UInt, unsigned int)
+GSETPARSECHUNK__(Long, long)
+GSETPARSECHUNK__(ULong, unsigned long)
+GSETPARSECHUNK__(Float, float)
+GSETPARSECHUNK__(Double, double)
+
+// Parse a text stream of numbers separated by delimiters and add them at
+// the tail of a set. The stream is read by chunks of GSET_TEXT_BUFFER
+// bytes, the number straddling two chunks being moved at the beginning of
+// the buffer before reading the next one.
+// Inputs:
+//     that: the set
+//   stream: the stream
+//   delims: the characters separating the numbers
+//      pos: if not NULL, receives the position of the invalid number if
+//           the parsing failed, else the position of the end of the text
+// Output:
+//   Return the number of data added to the set
+#define GSETPARSETEXT__(N, T)                                             \
+size_t GSetParseText_ ## N(                                               \
+         GSet* const that,                                                \
+         FILE* const stream,                                              \
+    char const* const delims,                                             \
+  GSetTextPos* const pos) {                                               \
+  GSetTextParser parser;                                                  \
+  GSetTextParserInit(&parser, delims);                                    \
+  char* buf = NULL;                                                       \
+  MALLOC(buf, GSET_TEXT_BUFFER);                                          \
+  bool isReadError = false;                                               \
+  Try {                                                                   \
+    size_t nbKeep = 0;                                                    \
+    bool isEnd = false;                                                   \
+    while (isEnd == false && parser.isInvalid == false) {                 \
+      size_t nbRead =                                                     \
+        fread(buf + nbKeep, 1, GSET_TEXT_BUFFER - nbKeep, stream);        \
+      isEnd = (nbRead < GSET_TEXT_BUFFER - nbKeep);                       \
+      isReadError = (isEnd && ferror(stream));                            \
+      size_t len = nbKeep + nbRead;                                       \
+      size_t nbParsed = GSetParseChunk_ ## N(                             \
+        that, buf, len, isEnd && isReadError == false, &parser);          \
+      nbKeep = len - nbParsed;                                            \
+      if (nbKeep == GSET_TEXT_BUFFER) parser.isInvalid = true;            \
+      memmove(buf, buf + nbParsed, nbKeep);                               \
+    }                                                                     \
+  } CatchDefault {                                                        \
+    free(buf);                                                            \
+  } EndCatch;                                                             \
+  ForwardExc();                                                           \
+  free(buf);                                                              \
+  GSetTextParserGetPos(&parser, pos);                                     \
+  if (parser.isInvalid || isReadError) Raise(TryCatchExc_IOError);        \
+  return parser.nb;                                                       \
+}
+
+GSETPARSETEXT__(Char, char)
+GSETPARSETEXT__(UChar, unsigned char)
+GSETPARSETEXT__(Int, int)
+GSETPARSETEXT__(UInt, unsigned int)
+GSETPARSETEXT__(Long, long)
+GSETPARSETEXT__(ULong, unsigned long)
+GSETPARSETEXT__(Float, float)
+GSETPARSETEXT__(Double, double)
+
+// Parse a buffer of numbers separated by delimiters and add them at the
+// tail of a set
+// Inputs:
+//     that: the set
+//     text: the buffer
+//      len: the length in bytes of the buffer
+//   delims: the characters separating the numbers
+//      pos: if not NULL, receives the position of the invalid number if
+//           the parsing failed, else the position of the end of the text
+// Output:
+//   Return the number of data added to the set
+#define GSETPARSETEXTBUF__(N, T)                                          \
+size_t GSetParseTextBuf_ ## N(                                            \
+         GSet* const that,                                                \
+    char const* const text,                                               \
+        size_t const len,                                                 \
+    char const* const delims,                                             \
+  GSetTextPos* const pos) {                                               \
+  GSetTextParser parser;                                                  \
+  GSetTextParserInit(&parser, delims);                                    \
+  (void)GSetParseChunk_ ## N(that, text, len, true, &parser);             \
+  GSetTextParserGetPos(&parser, pos);                                     \
+  if (parser.isInvalid) Raise(TryCatchExc_IOError);                       \
+  return parser.nb;                                                       \
+}
+
+GSETPARSETEXTBUF__(Char, char)
+GSETPARSETEXTBUF__(UChar, unsigned char)
+GSETPARSETEXTBUF__(Int, int)
+GSETPARSETEXTBUF__(UInt, unsigned int)
+GSETPARSETEXTBUF__(Long, long)
+GSETPARSETEXTBUF__(ULong, unsigned long)
+GSETPARSETEXTBUF__(Float, float)
+GSETPARSETEXTBUF__(Double, double)
+
+// Encode a set of integers sorted in increasing order into a compressed
+// set, by blocks of GSET_PACK_BLOCK data
+// Input:
+//   that: the set
+// Output:
+//   Return the new GSetPacked.
+#define GSETPACK__(N, T)                                                  \
+GSetPacked* GSetPack_ ## N(                                               \
+  GSet const* const that) {                                               \
+  GSetPacked* packed = GSetPackedCreate(GSetKeyType_ ## N, that->size);   \
+  Try {                                                                   \
+    unsigned long block[GSET_PACK_BLOCK];                                 \
+    GSetElem const* elem = that->first;                                   \
+    T prev = (elem != NULL ? elem->data.N : 0);                           \
+    while (elem != NULL) {                                                \
+      size_t nb = 0;                                                      \
+      for (; elem != NULL && nb < GSET_PACK_BLOCK; elem = elem->next) {   \
+        if (elem->data.N < prev) packed->isSorted = false;                \
+        prev = elem->data.N;                                              \
+        block[nb] = (unsigned long)(elem->data.N);                        \
+        ++nb;                                                             \
+      }                                                                   \
+      GSetPackedAddBlock(packed, block, nb);                              \
+    }                                                                     \
+  } CatchDefault {                                                        \
+    GSetPackedFree_(&packed);                                             \
+  } EndCatch;                                                             \
+  ForwardExc();                                                           \
+  return packed;                                                          \
+}
+
+GSETPACK__(Long, long)
+GSETPACK__(ULong, unsigned long)
+
+// Free the memory used by a compressed set
+// Input:
+//   that: the GSetPacked to be freed
+void GSetPackedFree_(
+  GSetPacked** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Free memory
+  free((*that)->blocks);
+  free((*that)->words);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Get the number of data in a compressed set
+// Input:
+//   that: the compressed set
+// Output:
+//   Return the number of data.
+size_t GSetPackedGetSize_(
+  GSetPacked const* const that) {
+
+  return that->size;
+
+}
+
+// Get the memory used by a compressed set
+// Input:
+//   that: the compressed set
+// Output:
+//   Return the number of bytes allocated for the compressed set.
+size_t GSetPackedGetMemSize_(
+  GSetPacked const* const that) {
+
+  return
+    sizeof(GSetPacked) +
+    that->nbBlock * sizeof(GSetPackedBlock) +
+    that->nbWordAlloc * sizeof(uint64_t);
+
+}
+
+// Decode the data of a compressed set and add them at the tail of a set,
+// one block at a time
+// Inputs:
+//     that: the set
+//   packed: the compressed set
+// Output:
+//   Return the number of data added to the set
+#define GSETUNPACK__(N, T)                                                \
+size_t GSetUnpack_ ## N(                                                  \
+              GSet* const that,                                           \
+  GSetPacked const* const packed) {                                       \
+  if (that->size > SIZE_MAX - packed->size)                               \
+    Raise(TryCatchExc_IntOverflow);                                       \
+  unsigned long block[GSET_PACK_BLOCK];                                   \
+  FOR(iBlock, packed->nbBlock) {                                          \
+    size_t nb = GSetPackedDecodeBlock(packed, iBlock, block);             \
+    GSetAddBlock_ ## N(that, (T const*)block, nb);                        \
+  }                                                                       \
+  return packed->size;                                                    \
+}
+
+GSETUNPACK__(Long, long)
+GSETUNPACK__(ULong, unsigned long)
+
+// Check if a compressed set contains a data
+// Inputs:
+//   that: the compressed set
+//   data: the data
+// Output:
+//   Return true if the data is in the compressed set, else false.
+#define GSETPACKEDCONTAINS__(N, T)                                        \
+bool GSetPackedContains_ ## N(                                            \
+  GSetPacked const* const that,                                           \
+                T const data) {                                           \
+  if (that->isSorted == false) {                                          \
+    unsigned long block[GSET_PACK_BLOCK];                                 \
+    FOR(iBlock, that->nbBlock) {                                          \
+      size_t nb = GSetPackedDecodeBlock(that, iBlock, block);             \
+      FOR(i, nb) if ((T)(block[i]) == data) return true;                  \
+    }                                                                     \
+    return false;                                                         \
+  }                                                                       \
+  size_t lo = 0;                                                          \
+  size_t hi = that->nbBlock;                                              \
+  while (lo < hi) {                                                       \
+    size_t mid = lo + (hi - lo) / 2;                                      \
+    if ((T)(that->blocks[mid].first) <= data) lo = mid + 1;               \
+    else hi = mid;                                                        \
+  }                                                                       \
+  if (lo == 0) return false;                                              \
+  unsigned long dist = (unsigned long)data - that->blocks[lo - 1].first;  \
+  return GSetPackedBlockContains(that, lo - 1, dist);                     \
+}
+
+GSETPACKEDCONTAINS__(Long, long)
+GSETPACKEDCONTAINS__(ULong, unsigned long)
+
+// Allocate memory for a new iterator on a compressed set
+// Input:
+//   type: the type of iteration
+// Output:
+//   Return the new GSetPackedIter.
+GSetPackedIter* GSetPackedIterAlloc(
+  GSetIterType const type) {
+
+  GSetPackedIter* that = NULL;
+  MALLOC(that, sizeof(GSetPackedIter));
+  *that = (GSetPackedIter) {
+
+    .packed = NULL,
+    .iBlock = SIZE_MAX,
+    .pos = SIZE_MAX,
+    .type = type,
+    .filter = { .fun = NULL, .params = NULL },
+
+  };
+  return that;
+
+}
+
+// Free the memory used by an iterator on a compressed set
+// Input:
+//   that: the GSetPackedIter to be freed
+void GSetPackedIterFree_(
+  GSetPackedIter** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Free the memory
+  free(*that);
+  *that = NULL;
+
+}
+
+// Reset an iterator on a compressed set to its first data
+// Inputs:
+//     that: the iterator
+//   packed: the compressed set
+void GSetPackedIterReset_(
+   GSetPackedIter* const that,
+  GSetPacked const* const packed) {
+
+  // Move from before the first data, or after the last one, to the first
+  // data matching the filter
+  that->packed = packed;
+  that->iBlock = SIZE_MAX;
+  switch (that->type) {
+
+    case GSetIterForward:
+      that->pos = SIZE_MAX;
+      if (GSetPackedIterMove(that, 1) == false) that->pos = SIZE_MAX;
+      break;
+
+    case GSetIterBackward:
+      that->pos = packed->size;
+      if (GSetPackedIterMove(that, SIZE_MAX) == false) that->pos = SIZE_MAX;
+      break;
+
+    default:
+      Raise(TryCatchExc_NotYetImplemented);
+
+  }
+
+}
+
+// Check if an iterator on a compressed set is on a data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator is on a data, false else (the set is
+//   empty or no data matches the iterator's filter)
+bool GSetPackedIterIsReady_(
+  GSetPackedIter const* const that) {
+
+  return (that->pos != SIZE_MAX);
+
+}
+
+// Move an iterator on a compressed set to the next data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator could move to the next data, else false
+bool GSetPackedIterNext_(
+  GSetPackedIter* const that) {
+
+  if (that->pos == SIZE_MAX) return false;
+  return GSetPackedIterMove(
+    that,
+    (that->type == GSetIterForward ? 1 : SIZE_MAX));
+
+}
+
+// Move an iterator on a compressed set to the previous data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator could move to the previous data, else false
+bool GSetPackedIterPrev_(
+  GSetPackedIter* const that) {
+
+  if (that->pos == SIZE_MAX) return false;
+  return GSetPackedIterMove(
+    that,
+    (that->type == GSetIterForward ? SIZE_MAX : 1));
+
+}
+
+// Check if an iterator on a compressed set is on its first data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator is on its first data, else false
+bool GSetPackedIterIsFirst_(
+  GSetPackedIter const* const that) {
+
+  if (that->pos == SIZE_MAX) Raise(TryCatchExc_OutOfRange);
+
+  // Try to go the the previous data with a clone of the iterator and
+  // return true if it couldn't move
+  GSetPackedIter clone = *that;
+  return (GSetPackedIterPrev_(&clone) == false);
+
+}
+
+// Check if an iterator on a compressed set is on its last data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator is on its last data, else false
+bool GSetPackedIterIsLast_(
+  GSetPackedIter const* const that) {
+
+  if (that->pos == SIZE_MAX) Raise(TryCatchExc_OutOfRange);
+
+  // Try to go the the next data with a clone of the iterator and return
+  // true if it couldn't move
+  GSetPackedIter clone = *that;
+  return (GSetPackedIterNext_(&clone) == false);
+
+}
+
+// Set the type of an iterator on a compressed set
+// Inputs:
+//   that: the iterator
+//   type: the type
+void GSetPackedIterSetType_(
+  GSetPackedIter* const that,
+     GSetIterType const type) {
+
+  that->type = type;
+
+}
+
+// Get the type of an iterator on a compressed set
+// Input:
+//   that: the iterator
+// Output:
+//   Return the type of the iterator
+GSetIterType GSetPackedIterGetType_(
+  GSetPackedIter const* const that) {
+
+  return that->type;
+
+}
+
+// Set the filter of an iterator on a compressed set. The filter's function
+// receives a pointer to the decoded data and must not modify it.
+// Inputs:
+//     that: the iterator
+//      fun: the filter's function
+//   params: the parameters of the filter's function
+void GSetPackedIterSetFilter_(
+  GSetPackedIter* const that,
+  GSetIterFilterFun fun,
+              void* params) {
+
+  that->filter.fun = fun;
+  that->filter.params = params;
+
+}
+
+// Get the parameters of the filter's function of an iterator on a
+// compressed set
+// Input:
+//   that: the iterator
+// Output:
+//   Return the parameters of the filter's function
+void* GSetPackedIterGetFilterParam_(
+  GSetPackedIter* const that) {
+
+  return that->filter.params;
+
+}
+
+// Count the number of data enumerated by an iterator on a compressed set
+// Inputs:
+//     that: the iterator
+//   packed: the compressed set
+// Output:
+//   Return the number of data
+size_t GSetPackedIterCount_(
+  GSetPackedIter const* const that,
+      GSetPacked const* const packed) {
+
+  // Without filter all the data are enumerated
+  if (that->filter.fun == NULL) return packed->size;
+
+  // Count the data with a clone to leave the iterator unchanged
+  GSetPackedIter clone = *that;
+  size_t nb = 0;
+  GSetPackedIterReset_(&clone, packed);
+  if (clone.pos != SIZE_MAX) {
+
+    nb = 1;
+    while (GSetPackedIterNext_(&clone)) ++nb;
+
+  }
+
+  return nb;
+
+}
+
+// Get the current data of an iterator on a compressed set
+// Input:
+//   that: the iterator
+// Output:
+//   Return the data
+#define GSETPACKEDITERGET__(N, T)                                         \
+T GSetPackedIterGet_ ## N(                                                \
+  GSetPackedIter const* const that) {                                     \
+  if (that->pos == SIZE_MAX) Raise(TryCatchExc_OutOfRange);               \
+  return (T)(that->block[that->pos % GSET_PACK_BLOCK]);                   \
+}
+
+GSETPACKEDITERGET__(Long, long)
+GSETPACKEDITERGET__(ULong, unsigned long)
+
+// Get the current data of an iterator on a compressed set, without
+// raising exception
+// Inputs:
+//   that: the iterator
+//   data: receives the data
+// Output:
+//   If the iterator is on a data, copy it into 'data' and return true.
+//   Else, return false.
+#define GSETPACKEDITERTRYGET__(N, T)                                      \
+bool GSetPackedIterTryGet_ ## N(                                          \
+  GSetPackedIter const* const that,                                       \
+                    T* const data) {                                      \
+  if (that->pos == SIZE_MAX) return false;                                \
+  *data = (T)(that->block[that->pos % GSET_PACK_BLOCK]);                  \
+  return true;                                                            \
+}
+
+GSETPACKEDITERTRYGET__(Long, long)
+GSETPACKEDITERTRYGET__(ULong, unsigned long)
+
+// Map in memory a file saved with GSetSave_<N> and get a read-only view on
+// its data, without copying them
+// Input:
+//   path: the path to the file
+// Output:
+//   Return the new GSetMap.
+#define GSETMAPFILE__(N, T)                                   \
+GSetMap* GSetMapFile_ ## N(                                   \
+  char const* const path) {                                   \
+  return GSetMapOpen(path, GSetKeyType_ ## N, sizeof(T));     \
+}
+
+GSETMAPFILE__(Char, char)
+GSETMAPFILE__(UChar, unsigned char)
+GSETMAPFILE__(Int, int)
+GSETMAPFILE__(UInt, unsigned int)
+GSETMAPFILE__(Long, long)
+GSETMAPFILE__(ULong, unsigned long)
+GSETMAPFILE__(Float, float)
+GSETMAPFILE__(Double, double)
+
+// Unmap the file of a read-only view and free the memory it used
+// Input:
+//   that: the GSetMap to be freed
+void GSetMapFree_(
+  GSetMap** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Free memory
+  munmap((*that)->addr, (*that)->sizeFile);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Get the number of data in a read-only view
+// Input:
+//   that: the view
+// Output:
+//   Return the number of data.
+size_t GSetMapGetSize_(
+  GSetMap const* const that) {
+
+  return that->size;
+
+}
+
+// Get the data of a read-only view as an array
+// Input:
+//   that: the view
+// Output:
+//   Return the array of data, in the mapped file.
+#define GSETMAPGETARR__(N, T)                                 \
+T const* GSetMapGetArr_ ## N(                                 \
+  GSetMap const* const that) {                                \
+  return (T const*)(that->data);                              \
+}
+
+GSETMAPGETARR__(Char, char)
+GSETMAPGETARR__(UChar, unsigned char)
+GSETMAPGETARR__(Int, int)
+GSETMAPGETARR__(UInt, unsigned int)
+GSETMAPGETARR__(Long, long)
+GSETMAPGETARR__(ULong, unsigned long)
+GSETMAPGETARR__(Float, float)
+GSETMAPGETARR__(Double, double)
+
+// Allocate memory for a new iterator on a read-only view
+// Input:
+//   type: the type of iteration
+// Output:
+//   Return the new GSetMapIter.
+GSetMapIter* GSetMapIterAlloc(
+  GSetIterType const type) {
+
+  GSetMapIter* that = NULL;
+  MALLOC(that, sizeof(GSetMapIter));
+  *that = (GSetMapIter) {
+
+    .map = NULL,
+    .pos = SIZE_MAX,
+    .type = type,
+    .filter = { .fun = NULL, .params = NULL },
+
+  };
+  return that;
+
+}
+
+// Free the memory used by an iterator on a read-only view
+// Input:
+//   that: the GSetMapIter to be freed
+void GSetMapIterFree_(
+  GSetMapIter** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Free the memory
+  free(*that);
+  *that = NULL;
+
+}
+
+// Reset an iterator on a read-only view to its first data
+// Inputs:
+//   that: the iterator
+//    map: the view
+void GSetMapIterReset_(
+  GSetMapIter* const that,
+  GSetMap const* const map) {
+
+  // Move from before the first data, or after the last one, to the first
+  // data matching the filter
+  that->map = map;
+  switch (that->type) {
+
+    case GSetIterForward:
+      that->pos = SIZE_MAX;
+      if (GSetMapIterMove(that, 1) == false) that->pos = SIZE_MAX;
+      break;
+
+    case GSetIterBackward:
+      that->pos = map->size;
+      if (GSetMapIterMove(that, SIZE_MAX) == false) that->pos = SIZE_MAX;
+      break;
+
+    default:
+      Raise(TryCatchExc_NotYetImplemented);
+
+  }
+
+}
+
+// Check if an iterator on a read-only view is on a data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator is on a data, false else (the view is
+//   empty or no data matches the iterator's filter)
+bool GSetMapIterIsReady_(
+  GSetMapIter const* const that) {
+
+  return (that->pos != SIZE_MAX);
+
+}
+
+// Move an iterator on a read-only view to the next data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator could move to the next data, else false
+bool GSetMapIterNext_(
+  GSetMapIter* const that) {
+
+  if (that->pos == SIZE_MAX) return false;
+  return GSetMapIterMove(
+    that,
+    (that->type == GSetIterForward ? 1 : SIZE_MAX));
+
+}
+
+// Move an iterator on a read-only view to the previous data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator could move to the previous data, else false
+bool GSetMapIterPrev_(
+  GSetMapIter* const that) {
+
+  if (that->pos == SIZE_MAX) return false;
+  return GSetMapIterMove(
+    that,
+    (that->type == GSetIterForward ? SIZE_MAX : 1));
+
+}
+
+// Check if an iterator on a read-only view is on its first data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator is on its first data, else false
+bool GSetMapIterIsFirst_(
+  GSetMapIter const* const that) {
+
+  if (that->pos == SIZE_MAX) Raise(TryCatchExc_OutOfRange);
+
+  // Try to go the the previous data with a clone of the iterator and
+  // return true if it couldn't move
+  GSetMapIter clone = *that;
+  return (GSetMapIterPrev_(&clone) == false);
+
+}
+
+// Check if an iterator on a read-only view is on its last data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator is on its last data, else false
+bool GSetMapIterIsLast_(
+  GSetMapIter const* const that) {
+
+  if (that->pos == SIZE_MAX) Raise(TryCatchExc_OutOfRange);
+
+  // Try to go the the next data with a clone of the iterator and return
+  // true if it couldn't move
+  GSetMapIter clone = *that;
+  return (GSetMapIterNext_(&clone) == false);
+
+}
+
+// Set the type of an iterator on a read-only view
+// Inputs:
+//   that: the iterator
+//   type: the type
+void GSetMapIterSetType_(
+  GSetMapIter* const that,
+  GSetIterType const type) {
+
+  that->type = type;
+
+}
+
+// Get the type of an iterator on a read-only view
+// Input:
+//   that: the iterator
+// Output:
+//   Return the type of the iterator
+GSetIterType GSetMapIterGetType_(
+  GSetMapIter const* const that) {
+
+  return that->type;
+
+}
+
+// Set the filter of an iterator on a read-only view. The filter's function
+// receives a pointer to the data in the mapped file and must not modify it.
+// Inputs:
+//     that: the iterator
+//      fun: the filter's function
+//   params: the parameters of the filter's function
+void GSetMapIterSetFilter_(
+  GSetMapIter* const that,
+  GSetIterFilterFun fun,
+              void* params) {
+
+  that->filter.fun = fun;
+  that->filter.params = params;
+
+}
+
+// Get the parameters of the filter's function of an iterator on a
+// read-only view
+// Input:
+//   that: the iterator
+// Output:
+//   Return the parameters of the filter's function
+void* GSetMapIterGetFilterParam_(
+  GSetMapIter* const that) {
+
+  return that->filter.params;
+
+}
+
+// Count the number of data enumerated by an iterator on a read-only view
+// Inputs:
+//   that: the iterator
+//    map: the view
+// Output:
+//   Return the number of data
+size_t GSetMapIterCount_(
+  GSetMapIter const* const that,
+      GSetMap const* const map) {
+
+  // Without filter all the data are enumerated
+  if (that->filter.fun == NULL) return map->size;
+
+  // Count the data with a clone to leave the iterator unchanged
+  GSetMapIter clone = *that;
+  size_t nb = 0;
+  GSetMapIterReset_(&clone, map);
+  if (clone.pos != SIZE_MAX) {
+
+    nb = 1;
+    while (GSetMapIterNext_(&clone)) ++nb;
+
+  }
+
+  return nb;
+
+}
+
+// Get the current data of an iterator on a read-only view
+// Input:
+//   that: the iterator
+// Output:
+//   Return the data
+#define GSETMAPITERGET__(N, T)                                \
+T GSetMapIterGet_ ## N(                                       \
+  GSetMapIter const* const that) {                            \
+  if (that->pos == SIZE_MAX) Raise(TryCatchExc_OutOfRange);   \
+  return ((T const*)(that->map->data))[that->pos];            \
+}
+
+GSETMAPITERGET__(Char, char)
+GSETMAPITERGET__(UChar, unsigned char)
+GSETMAPITERGET__(Int, int)
+GSETMAPITERGET__(UInt, unsigned int)
+GSETMAPITERGET__(Long, long)
+GSETMAPITERGET__(ULong, unsigned long)
+GSETMAPITERGET__(Float, float)
+GSETMAPITERGET__(Double, double)
+
+// Get the current data of an iterator on a read-only view, without raising
+// exception
+// Inputs:
+//   that: the iterator
+//   data: receives the data
+// Output:
+//   If the iterator is on a data, copy it into 'data' and return true.
+//   Else, return false.
+#define GSETMAPITERTRYGET__(N, T)                             \
+bool GSetMapIterTryGet_ ## N(                                 \
+  GSetMapIter const* const that,                              \
+                 T* const data) {                             \
+  if (that->pos == SIZE_MAX) return false;                    \
+  *data = ((T const*)(that->map->data))[that->pos];           \
+  return true;                                                \
+}
+
+GSETMAPITERTRYGET__(Char, char)
+GSETMAPITERTRYGET__(UChar, unsigned char)
+GSETMAPITERTRYGET__(Int, int)
+GSETMAPITERTRYGET__(UInt, unsigned int)
+GSETMAPITERTRYGET__(Long, long)
+GSETMAPITERTRYGET__(ULong, unsigned long)
+GSETMAPITERTRYGET__(Float, float)
+GSETMAPITERTRYGET__(Double, double)
+
+// Attach a hash index to a set
+// Input:
+//   that: the set
+#define GSETATTACHINDEX__(N, T)                      \
+void GSetAttachIndex_ ## N(                          \
+  GSet* const that) {                                \
+  GSetIndexAttach(that, GSetKeyType_ ## N, NULL, NULL); \
+}
+
+GSETATTACHINDEX__(Char, char)
+GSETATTACHINDEX__(UChar, unsigned char)
+GSETATTACHINDEX__(Int, int)
+GSETATTACHINDEX__(UInt, unsigned int)
+GSETATTACHINDEX__(Long, long)
+GSETATTACHINDEX__(ULong, unsigned long)
+GSETATTACHINDEX__(Float, float)
+GSETATTACHINDEX__(Double, double)
+GSETATTACHINDEX__(Ptr, void*)
+
+// Attach a hash index to a set of pointers using user defined hash and
+// equality functions
+// Inputs:
+//   that: the set
+//   hash: the hash function
+//     eq: the equality function
+void GSetAttachIndexWith_(
+  GSet* const that,
+   GSetHashFun hash,
+     GSetEqFun eq) {
+
+  GSetIndexAttach(
+    that,
+    GSetKeyType_User,
+    hash,
+    eq);
+
+}
+
+// Detach and free the hash index of a set, if any
+// Input:
+//   that: the set
+void GSetDetachIndex_(
+  GSet* const that) {
+
+  GSetIndexFree(&(that->index));
+
+}
+
+// Check if a set has a hash index
+// Input:
+//   that: the set
+// Output:
+//   Return true if the set has a hash index, false else
+bool GSetHasIndex_(
+  GSet const* const that) {
+
+  return (that->index != NULL);
+
+}
+
+// Search an element containing a data in a set, using the hash index if
+// any, else by linear search
+// Inputs:
+//   that: the set
+//   data: the data
+// Output:
+//   Return the element, or NULL if the data was not found
+#define GSETSEARCH__(N, T)                                 \
+static GSetElem* GSetSearch_ ## N(                         \
+  GSet const* const that,                                  \
+            T const data) {                                \
+  if (that->index != NULL) {                               \
+    union GSetElemData key = {.N = data};                  \
+    return GSetIndexSearch(that->index, &key);             \
+  }                                                        \
+  GSetElem* ptr = that->first;                             \
+  while (ptr != NULL && ptr->data.N != data)               \
+    ptr = ptr->next;                                       \
+  return ptr;                                              \
+}
+
+// Check if a set contains a data
+// Inputs:
+//   that: the set
+//   data: the data
+// Output:
+//   Return true if the data is in the set, else false
+#define GSETCONTAINS__(N, T)                               \
+bool GSetContains_ ## N(                                   \
+  GSet const* const that,                                  \
+            T const data) {                                \
+  return (GSetSearch_ ## N(that, data) != NULL);           \
+}
+
+// Move an iterator to an element containing a data
+// Inputs:
+//   that: the iterator
+//    set: the associated set
+//   data: the data
+// Output:
+//   Return true if the data was found, else false
+#define GSETITERFIND__(N, T)                               \
+bool GSetIterFind_ ## N(                                   \
+     GSetIter* const that,                                 \
+  GSet const* const set,                                   \
+            T const data) {                                \
+  GSetElem* elem = NULL;                                   \
+  if (set->index != NULL && that->filter.fun == NULL) {    \
+    elem = GSetSearch_ ## N(set, data);                    \
+  } else {                                                 \
+    union GSetElemData key = {.N = data};                  \
+    GSetIter iter = *that;                                 \
+    GSetIterReset_(&iter, set);                            \
+    elem = iter.elem;                                      \
+    while (elem != NULL &&                                 \
+      (set->index != NULL ?                                \
+        !GSetIndexEq(set->index, &(elem->data), &key) :    \
+        elem->data.N != data))                             \
+      elem = (GSetIterNext_(&iter) ? iter.elem : NULL);    \
+  }                                                        \
+  if (elem == NULL) return false;                          \
+  that->elem = elem;                                       \
+  return true;                                             \
+}
+
+// Remove one element containing a data from a set
+// Inputs:
+//   that: the set
+//   data: the data
+// Output:
+//   Return true if an element was removed, false if the data was not found
+#define GSETREMOVE__(N, T)                                 \
+bool GSetRemove_ ## N(                                     \
+  GSet* const that,                                        \
+      T const data) {                                      \
+  GSetElem* elem = GSetSearch_ ## N(that, data);           \
+  if (elem == NULL) return false;                          \
+  GSetRemoveElem(that, elem);                              \
+  GSetElemRelease(that, &elem);                            \
+  return true;                                             \
+}
+
+#define GSETINDEXFUNS__(N, T) \
+  GSETSEARCH__(N, T)          \
+  GSETCONTAINS__(N, T)        \
+  GSETITERFIND__(N, T)        \
+  GSETREMOVE__(N, T)
+
+GSETINDEXFUNS__(Char, char)
+GSETINDEXFUNS__(UChar, unsigned char)
+GSETINDEXFUNS__(Int, int)
+GSETINDEXFUNS__(UInt, unsigned int)
+GSETINDEXFUNS__(Long, long)
+GSETINDEXFUNS__(ULong, unsigned long)
+GSETINDEXFUNS__(Float, float)
+GSETINDEXFUNS__(Double, double)
+GSETINDEXFUNS__(Ptr, void*)
+
+// Insert a data in a sorted set at its sorted position, after the data
+// equal to it
+// Inputs:
+//   that: the set, sorted according to cmp
+//   data: the data
+//    cmp: the comparison function
+#define GSETINSERTSORTED__(N, T)                                             \
+void GSetInsertSorted_ ## N(                                                 \
+       GSet* const that,                                                     \
+          T const data,                                                      \
+  int (* const cmp)(void const*, void const*)) {                             \
+  if (that->size > SIZE_MAX - 1) Raise(TryCatchExc_IntOverflow);             \
+  GSetSkipList* skipList = GSetSkipListGet(that, cmp);                       \
+  GSetSkipNode* update[GSET_SKIP_MAX_LEVEL];                                 \
+  GSetSkipNode* next = GSetSkipListSearch(skipList, &data, true, update);    \
+  size_t nbLevel = GSetSkipListRandLevel(skipList);                          \
+  GSetSkipNode* node = GSetSkipNodeAlloc(NULL, nbLevel);                     \
+  Try {                                                                      \
+    node->elem = GSetElemTake(that);                                         \
+  } CatchDefault {                                                           \
+    free(node);                                                              \
+  } EndCatch;                                                                \
+  ForwardExc();                                                              \
+  node->elem->data.N = data;                                                 \
+  that->skipList = NULL;                                                     \
+  Try {                                                                      \
+    if (next != NULL) GSetElemAddElemBefore(next->elem, node->elem, that);   \
+    else GSetAddElem(that, node->elem);                                      \
+  } CatchDefault {                                                           \
+    free(node);                                                              \
+    GSetSkipListFree(&skipList);                                             \
+  } EndCatch;                                                                \
+  ForwardExc();                                                              \
+  that->skipList = skipList;                                                 \
+  for (size_t iLvl = skipList->nbLevel; iLvl < node->nbLevel; ++iLvl)        \
+    update[iLvl] = skipList->head;                                           \
+  if (skipList->nbLevel < node->nbLevel) skipList->nbLevel = node->nbLevel;  \
+  FOR(iLvl, node->nbLevel) {                                                 \
+    node->next[iLvl] = update[iLvl]->next[iLvl];                             \
+    update[iLvl]->next[iLvl] = node;                                         \
+  }                                                                          \
+}
+
+// Move an iterator on the first element of a sorted set whose data is not
+// lower than a data
+// Inputs:
+//   that: the iterator
+//    set: the set, sorted according to cmp
+//   data: the data
+//    cmp: the comparison function
+// Output:
+//   Return true if the iterator has been moved, false if there is no such
+//   element
+#define GSETLOWERBOUND__(N, T)                                               \
+bool GSetIterLowerBound_ ## N(                                               \
+  GSetIter* const that,                                                      \
+       GSet* const set,                                                      \
+          T const data,                                                      \
+  int (* const cmp)(void const*, void const*)) {                             \
+  return GSetIterBound(that, set, &data, cmp, false);                        \
+}
+
+// Move an iterator on the first element of a sorted set whose data is
+// greater than a data
+// Inputs:
+//   that: the iterator
+//    set: the set, sorted according to cmp
+//   data: the data
+//    cmp: the comparison function
+// Output:
+//   Return true if the iterator has been moved, false if there is no such
+//   element
+#define GSETUPPERBOUND__(N, T)                                               \
+bool GSetIterUpperBound_ ## N(                                               \
+  GSetIter* const that,                                                      \
+       GSet* const set,                                                      \
+          T const data,                                                      \
+  int (* const cmp)(void const*, void const*)) {                             \
+  return GSetIterBound(that, set, &data, cmp, true);                         \
+}
+
+#define GSETSORTEDFUNS__(N, T) \
+  GSETINSERTSORTED__(N, T)     \
+  GSETLOWERBOUND__(N, T)       \
+  GSETUPPERBOUND__(N, T)
+
+GSETSORTEDFUNS__(Char, char)
+GSETSORTEDFUNS__(UChar, unsigned char)
+GSETSORTEDFUNS__(Int, int)
+GSETSORTEDFUNS__(UInt, unsigned int)
+GSETSORTEDFUNS__(Long, long)
+GSETSORTEDFUNS__(ULong, unsigned long)
+GSETSORTEDFUNS__(Float, float)
+GSETSORTEDFUNS__(Double, double)
+GSETSORTEDFUNS__(Ptr, void*)
+
+// Deallocation functions for GSet<N>Flush on default typed GSet
+
+#define FREE_(N, T)                                                          \
+void N ## Free(T* const that) {                                              \
+  if (that == NULL || *that == NULL) return;                                 \
+  free(*that); *that = NULL;                                                 \
+}
+
+FREE_(CharPtr, char*)
+FREE_(UCharPtr, unsigned char*)
+FREE_(IntPtr, int*)
+FREE_(UIntPtr, unsigned int*)
+FREE_(LongPtr, long*)
+FREE_(ULongPtr, unsigned long*)
+FREE_(FloatPtr, float*)
+FREE_(DoublePtr, double*)
+FREE_(Str, char*)
+
+// Comparison functions for GSet<N>Sort on default typed GSet
+
+int GSetCharCmp(
+  void const* a,
+  void const* b) {
+
+  return (*(char const*)a < *(char const*)b ? -1 :
+          *(char const*)a > *(char const*)b ? 1 : 0);
+
+}
+
+int GSetUCharCmp(
+  void const* a,
+  void const* b) {
+
+  return (*(unsigned char const*)a < *(unsigned char const*)b ? -1 :
+          *(unsigned char const*)a > *(unsigned char const*)b ? 1 : 0);
+
+}
+
+int GSetIntCmp(
+  void const* a,
+  void const* b) {
+
+  return (*(int const*)a < *(int const*)b ? -1 :
+          *(int const*)a > *(int const*)b ? 1 : 0);
+
+}
+
+int GSetUIntCmp(
+  void const* a,
+  void const* b) {
+
+  return (*(unsigned int const*)a < *(unsigned int const*)b ? -1 :
+          *(unsigned int const*)a > *(unsigned int const*)b ? 1 : 0);
+
+}
+
+int GSetLongCmp(
+  void const* a,
+  void const* b) {
+
+  return (*(long const*)a < *(long const*)b ? -1 :
+          *(long const*)a > *(long const*)b ? 1 : 0);
+
+}
+
+int GSetULongCmp(
+  void const* a,
+  void const* b) {
+
+  return (*(unsigned long const*)a < *(unsigned long const*)b ? -1 :
+          *(unsigned long const*)a > *(unsigned long const*)b ? 1 : 0);
+
+}
+
+int GSetFloatCmp(
+  void const* a,
+  void const* b) {
+
+  float x = *(float*)a;
+  float y = *(float*)b;
+  if ((x - y) > DBL_EPSILON) return 1;
+  else if ((x - y) < -DBL_EPSILON) return -1;
+  else return 0;
+
+}
+
+int GSetDoubleCmp(
+  void const* a,
+  void const* b) {
+
+  double x = *(double*)a;
+  double y = *(double*)b;
+  if ((x - y) > DBL_EPSILON) return 1;
+  else if ((x - y) < -DBL_EPSILON) return -1;
+  else return 0;
+
+}
+
+int GsetCharPtrCmp(
+  void const* a,
+  void const* b) {
+
+  char const* sa = *(char* const*)a;
+  char const* sb = *(char* const*)b;
+  if (sa == NULL && sb == NULL) return 0;
+  if (sa == NULL && sb != NULL) return -1;
+  if (sa != NULL && sb == NULL) return 1;
+  return strcmp(
+    sa,
+    sb);
+
+}
+
+// ================== Private functions definition =========================
+
+// Create a new GSetElem
+// Output:
+//   Return the new GSetElem.
+static GSetElem GSetElemCreate(
+  void) {
+
+  // Create the GSetElem
+  GSetElem that = (GSetElem) {
+
+    .prev = NULL,
+    .next = NULL,
+
+  };
+
+  // Return the GSetElem
+  return that;
+
+}
+
+// Allocate memory for a new GSetElem
+// Output:
+//   Return the new GSetElem.
+static GSetElem* GSetElemAlloc(
+  void) {
+
+  // Take the next slot of the slab of the thread
+  GSetElem* that = GSetSlabAllocSlot();
+
+  // Create the element
+  *that = GSetElemCreate();
+
+  // Return the new GSetElem
+  return that;
+
+}
+
+// Free the memory used by a GSetElem, do not free the memory used by the data
+// it contains.
+// Input:
+//   that: the GSetElem to be freed
+static void GSetElemFree(
+  GSetElem** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Give back the element to its slab
+  GSetSlab* slab =
+    (GSetSlab*)((uintptr_t)(*that) & ~(uintptr_t)(GSET_SLAB_SIZE - 1));
+  GSetSlabFree(slab, *that, *that, 1);
+  *that = NULL;
+
+}
+
+// Allocate memory for a chain of new GSetElem, linked together, and copy
+// in them the data of a chain of existing elements. The elements are taken
+// from the slabs by runs and the data copied in a straight loop, without
+// exception frame
+// Inputs:
+//    src: the first element of the existing chain
+//     nb: the number of elements, greater than 0 and not greater than the
+//         number of elements in the existing chain
+//   last: receives the last element of the new chain
+// Output:
+//   Return the first element of the new chain
+static GSetElem* GSetElemAllocCopy(
+  GSetElem const* src,
+     size_t const nb,
+  GSetElem** const last) {
+
+  GSetElem* first = NULL;
+  GSetElem* prev = NULL;
+  size_t nbAlloc = 0;
+  while (nbAlloc < nb) {
+
+    // Take as many elements as possible in the slab of the thread. If the
+    // allocation fails, free the part of the chain already allocated
+    size_t nbSlab = 0;
+    GSetElem* elems = GSetSlabAllocRun(nb - nbAlloc, &nbSlab);
+    if (elems == NULL) {
+
+      if (prev != NULL) prev->next = NULL;
+      GSetElemFreeChain(first);
+      Raise(TryCatchExc_MallocFailed);
+
+    }
+
+    // Link the elements and copy the data in a single pass
+    if (prev != NULL) prev->next = elems;
+    else first = elems;
+    FOR(iElem, nbSlab) {
+
+      elems[iElem].data = src->data;
+      elems[iElem].prev = prev;
+      elems[iElem].next = elems + iElem + 1;
+      prev = elems + iElem;
+      src = src->next;
+
+    }
+
+    nbAlloc += nbSlab;
+
+  }
+
+  prev->next = NULL;
+  *last = prev;
+  return first;
+
+}
+
+// Allocate memory for a chain of new GSetElem, linked together, whose data
+// are left to be set by the caller
+// Inputs:
+//     nb: the number of elements, greater than 0
+//   last: receives the last element of the chain
+// Output:
+//   Return the first element of the chain
+static GSetElem* GSetElemAllocChain(
+      size_t const nb,
+  GSetElem** const last) {
+
+  GSetElem* first = NULL;
+  GSetElem* prev = NULL;
+  size_t nbAlloc = 0;
+  while (nbAlloc < nb) {
+
+    // Take as many elements as possible in the slab of the thread. If the
+    // allocation fails, free the part of the chain already allocated
+    size_t nbSlab = 0;
+    GSetElem* elems = GSetSlabAllocRun(nb - nbAlloc, &nbSlab);
+    if (elems == NULL) {
+
+      if (prev != NULL) prev->next = NULL;
+      GSetElemFreeChain(first);
+      Raise(TryCatchExc_MallocFailed);
+
+    }
+
+    // Link the elements
+    if (prev != NULL) prev->next = elems;
+    else first = elems;
+    FOR(iElem, nbSlab) {
+
+      elems[iElem].prev = prev;
+      elems[iElem].next = elems + iElem + 1;
+      prev = elems + iElem;
+
+    }
+
+    nbAlloc += nbSlab;
+
+  }
+
+  prev->next = NULL;
+  *last = prev;
+  return first;
+
+}
+
+// Free the memory used by a chain of GSetElem, do not free the memory used
+// by the data they contain
+// Input:
+//   that: the first element of the chain, the chain ends with a NULL next
+static void GSetElemFreeChain(
+  GSetElem* that) {
+
+  // Give back the consecutive elements of a same slab at once, they are
+  // already linked by their 'next'
+  GSetSlab* slab = NULL;
+  GSetElem* first = NULL;
+  GSetElem* last = NULL;
+  size_t nb = 0;
+  while (that != NULL) {
+
+    GSetElem* next = that->next;
+    GSetSlab* slabElem =
+      (GSetSlab*)((uintptr_t)that & ~(uintptr_t)(GSET_SLAB_SIZE - 1));
+    if (slabElem != slab) {
+
+      if (slab != NULL) GSetSlabFree(slab, first, last, nb);
+      slab = slabElem;
+      first = that;
+      nb = 0;
+
+    }
+
+    last = that;
+    ++nb;
+    that = next;
+
+  }
+
+  if (slab != NULL) GSetSlabFree(slab, first, last, nb);
+
+}
+
+// Get an element for a new data in a set, taken from the spare elements of
+// a bounded set or newly allocated. Raise TryCatchExc_OutOfRange if the set
+// is bounded and full.
+// Input:
+//   that: the set
+// Output:
+//   Return the element
+static GSetElem* GSetElemTake(
+  GSet* const that) {
+
+  // If the set is unbounded or has no spare element, allocate a new one
+  if (that->capacity == 0) return GSetElemAlloc();
+  if (that->size >= that->capacity) Raise(TryCatchExc_OutOfRange);
+  if (that->spare == NULL) return GSetElemAlloc();
+
+  // Take the first spare element
+  GSetElem* elem = that->spare;
+  that->spare = elem->next;
+  --(that->nbSpare);
+  *elem = GSetElemCreate();
+  return elem;
+
+}
+
+// Get an element for a new data added at the head or tail of a set. If the
+// set is bounded, full and its policy is GSetBounded_Overwrite, the element
+// at the other end of the set is removed and returned (or retired, and the
+// element taken as with GSetElemTake, in concurrent-read mode), else the
+// element is taken as with GSetElemTake.
+// Inputs:
+//     that: the set
+//   atHead: true if the data is added at the head, false if at the tail
+// Output:
+//   Return the element
+static GSetElem* GSetElemTakeAtEnd(
+       GSet* const that,
+  bool const atHead) {
+
+  // If the set is full and overwrites its data, reuse the element at the
+  // other end
+  if (
+    that->capacity > 0 &&
+    that->size >= that->capacity &&
+    that->policy == GSetBounded_Overwrite
+  ) {
+
+    // In concurrent-read mode, readers may still be on the element, it is
+    // retired and the new data gets another element
+    GSetElem* elem = (atHead ? GSetDropElem(that) : GSetPopElem(that));
+    if (that->epoch != NULL) {
+
+      GSetElemRelease(that, &elem);
+      return GSetElemTake(that);
+
+    }
+
+    *elem = GSetElemCreate();
+    return elem;
+
+  }
+
+  // Else, take the element as usual
+  return GSetElemTake(that);
+
+}
+
+// Release an element removed from a set. It is kept as a spare element if
+// the set is bounded and misses spare elements, else it is freed.
+// Inputs:
+//   that: the set
+//   elem: the element
+static void GSetElemRelease(
+       GSet* const that,
+  GSetElem** const elem) {
+
+  // In concurrent-read mode, readers may still be on the element
+  if (that->epoch != NULL) {
+
+    GSetEpochRetire(that, *elem);
+    *elem = NULL;
+    return;
+
+  }
+
+  if (that->capacity > 0 && that->size + that->nbSpare < that->capacity) {
+
+    (*elem)->next = that->spare;
+    that->spare = *elem;
+    ++(that->nbSpare);
+    *elem = NULL;
+
+  } else GSetElemFree(elem);
+
+}
+
+// Release a chain of elements removed from a set, as with GSetElemRelease
+// Inputs:
+//    that: the set
+//   first: the first element of the chain
+//    last: the last element of the chain, its next pointer is NULL
+//      nb: the number of elements in the chain
+static void GSetElemReleaseChain(
+       GSet* const that,
+   GSetElem* const first,
+   GSetElem* const last,
+  size_t const nb) {
+
+  // In concurrent-read mode, readers may still be on the elements
+  if (that->epoch != NULL) {
+
+    GSetElem* elem = first;
+    for (size_t i = 0; i < nb; ++i) {
+
+      GSetElem* next = elem->next;
+      GSetEpochRetire(that, elem);
+      elem = next;
+
+    }
+
+    return;
+
+  }
+
+  if (
+    that->capacity > 0 &&
+    that->size + that->nbSpare + nb <= that->capacity
+  ) {
+
+    last->next = that->spare;
+    that->spare = first;
+    that->nbSpare += nb;
+
+  } else GSetElemFreeChain(first);
+
+}
+
+// Allocate a new slab for the thread and make it its current slab
+// Output:
+//   Return the new slab, or NULL if the allocation failed
+static GSetSlab* GSetSlabNew(
+  void) {
+
+  // At the first slab of the thread, give it an identifier and make sure
+  // its slabs will be released when it exits
+  if (GSetSlabThread == 0) {
+
+    if (pthread_once(&GSetSlabKeyOnce, GSetSlabKeyCreate) != 0) return NULL;
+    if (
+      GSetSlabHasKey &&
+      pthread_setspecific(GSetSlabKey, &GSetSlabThread) != 0
+    ) {
+
+      return NULL;
+
+    }
+
+    GSetSlabThread =
+      atomic_fetch_add_explicit(
+        &GSetSlabNbThread, 1, memory_order_relaxed) + 1;
+
+  }
+
+  // Allocate the new slab
+  GSetSlab* slab = aligned_alloc(GSET_SLAB_SIZE, GSET_SLAB_SIZE);
+  if (slab == NULL) return NULL;
+  atomic_init(&(slab->nbRef), GSET_SLAB_NB_ELEM + 1);
+  atomic_init(&(slab->remote), NULL);
+  slab->owner = GSetSlabThread;
+  slab->next = 0;
+  slab->local = NULL;
+  slab->nbLocal = 0;
+
+  // Add it to the slabs of the thread
+  slab->prevOwned = NULL;
+  slab->nextOwned = GSetSlabOwned;
+  if (GSetSlabOwned != NULL) GSetSlabOwned->prevOwned = slab;
+  GSetSlabOwned = slab;
+  GSetSlabCur = slab;
+  return slab;
+
+}
+
+// Give the thread a current slab with a free slot: the current one after
+// taking back the slots freed by other threads, another slab of the thread
+// with enough free slots, or a new slab
+// Output:
+//   Return the slab, or NULL if the allocation failed
+static GSetSlab* GSetSlabRefill(
+  void) {
+
+  // Take back the slots of the current slab freed by other threads
+  if (GSetSlabCur != NULL && GSetSlabCollect(GSetSlabCur))
+    return GSetSlabCur;
+
+  // Look for another slab of the thread with at least a quarter of free
+  // slots, visiting a few slabs only and starting where the previous search
+  // stopped, to keep the search in constant time
+  FOR(iScan, GSET_SLAB_NB_SCAN) {
+
+    if (GSetSlabScan == NULL) GSetSlabScan = GSetSlabOwned;
+    GSetSlab* slab = GSetSlabScan;
+    if (slab == NULL) break;
+    GSetSlabScan = slab->nextOwned;
+    if (slab == GSetSlabCur) continue;
+
+    // A slab with no allocated element is reused as if it was new. No
+    // other thread is using it
+    size_t nbLive = GSetSlabNbLive(slab);
+    if (nbLive == 0) {
+
+      atomic_store_explicit(
+        &(slab->nbRef), GSET_SLAB_NB_ELEM + 1, memory_order_relaxed);
+      atomic_store_explicit(&(slab->remote), NULL, memory_order_relaxed);
+      slab->next = 0;
+      slab->local = NULL;
+      slab->nbLocal = 0;
+      GSetSlabCur = slab;
+      return slab;
+
+    }
+
+    if (
+      nbLive <= GSET_SLAB_NB_ELEM - GSET_SLAB_NB_ELEM / 4 &&
+      (
+        slab->local != NULL || slab->next < GSET_SLAB_NB_ELEM ||
+        GSetSlabCollect(slab))
+    ) {
+
+      GSetSlabCur = slab;
+      return slab;
+
+    }
+
+  }
+
+  // Else allocate a new slab
+  return GSetSlabNew();
+
+}
+
+// Take back the slots of a slab of the thread freed by other threads
+// Input:
+//   that: the slab
+// Output:
+//   Return true if slots have been taken back
+static bool GSetSlabCollect(
+  GSetSlab* const that) {
+
+  GSetElem* first =
+    atomic_exchange_explicit(&(that->remote), NULL, memory_order_acquire);
+  if (first == NULL) return false;
+
+  // The slots become free slots kept by the thread, add them to the
+  // references of the slab
+  GSetElem* last = first;
+  size_t nb = 1;
+  while (last->next != NULL) {
+
+    last = last->next;
+    ++nb;
+
+  }
+
+  last->next = that->local;
+  that->local = first;
+  that->nbLocal += nb;
+  atomic_fetch_add_explicit(&(that->nbRef), nb, memory_order_relaxed);
+  return true;
+
+}
+
+// Get the number of elements allocated and not freed yet in a slab of the
+// thread. It may be temporarily overestimated while other threads are
+// freeing elements of the slab.
+// Input:
+//   that: the slab
+// Output:
+//   Return the number of elements
+static size_t GSetSlabNbLive(
+  GSetSlab const* const that) {
+
+  size_t nbRef =
+    atomic_load_explicit(&(that->nbRef), memory_order_acquire);
+  return nbRef - (GSET_SLAB_NB_ELEM - that->next) - that->nbLocal - 1;
+
+}
+
+// Remove a slab with no allocated element from the slabs of the thread and
+// free it
+// Input:
+//   that: the slab
+static void GSetSlabDrop(
+  GSetSlab* const that) {
+
+  if (GSetSlabScan == that) GSetSlabScan = that->nextOwned;
+  if (that->prevOwned != NULL) that->prevOwned->nextOwned = that->nextOwned;
+  else GSetSlabOwned = that->nextOwned;
+  if (that->nextOwned != NULL) that->nextOwned->prevOwned = that->prevOwned;
+  free(that);
+
+}
+
+// Give back to their slab the slots of freed elements
+// Inputs:
+//   that: the slab
+//  first: the first slot, the slots are linked by their 'next'
+//   last: the last slot
+//     nb: the number of slots
+static void GSetSlabFree(
+   GSetSlab* const that,
+   GSetElem* const first,
+   GSetElem* const last,
+  size_t const nb) {
+
+  // If the thread owns the slab, keep the slots in its private list, and
+  // free the slab if it has no more allocated elements and is not the
+  // current one
+  if (that->owner == GSetSlabThread) {
+
+    last->next = that->local;
+    that->local = first;
+    that->nbLocal += nb;
+    if (that != GSetSlabCur && GSetSlabNbLive(that) == 0)
+      GSetSlabDrop(that);
+    return;
+
+  }
+
+  // Else push the slots in the shared list of the slab, then release their
+  // references. The slab must not be used anymore after the release
+  GSetElem* head =
+    atomic_load_explicit(&(that->remote), memory_order_relaxed);
+  do {
+
+    last->next = head;
+
+  } while (
+    !atomic_compare_exchange_weak_explicit(
+      &(that->remote), &head, first,
+      memory_order_release, memory_order_relaxed));
+
+  GSetSlabRelease(that, nb);
+
+}
+
+// Release references on a slab, and free it if it has no more references
+// Inputs:
+//   that: the slab
+//     nb: the number of references
+static void GSetSlabRelease(
+  GSetSlab* const that,
+     size_t const nb) {
+
+  size_t nbRef =
+    atomic_fetch_sub_explicit(&(that->nbRef), nb, memory_order_acq_rel);
+  if (nbRef == nb) free(that);
+
+}
+
+// Release the slabs of a thread when it exits
+// Input:
+//   unused: unused, for compatibility with the destructors of pthread keys
+static void GSetSlabThreadExit(
+  void* unused) {
+
+  (void)unused;
+
+  // Release the reference of the thread and the ones of the free slots it
+  // keeps. The slabs are freed now if they have no allocated element, else
+  // by the thread freeing their last element. Elements freed afterward by
+  // this thread are given back as by any other thread
+  GSetSlab* slab = GSetSlabOwned;
+  while (slab != NULL) {
+
+    GSetSlab* nextOwned = slab->nextOwned;
+    GSetSlabRelease(
+      slab, GSET_SLAB_NB_ELEM - slab->next + slab->nbLocal + 1);
+    slab = nextOwned;
+
+  }
+
+  GSetSlabThread = 0;
+  GSetSlabOwned = NULL;
+  GSetSlabCur = NULL;
+  GSetSlabScan = NULL;
+
+}
+
+// Release the slabs of the thread calling exit()
+static void GSetSlabAtExit(
+  void) {
+
+  GSetSlabThreadExit(NULL);
+
+}
+
+// Create the key used to release the slabs of a thread when it exits. The
+// main thread doesn't call the key's destructor when it returns, exit()
+// releases its slabs instead
+static void GSetSlabKeyCreate(
+  void) {
+
+  // If the key can't be created, slabs of exiting threads are not freed
+  GSetSlabHasKey =
+    (pthread_key_create(&GSetSlabKey, GSetSlabThreadExit) == 0);
+  (void)atexit(GSetSlabAtExit);
+
+}
+
+// Take a free slot in the current slab of the thread, refilled if it has
+// none, reusing the slots of freed elements first
+// Output:
+//   Return the slot, of the size of a GSetElem.
+static void* GSetSlabAllocSlot(
+  void) {
+
+  // Get the slab of the thread, refilled if it has no free slot
+  GSetSlab* slab = GSetSlabCur;
+  if (
+    slab == NULL ||
+    (slab->local == NULL && slab->next == GSET_SLAB_NB_ELEM)
+  ) {
+
+    slab = GSetSlabRefill();
+    if (slab == NULL) Raise(TryCatchExc_MallocFailed);
+
+  }
+
+  // Take the slot of a freed element, else the next never allocated slot
+  GSetElem* slot = slab->local;
+  if (slot != NULL) {
+
+    slab->local = slot->next;
+    --(slab->nbLocal);
+    return slot;
+
+  }
+
+  slot = slab->elems + slab->next;
+  ++(slab->next);
+  return slot;
+
+}
+
+// Take consecutive free slots in the current slab of the thread, refilled
+// if it has none. Slots never allocated are taken first, slots of freed
+// elements are taken one by one
+// Inputs:
+//      nb: the number of slots wanted, greater than 0
+//   nbRun: receives the number of slots taken, not greater than 'nb'
+// Output:
+//   Return the first slot, or NULL if the allocation failed.
+static GSetElem* GSetSlabAllocRun(
+  size_t const nb,
+  size_t* const nbRun) {
+
+  // Get the slab of the thread, refilled if it has no free slot
+  GSetSlab* slab = GSetSlabCur;
+  if (
+    slab == NULL ||
+    (slab->local == NULL && slab->next == GSET_SLAB_NB_ELEM)
+  ) {
+
+    slab = GSetSlabRefill();
+    if (slab == NULL) return NULL;
+
+  }
+
+  // Take as many never allocated slots as possible
+  if (slab->next < GSET_SLAB_NB_ELEM) {
+
+    *nbRun = GSET_SLAB_NB_ELEM - slab->next;
+    if (*nbRun > nb) *nbRun = nb;
+    GSetElem* slots = slab->elems + slab->next;
+    slab->next += *nbRun;
+    return slots;
+
+  }
+
+  // Else take the slot of a freed element
+  GSetElem* slot = slab->local;
+  slab->local = slot->next;
+  --(slab->nbLocal);
+  *nbRun = 1;
+  return slot;
+
+}
+
+// Allocate memory for a new node of a concurrent queue
+// Output:
+//   Return the new node.
+static GSetConcNode* GSetConcNodeAlloc(
+  void) {
+
+  GSetConcNode* that = GSetSlabAllocSlot();
+  atomic_init(&(that->next), NULL);
+  return that;
+
+}
+
+// Link a node at the tail of a concurrent queue
+// Inputs:
+//   that: the queue
+//   node: the node
+static void GSetConcLink(
+      GSetConc* const that,
+  GSetConcNode* const node) {
+
+  // Swap the last node, then link the previous last node to the new one.
+  // Between the two, the consumer sees the queue as temporarily empty
+  atomic_store_explicit(&(node->next), NULL, memory_order_relaxed);
+  GSetConcNode* prev =
+    atomic_exchange_explicit(&(that->last), node, memory_order_acq_rel);
+  atomic_store_explicit(&(prev->next), node, memory_order_release);
+
+}
+
+// Unlink the node at the head of a concurrent queue
+// Input:
+//   that: the queue
+// Output:
+//   Return the node, or NULL if no node is available.
+static GSetConcNode* GSetConcUnlink(
+  GSetConc* const that) {
+
+  // Skip the stub node
+  GSetConcNode* first = that->first;
+  GSetConcNode* next =
+    atomic_load_explicit(&(first->next), memory_order_acquire);
+  if (first == &(that->stub)) {
+
+    if (next == NULL) return NULL;
+    that->first = next;
+    first = next;
+    next = atomic_load_explicit(&(first->next), memory_order_acquire);
+
+  }
+
+  // If the first node is followed by another one, it can be unlinked
+  if (next != NULL) {
+
+    that->first = next;
+    return first;
+
+  }
+
+  // If the first node is not the last one, a producer is linking a node
+  // after it
+  GSetConcNode* last =
+    atomic_load_explicit(&(that->last), memory_order_acquire);
+  if (first != last) return NULL;
+
+  // The first node is the last one, push back the stub behind it to be able
+  // to unlink it
+  GSetConcLink(that, &(that->stub));
+  next = atomic_load_explicit(&(first->next), memory_order_acquire);
+  if (next != NULL) {
+
+    that->first = next;
+    return first;
+
+  }
+
+  return NULL;
+
+}
+
+// Release a node popped from a concurrent queue. Releases are grouped per
+// slab to reduce the number of atomic operations on the slabs' counters
+// Inputs:
+//   that: the queue
+//   node: the node
+static void GSetConcRelease(
+      GSetConc* const that,
+  GSetConcNode* const node) {
+
+  GSetSlab* slab =
+    (GSetSlab*)((uintptr_t)node & ~(uintptr_t)(GSET_SLAB_SIZE - 1));
+  GSetElem* slot = (GSetElem*)node;
+  if (slab != that->releaseSlab) {
+
+    if (that->releaseSlab != NULL) {
+
+      GSetSlabFree(
+        that->releaseSlab, that->releaseFirst, that->releaseLast,
+        that->nbRelease);
+
+    }
+
+    that->releaseSlab = slab;
+    that->releaseLast = slot;
+    that->nbRelease = 0;
+
+  }
+
+  slot->next = that->releaseFirst;
+  that->releaseFirst = slot;
+  ++(that->nbRelease);
+
+}
+
+// Get the number of data the producer of a ring queue can add
+// Inputs:
+//   that: the queue
+//     nb: the number of data the producer wants to add
+// Output:
+//   Return the number of data which can be added, not greater than 'nb'.
+static size_t GSetSpscReserve(
+  GSetSpsc* const that,
+     size_t const nb) {
+
+  // Check the room with the last known index of the consumer, and refresh
+  // it only if there is not enough room
+  size_t tail = atomic_load_explicit(&(that->tail), memory_order_relaxed);
+  size_t nbFree = that->mask + 1 - (tail - that->headCache);
+  if (nbFree < nb) {
+
+    that->headCache =
+      atomic_load_explicit(&(that->head), memory_order_acquire);
+    nbFree = that->mask + 1 - (tail - that->headCache);
+
+  }
+
+  return (nbFree < nb ? nbFree : nb);
+
+}
+
+// Get the number of data the consumer of a ring queue can pop
+// Inputs:
+//   that: the queue
+//     nb: the number of data the consumer wants to pop
+// Output:
+//   Return the number of data which can be popped, not greater than 'nb'.
+static size_t GSetSpscAvailable(
+  GSetSpsc* const that,
+     size_t const nb) {
+
+  // Check the data with the last known index of the producer, and refresh
+  // it only if there is not enough data
+  size_t head = atomic_load_explicit(&(that->head), memory_order_relaxed);
+  size_t nbData = that->tailCache - head;
+  if (nbData < nb) {
+
+    that->tailCache =
+      atomic_load_explicit(&(that->tail), memory_order_acquire);
+    nbData = that->tailCache - head;
+
+  }
+
+  return (nbData < nb ? nbData : nb);
+
+}
+
+// Allocate memory for a new array of slots of a work-stealing deque
+// Inputs:
+//   nbSlot: the number of slots, a power of 2
+//     prev: the array replaced by the new one (may be NULL)
+// Output:
+//   Return the new array, or NULL if the allocation failed.
+static GSetDequeArr* GSetDequeArrAlloc(
+  int64_t const nbSlot,
+  GSetDequeArr* const prev) {
+
+  GSetDequeArr* that = malloc(
+    sizeof(GSetDequeArr) + (size_t)nbSlot * sizeof(_Atomic(void*)));
+  if (that == NULL) return NULL;
+  that->mask = nbSlot - 1;
+  that->prev = prev;
+  for (int64_t i = 0; i < nbSlot; ++i) atomic_init(that->slots + i, NULL);
+  return that;
+
+}
+
+// Wait, with the mutex of a blocking queue locked, until there is room in
+// the queue, and make sure the slots can receive the new data
+// Inputs:
+//   that: the queue
+//     nb: the number of data to be added
+// Output:
+//   Return the number of data which can be added, not greater than 'nb', 0
+//   if the queue is closed.
+static size_t GSetBlockingQueueWaitRoom(
+  GSetBlockingQueue* const that,
+             size_t const nb) {
+
+  // If the queue is bounded, wait for room
+  if (that->capacity > 0) {
+
+    while (that->isClosed == false && that->size == that->capacity) {
+
+      ++(that->nbWaitAdd);
+      pthread_cond_wait(&(that->notFull), &(that->mutex));
+      --(that->nbWaitAdd);
+
+    }
+
+    if (that->isClosed) return 0;
+    size_t nbFree = that->capacity - that->size;
+    return (nbFree < nb ? nbFree : nb);
+
+  }
+
+  if (that->isClosed) return 0;
+
+  // Else, grow the slots if needed, moving the data at the beginning of
+  // the new slots
+  if (that->size + nb > that->mask + 1) {
+
+    size_t nbSlot = that->mask + 1;
+    while (nbSlot < that->size + nb && nbSlot <= (SIZE_MAX >> 2))
+      nbSlot <<= 1;
+    union GSetElemData* slots =
+      malloc(nbSlot * sizeof(union GSetElemData));
+    if (slots == NULL) {
+
+      pthread_mutex_unlock(&(that->mutex));
+      Raise(TryCatchExc_MallocFailed);
+
+    }
+
+    for (size_t i = 0; i < that->size; ++i)
+      slots[i] = that->slots[(that->head + i) & that->mask];
+    free(that->slots);
+    that->slots = slots;
+    that->mask = nbSlot - 1;
+    that->head = 0;
+    if (that->size + nb > nbSlot) return nbSlot - that->size;
+
+  }
+
+  return nb;
+
+}
+
+// Wait, with the mutex of a blocking queue locked, until there are data
+// in the queue or it is closed
+// Inputs:
+//       that: the queue
+//         nb: the number of data to be popped
+//   deadline: the time until which to wait, NULL to wait without limit
+// Output:
+//   Return the number of data which can be popped, not greater than 'nb',
+//   0 if the queue is closed and empty or the deadline has passed.
+static size_t GSetBlockingQueueWaitData(
+      GSetBlockingQueue* const that,
+                  size_t const nb,
+  struct timespec const* const deadline) {
+
+  while (that->isClosed == false && that->size == 0) {
+
+    ++(that->nbWaitPop);
+    int ret = 0;
+    if (deadline == NULL) {
+
+      ret = pthread_cond_wait(&(that->notEmpty), &(that->mutex));
+
+    } else {
+
+      ret = pthread_cond_timedwait(
+        &(that->notEmpty), &(that->mutex), deadline);
+
+    }
+
+    --(that->nbWaitPop);
+    if (ret == ETIMEDOUT) break;
+
+  }
+
+  return (that->size < nb ? that->size : nb);
+
+}
+
+// Remove, with the mutex of a blocking queue locked, data at the head of
+// the queue and wake up the threads waiting for room
+// Inputs:
+//   that: the queue
+//     nb: the number of data to be removed
+static void GSetBlockingQueueTake(
+  GSetBlockingQueue* const that,
+             size_t const nb) {
+
+  if (nb == 0) return;
+  that->head = (that->head + nb) & that->mask;
+  that->size -= nb;
+  GSetBlockingQueueWake(&(that->notFull), that->nbWaitAdd, nb);
+
+}
+
+// Wake up the threads waiting on a condition of a blocking queue
+// Inputs:
+//     cond: the condition
+//   nbWait: the number of waiting threads
+//       nb: the number of data added or removed
+static void GSetBlockingQueueWake(
+  pthread_cond_t* const cond,
+     size_t const nbWait,
+     size_t const nb) {
+
+  // Signal only if there are waiting threads, and wake them all only if
+  // there is enough for more than one
+  if (nbWait == 0) return;
+  if (nb == 1) pthread_cond_signal(cond);
+  else pthread_cond_broadcast(cond);
+
+}
+
+// Get the time after a given delay
+// Input:
+//   timeout: the delay, in seconds
+// Output:
+//   Return the time after the delay.
+static struct timespec GSetBlockingQueueDeadline(
+  double const timeout) {
+
+  struct timespec deadline;
+  timespec_get(&deadline, TIME_UTC);
+  double sec = (timeout > 0.0 ? floor(timeout) : 0.0);
+  double nsec = (timeout > 0.0 ? (timeout - sec) * 1e9 : 0.0);
+  deadline.tv_sec += (time_t)sec;
+  deadline.tv_nsec += (long)nsec;
+  if (deadline.tv_nsec >= 1000000000L) {
+
+    deadline.tv_nsec -= 1000000000L;
+    ++(deadline.tv_sec);
+
+  }
+
+  return deadline;
+
+}
+
+// Get the shard of a data in a sharded set and lock its mutex. The shard
+// is selected by the high bits of the hash of the data, the hash index of
+// the shard's set using the low bits.
+// Inputs:
+//   that: the set
+//   type: the type of the data
+//   data: the data
+// Output:
+//   Return the locked shard.
+static GSetShard* GSetShardedLock(
+         GSetSharded* const that,
+          GSetKeyType const type,
+  union GSetElemData const* const data) {
+
+  GSetIndex index = {.type = type};
+  size_t hash = GSetIndexHash(&index, data);
+  GSetShard* shard =
+    that->shards + ((hash >> (sizeof(size_t) * 4)) & that->mask);
+  pthread_mutex_lock(&(shard->mutex));
+  return shard;
+
+}
+
+// Link a chain of new elements at the tail of a set
+// Inputs:
+//    that: the set
+//   first: the first element of the chain
+//    last: the last element of the chain, its next pointer is NULL
+//      nb: the number of elements in the chain
+static void GSetAppendChain(
+       GSet* const that,
+   GSetElem* const first,
+   GSetElem* const last,
+      size_t const nb) {
+
+  // Add the new elements to the index
+  if (that->index != NULL)
+    for (GSetElem* ptr = first; ptr != NULL; ptr = ptr->next)
+      GSetIndexAdd(that->index, ptr);
+  GSetSkipListFree(&(that->skipList));
+  GSetWindowInvalidate(that->window);
+
+  // Link the new elements at the tail of the set
+  first->prev = that->last;
+  if (that->last != NULL) GSetEpochLink(that, &(that->last->next), first);
+  else GSetEpochLink(that, &(that->first), first);
+  GSetEpochLink(that, &(that->last), last);
+  that->size += nb;
+
+}
+
+// Reverse the order of the bytes of each data of an array
+// Inputs:
+//        arr: the array
+//   sizeData: the size in bytes of one data
+//         nb: the number of data
+static void GSetSwapBytes(
+    void* const arr,
+  size_t const sizeData,
+  size_t const nb) {
+
+  unsigned char* bytes = arr;
+  FOR(iData, nb) {
+
+    unsigned char* data = bytes + iData * sizeData;
+    FOR(iByte, sizeData / 2) {
+
+      unsigned char byte = data[iByte];
+      data[iByte] = data[sizeData - 1 - iByte];
+      data[sizeData - 1 - iByte] = byte;
+
+    }
+
+  }
+
+}
+
+// Write the header of the binary format of GSetSave_<N> in a stream: the
+// magic string "GSET", the byte order mark, the version of the format, the
+// type and size of the data, the number of data, and 4 reserved null bytes
+// Inputs:
+//     stream: the stream
+//       type: the type of the data
+//   sizeData: the size in bytes of one data, 0 if it varies
+//         nb: the number of data
+static void GSetSaveHeader(
+        FILE* const stream,
+  GSetKeyType const type,
+       size_t const sizeData,
+       size_t const nb) {
+
+  unsigned char header[GSET_IO_HEADER_SIZE] = {0};
+  uint32_t mark = GSET_IO_MARK;
+  uint16_t version = GSET_IO_VERSION;
+  uint64_t nbData = nb;
+  memcpy(header, "GSET", 4);
+  memcpy(header + 4, &mark, sizeof(mark));
+  memcpy(header + 8, &version, sizeof(version));
+  header[10] = (unsigned char)type;
+  header[11] = (unsigned char)sizeData;
+  memcpy(header + 12, &nbData, sizeof(nbData));
+  if (fwrite(header, 1, GSET_IO_HEADER_SIZE, stream) != GSET_IO_HEADER_SIZE)
+    Raise(TryCatchExc_IOError);
+
+}
+
+// Read the header of the binary format of GSetSave_<N> from a stream and
+// check it matches the expected data. Raise TryCatchExc_IOError if it
+// doesn't.
+// Inputs:
+//      stream: the stream
+//        type: the type of the data
+//    sizeData: the size in bytes of one data, 0 if it varies
+//   isSwapped: receives true if the data were saved on a machine of the
+//              other byte order
+// Output:
+//   Return the number of data.
+static size_t GSetLoadHeader(
+        FILE* const stream,
+  GSetKeyType const type,
+       size_t const sizeData,
+        bool* const isSwapped) {
+
+  unsigned char header[GSET_IO_HEADER_SIZE];
+  size_t nb = 0;
+  if (
+    fread(header, 1, GSET_IO_HEADER_SIZE, stream) != GSET_IO_HEADER_SIZE ||
+    GSetParseHeader(header, type, sizeData, isSwapped, &nb) == false)
+    Raise(TryCatchExc_IOError);
+  return nb;
+
+}
+
+// Parse the header of the binary format of GSetSave_<N> and check it
+// matches the expected data
+// Inputs:
+//      header: the header
+//        type: the type of the data
+//    sizeData: the size in bytes of one data, 0 if it varies
+//   isSwapped: receives true if the data were saved on a machine of the
+//              other byte order
+//          nb: receives the number of data
+// Output:
+//   Return true if the header is valid and matches the expected data, else
+//   false.
+static bool GSetParseHeader(
+  unsigned char const* const header,
+            GSetKeyType const type,
+                 size_t const sizeData,
+                  bool* const isSwapped,
+                size_t* const nb) {
+
+  if (memcmp(header, "GSET", 4) != 0) return false;
+  uint32_t mark = 0;
+  uint16_t version = 0;
+  uint64_t nbData = 0;
+  memcpy(&mark, header + 4, sizeof(mark));
+  memcpy(&version, header + 8, sizeof(version));
+  memcpy(&nbData, header + 12, sizeof(nbData));
+
+  // If the byte order mark is reversed, the data were saved on a machine
+  // of the other byte order
+  *isSwapped = (mark != GSET_IO_MARK);
+  if (*isSwapped) {
+
+    GSetSwapBytes(&mark, sizeof(mark), 1);
+    GSetSwapBytes(&version, sizeof(version), 1);
+    GSetSwapBytes(&nbData, sizeof(nbData), 1);
+
+  }
+
+  // Check the header matches the expected data and its reserved bytes are
+  // null
+  *nb = (size_t)nbData;
+  return (
+    mark == GSET_IO_MARK &&
+    version == GSET_IO_VERSION &&
+    header[10] == (unsigned char)type &&
+    header[11] == (unsigned char)sizeData &&
+    *nb == nbData &&
+    header[20] == 0 && header[21] == 0 &&
+    header[22] == 0 && header[23] == 0);
+
+}
+
+// Map in memory a file saved with GSetSave_<N> and get a read-only view on
+// its data
+// Inputs:
+//       path: the path to the file
+//       type: the type of the data
+//   sizeData: the size in bytes of one data
+// Output:
+//   Return the new GSetMap.
+static GSetMap* GSetMapOpen(
+  char const* const path,
+  GSetKeyType const type,
+       size_t const sizeData) {
+
+  // Open the file and get its size
+  int fd = open(path, O_RDONLY);
+  if (fd == -1) Raise(TryCatchExc_IOError);
+  struct stat status;
+  if (fstat(fd, &status) != 0 || status.st_size < GSET_IO_HEADER_SIZE) {
+
+    close(fd);
+    Raise(TryCatchExc_IOError);
+
+  }
+
+  // Map the file, the mapping stays valid once the file is closed
+  size_t sizeFile = (size_t)(status.st_size);
+  void* addr = mmap(NULL, sizeFile, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) Raise(TryCatchExc_IOError);
+
+  // Check the header and the size of the file. The data saved on a machine
+  // of the other byte order can't be used without being converted
+  bool isSwapped = false;
+  size_t nb = 0;
+  bool isValid = GSetParseHeader(addr, type, sizeData, &isSwapped, &nb);
+  if (
+    isValid == false ||
+    isSwapped == true ||
+    nb > (sizeFile - GSET_IO_HEADER_SIZE) / sizeData) {
+
+    munmap(addr, sizeFile);
+    Raise(TryCatchExc_IOError);
+
+  }
+
+  // Create the view
+  GSetMap* that = malloc(sizeof(GSetMap));
+  if (that == NULL) {
+
+    munmap(addr, sizeFile);
+    Raise(TryCatchExc_MallocFailed);
+
+  }
+
+  *that = (GSetMap) {
+
+    .addr = addr,
+    .sizeFile = sizeFile,
+    .data = (unsigned char const*)addr + GSET_IO_HEADER_SIZE,
+    .size = nb,
+    .sizeData = sizeData,
+
+  };
+  return that;
+
+}
+
+// Move an iterator on a read-only view, by steps in a given direction, to
+// the next data matching its filter
+// Inputs:
+//   that: the iterator
+//   step: 1 to move toward the end of the view, SIZE_MAX (i.e. -1) to move
+//         toward its beginning
+// Output:
+//   Return true if the iterator could move, else false (it stays on its
+//   current data).
+static bool GSetMapIterMove(
+  GSetMapIter* const that,
+        size_t const step) {
+
+  // Positions out of the view wrap around to values not lower than its
+  // size
+  size_t pos = that->pos + step;
+  while (pos < that->map->size) {
+
+    void* data =
+      (void*)(that->map->data + pos * that->map->sizeData);
+    if (
+      that->filter.fun == NULL ||
+      that->filter.fun(data, that->filter.params)) {
+
+      that->pos = pos;
+      return true;
+
+    }
+
+    pos += step;
+
+  }
+
+  return false;
+
+}
+
+// Initialise the state of the parsing of a text
+// Inputs:
+//     that: the state
+//   delims: the characters delimiting the numbers, if NULL spaces, tabs,
+//           line ends, commas and semicolons
+static void GSetTextParserInit(
+  GSetTextParser* const that,
+      char const* const delims) {
+
+  *that = (GSetTextParser) {
+
+    .isDelim = {false},
+    .offset = 0,
+    .line = 1,
+    .lineStart = 0,
+    .nb = 0,
+    .isInvalid = false,
+
+  };
+  char const* chars = (delims != NULL ? delims : " \t\r\n,;");
+  for (char const* c = chars; *c != '\0'; ++c)
+    that->isDelim[(unsigned char)(*c)] = true;
+
+}
+
+// Get the current position of the parsing of a text
+// Inputs:
+//   that: the state of the parsing
+//    pos: receives the position, may be NULL
+static void GSetTextParserGetPos(
+  GSetTextParser const* const that,
+          GSetTextPos* const pos) {
+
+  if (pos == NULL) return;
+  *pos = (GSetTextPos) {
+
+    .offset = that->offset,
+    .line = that->line,
+    .col = that->offset - that->lineStart + 1,
+
+  };
+
+}
+
+// Parse a decimal integer with an optional sign at the beginning of a
+// text, in one pass up to the first delimiter
+// Inputs:
+//      text: the text
+//       len: the number of characters in the text
+//   isDelim: the flags of the delimiter characters
+//       end: receives the index of the first delimiter after the integer
+//            (len if there is none), or of the first invalid character
+//     isNeg: receives true if the integer has a minus sign
+//       mag: receives the magnitude of the integer
+// Output:
+//   Return true if the characters before 'end' are a valid integer whose
+//   magnitude fits an unsigned long long, else false.
+static bool GSetParseInteger(
+          char const* const text,
+               size_t const len,
+          bool const* const isDelim,
+              size_t* const end,
+                 bool* const isNeg,
+  unsigned long long* const mag) {
+
+  size_t i = 0;
+  *isNeg = false;
+  if (len > 0 && (text[0] == '+' || text[0] == '-')) {
+
+    *isNeg = (text[0] == '-');
+    i = 1;
+
+  }
+
+  // Accumulate the digits. The 19 first ones always fit an unsigned long
+  // long (at least 64 bits), the overflow is checked for the following
+  // ones.
+  size_t first = i;
+  unsigned long long val = 0;
+  for (; i < len; ++i) {
+
+    unsigned int digit = (unsigned char)(text[i]) - (unsigned char)'0';
+    if (digit > 9) break;
+    if (
+      i - first >= 19 && (
+      val > ULLONG_MAX / 10 ||
+      (val == ULLONG_MAX / 10 && digit > ULLONG_MAX % 10))) {
+
+      *end = i;
+      return false;
+
+    }
+
+    val = val * 10 + digit;
+
+  }
+
+  *end = i;
+  *mag = val;
+  return (i > first && (i == len || isDelim[(unsigned char)(text[i])]));
+
+}
+
+// Parse a real number in the format of the C locale: an optional sign and
+// a decimal mantissa with an optional fractional part and exponent, or
+// "inf", "infinity", "nan" (case insensitive). The number is converted
+// without strtof/strtod when its mantissa and power of ten are exactly
+// representable in the precision of the result, which is the case of most
+// numbers written with up to 15 significant digits for double, and by
+// GSetParseRealSlow otherwise.
+// Inputs:
+//       tok: the characters of the number
+//       len: the number of characters
+//   isFloat: true to round the number to float, false to round it to
+//            double
+//       val: receives the number
+// Output:
+//   Return true if the characters are a valid number in the range of
+//   float or double, else false.
+static bool GSetParseReal(
+  char const* const tok,
+       size_t const len,
+         bool const isFloat,
+      double* const val) {
+
+  size_t i = 0;
+  bool isNeg = false;
+  if (len > 0 && (tok[0] == '+' || tok[0] == '-')) {
+
+    isNeg = (tok[0] == '-');
+    i = 1;
+
+  }
+
+  // Infinity and not-a-number
+  if (i < len && ((tok[i] | 0x20) == 'i' || (tok[i] | 0x20) == 'n')) {
+
+    if (
+      GSetTextIsWord(tok + i, len - i, "inf") ||
+      GSetTextIsWord(tok + i, len - i, "infinity")) {
+
+      *val = (isNeg ? -HUGE_VAL : HUGE_VAL);
+      return true;
+
+    } else if (GSetTextIsWord(tok + i, len - i, "nan")) {
+
+      *val = (isNeg ? -NAN : NAN);
+      return true;
+
+    }
+
+    return false;
+
+  }
+
+  // Mantissa, its first 19 significant digits (which always fit an
+  // unsigned long long) being kept and the following ones being accounted
+  // for in the exponent
+  unsigned long long mantissa = 0;
+  int nbSignif = 0;
+  long exp10 = 0;
+  bool hasDigit = false;
+  bool isTruncated = false;
+  bool isFraction = false;
+  for (; i < len; ++i) {
+
+    if (tok[i] == '.' && isFraction == false) {
+
+      isFraction = true;
+      continue;
+
+    }
+
+    unsigned int digit = (unsigned char)(tok[i]) - (unsigned char)'0';
+    if (digit > 9) break;
+    hasDigit = true;
+    if (nbSignif < 19) {
+
+      mantissa = mantissa * 10 + digit;
+      if (mantissa > 0) ++nbSignif;
+      if (isFraction) --exp10;
+
+    } else {
+
+      if (isFraction == false) ++exp10;
+      if (digit != 0) isTruncated = true;
+
+    }
+
+  }
+
+  if (hasDigit == false) return false;
+
+  // Exponent, large enough values saturating as the result is anyway 0 or
+  // out of range
+  if (i < len && (tok[i] | 0x20) == 'e') {
+
+    ++i;
+    bool isNegExp = false;
+    if (i < len && (tok[i] == '+' || tok[i] == '-')) {
+
+      isNegExp = (tok[i] == '-');
+      ++i;
+
+    }
+
+    if (i == len) return false;
+    long exp = 0;
+    for (; i < len; ++i) {
+
+      unsigned int digit = (unsigned char)(tok[i]) - (unsigned char)'0';
+      if (digit > 9) return false;
+      if (exp < 100000) exp = exp * 10 + (long)digit;
+
+    }
+
+    exp10 += (isNegExp ? -exp : exp);
+
+  }
+
+  if (i != len) return false;
+
+  // If the mantissa and the power of ten are exactly representable in the
+  // precision of the result, one multiplication or division gives the
+  // correctly rounded result (as long as it's evaluated in that precision).
+  // Else, fall back to strtof or strtod.
+  static double const pow10[] = {
+
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+    1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+
+  };
+  static float const pow10f[] = {
+
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+
+  };
+  if (mantissa == 0) {
+
+    *val = (isNeg ? -0.0 : 0.0);
+    return true;
+
+  } else if (
+    isFloat &&
+    FLT_EVAL_METHOD == 0 &&
+    isTruncated == false &&
+    mantissa <= (1ULL << FLT_MANT_DIG) &&
+    exp10 >= -10 && exp10 <= 10) {
+
+    float res = (float)mantissa;
+    if (exp10 < 0) res /= pow10f[-exp10];
+    else res *= pow10f[exp10];
+    *val = (isNeg ? -res : res);
+    return true;
+
+  } else if (
+    isFloat == false &&
+    FLT_EVAL_METHOD == 0 &&
+    isTruncated == false &&
+    mantissa <= (1ULL << DBL_MANT_DIG) &&
+    exp10 >= -22 && exp10 <= 22) {
+
+    double res = (double)mantissa;
+    if (exp10 < 0) res /= pow10[-exp10];
+    else res *= pow10[exp10];
+    *val = (isNeg ? -res : res);
+    return true;
+
+  }
+
+  return GSetParseRealSlow(tok, len, isFloat, val);
+
+}
+
+// Convert a real number, already checked by GSetParseReal, with strtof or
+// strtod after replacing its decimal point with the one of the current
+// locale
+// Inputs:
+//       tok: the characters of the number
+//       len: the number of characters
+//   isFloat: true to convert with strtof, false to convert with strtod
+//       val: receives the number
+// Output:
+//   Return true if the number is in the range of float or double, else
+//   false.
+static bool GSetParseRealSlow(
+  char const* const tok,
+       size_t const len,
+         bool const isFloat,
+      double* const val) {
+
+  // Copy the number, in a local buffer if it's short enough
+  char const* point = localeconv()->decimal_point;
+  size_t lenPoint = strlen(point);
+  char buf[GSET_TEXT_TOKEN];
+  char* str = buf;
+  if (len + lenPoint + 1 > sizeof(buf))
+    MALLOC(str, len + lenPoint + 1);
+  size_t j = 0;
+  FOR(i, len) {
+
+    if (tok[i] == '.') {
+
+      memcpy(str + j, point, lenPoint);
+      j += lenPoint;
+
+    } else {
+
+      str[j] = tok[i];
+      ++j;
+
+    }
+
+  }
+
+  str[j] = '\0';
+
+  // Convert the number, overflows being out of range
+  errno = 0;
+  char* end = NULL;
+  bool isValid = false;
+  if (isFloat) {
+
+    float res = strtof(str, &end);
+    isValid =
+      (*end == '\0' && (errno != ERANGE || fabsf(res) != HUGE_VALF));
+    *val = res;
+
+  } else {
+
+    double res = strtod(str, &end);
+    isValid =
+      (*end == '\0' && (errno != ERANGE || fabs(res) != HUGE_VAL));
+    *val = res;
+
+  }
+
+  if (str != buf) free(str);
+  return isValid;
+
+}
+
+// Check if characters are a given lower case word, ignoring their case
+// Inputs:
+//    tok: the characters
+//    len: the number of characters
+//   word: the word
+// Output:
+//   Return true if the characters are the word, else false.
+static bool GSetTextIsWord(
+  char const* const tok,
+       size_t const len,
+  char const* const word) {
+
+  if (strlen(word) != len) return false;
+  FOR(i, len) if ((tok[i] | 0x20) != word[i]) return false;
+  return true;
+
+}
+
+// Create a new empty compressed set
+// Inputs:
+//   type: the type of the data
+//   size: the number of data which will be encoded
+// Output:
+//   Return the new GSetPacked, with its blocks allocated.
+static GSetPacked* GSetPackedCreate(
+  GSetKeyType const type,
+       size_t const size) {
+
+  GSetPacked* that = NULL;
+  MALLOC(that, sizeof(GSetPacked));
+  *that = (GSetPacked) {
+
+    .type = type,
+    .size = size,
+    .isSorted = true,
+    .blocks = NULL,
+    .nbBlock = 0,
+    .words = NULL,
+    .nbWord = 0,
+    .nbWordAlloc = 0,
+
+  };
+  size_t nbBlock = (size + GSET_PACK_BLOCK - 1) / GSET_PACK_BLOCK;
+  if (nbBlock > 0) {
+
+    that->blocks = malloc(nbBlock * sizeof(GSetPackedBlock));
+    if (that->blocks == NULL) {
+
+      free(that);
+      Raise(TryCatchExc_MallocFailed);
+
+    }
+
+  }
+
+  return that;
+
+}
+
+// Encode a block of data at the end of a compressed set
+// Inputs:
+//   that: the compressed set
+//   data: the data, as unsigned long
+//     nb: the number of data, in [1, GSET_PACK_BLOCK]
+static void GSetPackedAddBlock(
+          GSetPacked* const that,
+  unsigned long const* const data,
+                size_t const nb) {
+
+  // Get the number of bits of the largest difference between consecutive
+  // data, the differences wrapping around (and being large) if the data
+  // are not sorted
+  unsigned long bits = 0;
+  for (size_t i = 1; i < nb; ++i) bits |= data[i] - data[i - 1];
+  unsigned int width = 0;
+  while (bits != 0) {
+
+    ++width;
+    bits >>= 1;
+
+  }
+
+  // Get the words for the differences, growing the allocated words
+  // geometrically, and shrinking them to the used ones after the last
+  // block
+  size_t nbWord = ((nb - 1) * width + 63) / 64;
+  if (that->nbWord + nbWord > that->nbWordAlloc) {
+
+    size_t nbAlloc = 2 * that->nbWordAlloc;
+    if (nbAlloc < that->nbWord + nbWord) nbAlloc = that->nbWord + nbWord;
+    uint64_t* words = realloc(that->words, nbAlloc * sizeof(uint64_t));
+    if (words == NULL) Raise(TryCatchExc_MallocFailed);
+    that->words = words;
+    that->nbWordAlloc = nbAlloc;
+
+  }
+
+  uint64_t* words = that->words + that->nbWord;
+  memset(words, 0, nbWord * sizeof(uint64_t));
+  size_t bit = 0;
+  for (size_t i = 1; i < nb; ++i) {
+
+    uint64_t delta = data[i] - data[i - 1];
+    size_t iWord = bit / 64;
+    unsigned int shift = bit % 64;
+    words[iWord] |= delta << shift;
+    if (shift + width > 64) words[iWord + 1] |= delta >> (64 - shift);
+    bit += width;
+
+  }
+
+  that->blocks[that->nbBlock] = (GSetPackedBlock) {
+
+    .first = data[0],
+    .offset = that->nbWord,
+    .width = (unsigned char)width,
+
+  };
+  ++(that->nbBlock);
+  that->nbWord += nbWord;
+  if (
+    that->nbBlock * GSET_PACK_BLOCK >= that->size &&
+    that->nbWord > 0 &&
+    that->nbWord < that->nbWordAlloc) {
+
+    words = realloc(that->words, that->nbWord * sizeof(uint64_t));
+    if (words != NULL) {
+
+      that->words = words;
+      that->nbWordAlloc = that->nbWord;
+
+    }
+
+  }
+
+}
+
+// Decode a block of a compressed set
+// Inputs:
+//     that: the compressed set
+//   iBlock: the index of the block
+//     data: receives the data of the block, as unsigned long
+// Output:
+//   Return the number of data in the block.
+static size_t GSetPackedDecodeBlock(
+  GSetPacked const* const that,
+             size_t const iBlock,
+     unsigned long* const data) {
+
+  GSetPackedBlock const* block = that->blocks + iBlock;
+  size_t nb = GSET_PACK_BLOCK;
+  if (iBlock + 1 == that->nbBlock) nb = that->size - iBlock * GSET_PACK_BLOCK;
+  unsigned long val = block->first;
+  data[0] = val;
+
+  // Blocks of equal data have no difference to unpack
+  unsigned int width = block->width;
+  if (width == 0) {
+
+    for (size_t i = 1; i < nb; ++i) data[i] = val;
+    return nb;
+
+  }
+
+  // Unpack the differences and sum them
+  uint64_t const* words = that->words + block->offset;
+  uint64_t mask = (width == 64 ? UINT64_MAX : ((uint64_t)1 << width) - 1);
+  size_t bit = 0;
+  for (size_t i = 1; i < nb; ++i) {
+
+    size_t iWord = bit / 64;
+    unsigned int shift = bit % 64;
+    uint64_t delta = words[iWord] >> shift;
+    if (shift + width > 64) delta |= words[iWord + 1] << (64 - shift);
+    val += (unsigned long)(delta & mask);
+    data[i] = val;
+    bit += width;
+
+  }
+
+  return nb;
+
+}
+
+// Check if a block of a compressed set sorted in increasing order contains
+// the data at a given distance from the first data of the block. The
+// differences are summed until the distance is reached or passed.
+// Inputs:
+//     that: the compressed set
+//   iBlock: the index of the block
+//     dist: the distance, as unsigned long, from the first data of the
+//           block to the data
+// Output:
+//   Return true if the block contains the data, else false.
+static bool GSetPackedBlockContains(
+  GSetPacked const* const that,
+             size_t const iBlock,
+      unsigned long const dist) {
+
+  if (dist == 0) return true;
+  GSetPackedBlock const* block = that->blocks + iBlock;
+  unsigned int width = block->width;
+  if (width == 0) return false;
+  size_t nb = GSET_PACK_BLOCK;
+  if (iBlock + 1 == that->nbBlock) nb = that->size - iBlock * GSET_PACK_BLOCK;
+  uint64_t const* words = that->words + block->offset;
+  uint64_t mask = (width == 64 ? UINT64_MAX : ((uint64_t)1 << width) - 1);
+  unsigned long sum = 0;
+  size_t bit = 0;
+  for (size_t i = 1; i < nb; ++i) {
+
+    size_t iWord = bit / 64;
+    unsigned int shift = bit % 64;
+    uint64_t delta = words[iWord] >> shift;
+    if (shift + width > 64) delta |= words[iWord + 1] << (64 - shift);
+    sum += (unsigned long)(delta & mask);
+    if (sum >= dist) return (sum == dist);
+    bit += width;
+
+  }
+
+  return false;
+
+}
+
+// Move an iterator on a compressed set, by steps in a given direction, to
+// the next data matching its filter, decoding the blocks it enters
+// Inputs:
+//   that: the iterator
+//   step: 1 to move toward the end of the set, SIZE_MAX (i.e. -1) to move
+//         toward its beginning
+// Output:
+//   Return true if the iterator could move, else false (it stays on its
+//   current data).
+static bool GSetPackedIterMove(
+  GSetPackedIter* const that,
+           size_t const step) {
+
+  // Positions out of the set wrap around to values not lower than its size
+  size_t pos = that->pos + step;
+  while (pos < that->packed->size) {
+
+    size_t iBlock = pos / GSET_PACK_BLOCK;
+    if (iBlock != that->iBlock) {
+
+      (void)GSetPackedDecodeBlock(that->packed, iBlock, that->block);
+      that->iBlock = iBlock;
+
+    }
+
+    void* data = that->block + pos % GSET_PACK_BLOCK;
+    if (
+      that->filter.fun == NULL ||
+      that->filter.fun(data, that->filter.params)) {
+
+      that->pos = pos;
+      return true;
+
+    }
+
+    pos += step;
+
+  }
+
+  // If no data matched the filter, decode back the block of the current
+  // data
+  if (that->pos != SIZE_MAX && that->pos / GSET_PACK_BLOCK != that->iBlock) {
+
+    that->iBlock = that->pos / GSET_PACK_BLOCK;
+    (void)GSetPackedDecodeBlock(that->packed, that->iBlock, that->block);
+
+  }
+
+  return false;
+
+}
+
+// The links between elements are plain pointers, accessed as atomic ones
+// by the writer and readers of a set in concurrent-read mode only
+_Static_assert(
+  sizeof(_Atomic(GSetElem*)) == sizeof(GSetElem*) &&
+  ATOMIC_POINTER_LOCK_FREE == 2,
+  "links must be accessible as lock-free atomic pointers");
+
+// Set a link which may be followed by the readers of a set in
+// concurrent-read mode (the next or previous element of an element, the
+// first or last element of the set). In that mode the link is stored with
+// release semantics, so the readers following it see the linked element
+// initialised
+// Inputs:
+//    set: the set
+//   link: the link
+//   elem: the linked element (may be NULL)
+static inline void GSetEpochLink(
+  GSet const* const set,
+   GSetElem** const link,
+   GSetElem* const elem) {
+
+  if (set->epoch != NULL) {
+
+    atomic_store_explicit(
+      (_Atomic(GSetElem*)*)link, elem, memory_order_release);
+
+  } else *link = elem;
+
+}
+
+// Get a link followed by an iterator, with an acquire load if the set was
+// in concurrent-read mode when the iterator was reset
+// Inputs:
+//   that: the iterator
+//   link: the link
+// Output:
+//   Return the linked element (may be NULL)
+static inline GSetElem* GSetIterLink(
+         GSetIter const* const that,
+  GSetElem* const* const link) {
+
+  if (that->isConcurrent) {
+
+    return atomic_load_explicit(
+      (_Atomic(GSetElem*)*)link, memory_order_acquire);
+
+  }
+
+  return *link;
+
+}
+
+// Retire an element removed from a set in concurrent-read mode, and free
+// the retired elements which can't be accessed by the readers anymore
+// Inputs:
+//   that: the set
+//   elem: the element
+static void GSetEpochRetire(
+       GSet* const that,
+  GSetElem* const elem) {
+
+  // Add the element to the bag of the current epoch
+  GSetEpoch* epoch = that->epoch;
+  uint64_t global =
+    atomic_load_explicit(&(epoch->global), memory_order_relaxed);
+  GSetEpochBag* bag = epoch->bags + global % 3;
+  if (bag->nb == bag->size) {
+
+    size_t size = (bag->size == 0 ? GSET_EPOCH_PERIOD : bag->size * 2);
+    GSetElem** elems = realloc(bag->elems, size * sizeof(GSetElem*));
+
+    // If the bag can't grow, wait for the readers to leave the current
+    // epoch and free the element immediately
+    if (elems == NULL) {
+
+      while (GSetEpochAdvance(epoch) == false);
+      while (GSetEpochAdvance(epoch) == false);
+      GSetElem* ptr = elem;
+      GSetElemFree(&ptr);
+      return;
+
+    }
+
+    bag->elems = elems;
+    bag->size = size;
+
+  }
+
+  bag->elems[bag->nb] = elem;
+  ++(bag->nb);
+
+  // Periodically try to advance the epoch
+  ++(epoch->nbRetire);
+  if (epoch->nbRetire >= GSET_EPOCH_PERIOD) {
+
+    epoch->nbRetire = 0;
+    (void)GSetEpochAdvance(epoch);
+
+  }
+
+}
+
+// Advance the epoch of a set in concurrent-read mode if all the readers in
+// a read section have entered the current epoch, and free the elements
+// retired two epochs before
+// Input:
+//   that: the epoch-based reclamation of the set
+// Output:
+//   Return true if the epoch has advanced, false else.
+static bool GSetEpochAdvance(
+  GSetEpoch* const that) {
+
+  // Check all the readers in a read section are in the current epoch
+  uint64_t global =
+    atomic_load_explicit(&(that->global), memory_order_relaxed);
+  atomic_thread_fence(memory_order_seq_cst);
+  for (size_t i = 0; i < GSET_EPOCH_NB_READER; ++i) {
+
+    uint64_t epoch = atomic_load(&(that->readers[i].epoch));
+    if (epoch != 0 && epoch != global) return false;
+
+  }
+
+  // Advance the epoch. The readers are now in the previous or new epoch,
+  // the elements retired two epochs before the new one were removed before
+  // they entered their read section
+  atomic_store(&(that->global), global + 1);
+  GSetEpochBagEmpty(that->bags + (global + 2) % 3);
+  return true;
+
+}
+
+// Free the elements retired in a bag
+// Input:
+//   that: the bag
+static void GSetEpochBagEmpty(
+  GSetEpochBag* const that) {
+
+  for (size_t i = 0; i < that->nb; ++i) GSetElemFree(that->elems + i);
+  that->nb = 0;
+
+}
+
+// Free the epoch-based reclamation of a set and its retired elements
+// Input:
+//   that: the epoch-based reclamation
+static void GSetEpochFree(
+  GSetEpoch** const that) {
+
+  // If the memory is already freed, nothing to do
+  if (that == NULL || *that == NULL) return;
+
+  // Free the retired elements
+  for (size_t i = 0; i < 3; ++i) {
+
+    GSetEpochBagEmpty((*that)->bags + i);
+    free((*that)->bags[i].elems);
+
+  }
+
+  // Free memory
+  free(*that);
+  *that = NULL;
+
+}
+
+// Add an element before a given element
+// Inputs:
+//   that: the GSetElem before which the new element must be added
+//   elem: the GSetElem to be added
+//    set: the GSet containing 'that'
+static void GSetElemAddElemBefore(
+  GSetElem* const that,
+  GSetElem* const elem,
+      GSet* const set) {
+
+  // Add the new element, linked to its neighbours before being linked in
+  // the set
+  elem->prev = that->prev;
+  elem->next = that;
+  if (that->prev != NULL) GSetEpochLink(set, &(that->prev->next), elem);
+  GSetEpochLink(set, &(that->prev), elem);
+  if (set->first == that) GSetEpochLink(set, &(set->first), elem);
+  ++(set->size);
+  GSetNotifyAdd(set, elem);
+
+}
+
+// Create a new GSet
+// Output:
+//   Return the new GSet.
+static GSet GSetCreate(
+  void) {
+
+  // Create the GSet
+  GSet that = (GSet) {
+
+    .size = 0,
+    .first = NULL,
+    .last = NULL,
+    .index = NULL,
+    .skipList = NULL,
+    .window = NULL,
+    .epoch = NULL,
+    .capacity = 0,
+    .policy = GSetBounded_Overwrite,
+    .spare = NULL,
+    .nbSpare = 0,
+
+  };
+
+  // Return the GSet
+  return that;
+
+}
+
+// Push an element at the head of the set
+// Inputs:
+//   that: the set
+//   elem: the element
+static void GSetPushElem(
+      GSet* const that,
+  GSetElem* const elem) {
+
+  // Check for overflow
+  if (that->size > SIZE_MAX - 1) Raise(TryCatchExc_IntOverflow);
+
+  // Add the element to the head of the set
+  elem->next = that->first;
+  if (that->first != NULL) GSetEpochLink(that, &(that->first->prev), elem);
+  GSetEpochLink(that, &(that->first), elem);
+  if (that->size == 0) GSetEpochLink(that, &(that->last), elem);
+
+  // Update the size of the set
+  ++(that->size);
+
+  // Update the index
+  GSetNotifyAdd(that, elem);
+
+}
+
+// Add an element at the tail of the set
+// Inputs:
+//   that: the set
+//   elem: the element
+static void GSetAddElem(
+      GSet* const that,
+  GSetElem* const elem) {
+
+  // Check for overflow
+  if (that->size > SIZE_MAX - 1) Raise(TryCatchExc_IntOverflow);
+
+  // Add the element to the tail of the set
+  elem->prev = that->last;
+  if (that->last != NULL) GSetEpochLink(that, &(that->last->next), elem);
+  GSetEpochLink(that, &(that->last), elem);
+  if (that->size == 0) GSetEpochLink(that, &(that->first), elem);
+
+  // Update the size of the set
+  ++(that->size);
+
+  // Update the index
+  GSetNotifyAdd(that, elem);
+
+}
+
+// Pop an element from the head of the set
+// Input:
+//   that: the set
+// Output:
+//   Return the element
+static GSetElem* GSetPopElem(
+  GSet* const that) {
+
+  // Remove the first element
+  GSetElem* elem = that->first;
+  GSetNotifyRemove(that, elem);
+  if (that->last == that->first) GSetEpochLink(that, &(that->last), NULL);
+  GSetEpochLink(that, &(that->first), elem->next);
+  if (that->first != NULL) GSetEpochLink(that, &(that->first->prev), NULL);
+
+  // Update the size of the set
+  --(that->size);
+
+  // Return the element
+  return elem;
 
-// Allocate memory for a new GSetIter
+}
+
+// Drop an element from the tail of the set
 // Input:
-//   type: the type of iteration
+//   that: the set
 // Output:
-//   Return the new GSetIter.
-GSetIter* GSetIterAlloc(
-  GSetIterType const type) {
+//   Return the element
+static GSetElem* GSetDropElem(
+  GSet* const that) {
 
-  // Allocate memory for the GSet
-  GSetIter* that = NULL;
-  MALLOC(that, sizeof(GSetIter));
+  // Remove the last element
+  GSetElem* elem = that->last;
+  GSetNotifyRemove(that, elem);
+  if (that->last == that->first) GSetEpochLink(that, &(that->first), NULL);
+  GSetEpochLink(that, &(that->last), elem->prev);
+  if (that->last != NULL) GSetEpochLink(that, &(that->last->next), NULL);
 
-  // Create the GSet
-  *that = GSetIterCreate(type);
+  // Update the size of the set
+  --(that->size);
 
-  // Return the GSet
-  return that;
+  // Return the element
+  return elem;
 
 }
 
-// Free the memory used by a GSetIter.
+// Remove an element from the set, the element is not freed
+// Inputs:
+//   that: the set
+//   elem: the element
+static void GSetRemoveElem(
+      GSet* const that,
+  GSetElem* const elem) {
+
+  // Update the index
+  GSetNotifyRemove(that, elem);
+
+  // Unlink the element
+  if (that->first == elem) GSetEpochLink(that, &(that->first), elem->next);
+  if (that->last == elem) GSetEpochLink(that, &(that->last), elem->prev);
+  if (elem->next != NULL)
+    GSetEpochLink(that, &(elem->next->prev), elem->prev);
+  if (elem->prev != NULL)
+    GSetEpochLink(that, &(elem->prev->next), elem->next);
+
+  // Update the size of the set
+  --(that->size);
+
+}
+
+// Update what depends on the elements of a set after an element has been
+// linked into it
+// Inputs:
+//   that: the set
+//   elem: the linked element
+static void GSetNotifyAdd(
+      GSet* const that,
+  GSetElem* const elem) {
+
+  if (that->index != NULL) GSetIndexAdd(that->index, elem);
+  if (that->window != NULL) GSetWindowAdd(that, elem);
+
+  // The set may not be sorted anymore
+  GSetSkipListFree(&(that->skipList));
+
+}
+
+// Update what depends on the elements of a set before an element is
+// unlinked from it
+// Inputs:
+//   that: the set
+//   elem: the element about to be unlinked
+static void GSetNotifyRemove(
+      GSet* const that,
+  GSetElem* const elem) {
+
+  if (that->index != NULL) GSetIndexRemove(that->index, elem);
+  if (that->skipList != NULL) GSetSkipListRemove(that->skipList, elem);
+  if (that->window != NULL) GSetWindowRemove(that, elem);
+
+}
+
+// Update what depends on the elements of a set after the data of its
+// elements have been modified or moved between elements
 // Input:
-//   that: the GSetIter to be freed
-void GSetIterFree_(
-  GSetIter** const that) {
+//   that: the set
+static void GSetNotifyUpdate(
+  GSet* const that) {
+
+  if (that->index != NULL) GSetIndexRebuild(that->index, that);
+  GSetSkipListFree(&(that->skipList));
+  GSetWindowInvalidate(that->window);
+
+}
+
+// Attach a new hash index to a set and index its elements
+// Inputs:
+//   that: the set
+//   type: the type of keys
+//   hash: the user defined hash function (for GSetKeyType_User)
+//     eq: the user defined equality function (for GSetKeyType_User)
+static void GSetIndexAttach(
+         GSet* const that,
+  GSetKeyType const type,
+         GSetHashFun hash,
+           GSetEqFun eq) {
+
+  // Allocate memory for the new index
+  GSetIndex* index = NULL;
+  MALLOC(index, sizeof(GSetIndex));
+  *index = (GSetIndex) {
+
+    .type = type,
+    .hash = hash,
+    .eq = eq,
+    .nbSlot = 16,
+    .nbUsed = 0,
+    .slots = NULL,
+
+  };
+  while (index->nbSlot < 2 * that->size) index->nbSlot *= 2;
+  index->slots = calloc(index->nbSlot, sizeof(GSetIndexSlot));
+  if (index->slots == NULL) {
+
+    free(index);
+    Raise(TryCatchExc_MallocFailed);
+
+  }
+
+  // Replace the current index, if any, with the new one
+  GSetIndexFree(&(that->index));
+  that->index = index;
+
+  // Index the elements
+  GSetIndexRebuild(index, that);
+
+}
+
+// Free the memory used by a hash index
+// Input:
+//   that: the index
+static void GSetIndexFree(
+  GSetIndex** const that) {
 
   // If the memory is already freed, nothing to do
   if (that == NULL || *that == NULL) return;
 
   // Free the memory
+  free((*that)->slots);
   free(*that);
   *that = NULL;
 
 }
 
-// Get the current data from a set
+// Mix the bits of a 64 bits integer (finalizer of splitmix64)
 // Input:
-//   that: the iterator
+//   x: the integer
 // Output:
-//   Return the current data
-#define GSETITERGET__(N, T)                               \
-T GSetIterGet_ ## N(                                      \
-  GSetIter const* const that) {                           \
-  if (that->elem == NULL) Raise(TryCatchExc_OutOfRange);  \
-  T data = that->elem->data.N;                            \
-  return data;                                            \
-}
+//   Return the mixed integer
+static size_t GSetHashMix(
+  uint64_t x) {
 
-GSETITERGET__(Char, char)
-GSETITERGET__(UChar, unsigned char)
-GSETITERGET__(Int, int)
-GSETITERGET__(UInt, unsigned int)
-GSETITERGET__(Long, long)
-GSETITERGET__(ULong, unsigned long)
-GSETITERGET__(Float, float)
-GSETITERGET__(Double, double)
-GSETITERGET__(Ptr, void*)
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return (size_t)x;
 
-// Pick the current data from a set
-// Input:
-//   that: the iterator
-//   set: the associated set
-// Output:
-//   Remove the current data from the set and return it
-#define GSETITERPICK__(N, T)                                                 \
-T GSetIterPick_ ## N(                                                        \
-  GSetIter* const that,                                                      \
-  GSet* const set) {                                                         \
-  if (that->elem == NULL) Raise(TryCatchExc_OutOfRange);                     \
-  T data = that->elem->data.N;                                               \
-  if (set->first == that->elem) set->first = set->first->next;               \
-  if (set->last == that->elem) set->last = set->last->prev;                  \
-  if (that->elem->next != NULL) that->elem->next->prev = that->elem->prev;   \
-  if (that->elem->prev != NULL) that->elem->prev->next = that->elem->next;   \
-  GSetElem* elem = that->elem;                                               \
-  if (GSetIterNext_(that) == false)                                          \
-    if (GSetIterPrev_(that) == false)                                        \
-      that->elem = NULL;                                                     \
-  GSetElemFree(&elem);                                                       \
-  --(set->size);                                                             \
-  return data;                                                               \
 }
 
-GSETITERPICK__(Char, char)
-GSETITERPICK__(UChar, unsigned char)
-GSETITERPICK__(Int, int)
-GSETITERPICK__(UInt, unsigned int)
-GSETITERPICK__(Long, long)
-GSETITERPICK__(ULong, unsigned long)
-GSETITERPICK__(Float, float)
-GSETITERPICK__(Double, double)
-GSETITERPICK__(Ptr, void*)
-
-// Reset the iterator to its first element
-// Input:
-//   that: the iterator
-//    set: the associated set
-void GSetIterReset_(
-    GSetIter* const that,
-  GSet const* const set) {
+// Get the hash of a data for a hash index
+// Inputs:
+//   that: the index
+//   data: the data
+// Output:
+//   Return the hash
+static size_t GSetIndexHash(
+        GSetIndex const* const that,
+  union GSetElemData const* const data) {
 
-  // Switch according to the type of iterator
+  // Switch according to the type of keys
   switch (that->type) {
 
-    case GSetIterForward:
-      that->elem = set->first;
-      break;
+    case GSetKeyType_Char:
+      return GSetHashMix((uint64_t)(data->Char));
+    case GSetKeyType_UChar:
+      return GSetHashMix((uint64_t)(data->UChar));
+    case GSetKeyType_Int:
+      return GSetHashMix((uint64_t)(data->Int));
+    case GSetKeyType_UInt:
+      return GSetHashMix((uint64_t)(data->UInt));
+    case GSetKeyType_Long:
+      return GSetHashMix((uint64_t)(data->Long));
+    case GSetKeyType_ULong:
+      return GSetHashMix((uint64_t)(data->ULong));
+    case GSetKeyType_Ptr:
+      return GSetHashMix((uint64_t)(uintptr_t)(data->Ptr));
+    case GSetKeyType_User:
+      return that->hash(data);
+
+    // -0.0 and 0.0 are equal and must have the same hash
+    case GSetKeyType_Float: {
+      float f = (data->Float == 0.0f ? 0.0f : data->Float);
+      uint32_t bits = 0;
+      memcpy(&bits, &f, sizeof(bits));
+      return GSetHashMix(bits);
+    }
+    case GSetKeyType_Double: {
+      double d = (data->Double == 0.0 ? 0.0 : data->Double);
+      uint64_t bits = 0;
+      memcpy(&bits, &d, sizeof(bits));
+      return GSetHashMix(bits);
+    }
+    default:
+      Raise(TryCatchExc_NotYetImplemented);
 
-    case GSetIterBackward:
-      that->elem = set->last;
-      break;
+  }
+
+  // Never reached
+  return 0;
+
+}
 
+// Check the equality of two data for a hash index
+// Inputs:
+//   that: the index
+//      a: the first data
+//      b: the second data
+// Output:
+//   Return true if the data are equal, false else
+static bool GSetIndexEq(
+        GSetIndex const* const that,
+  union GSetElemData const* const a,
+  union GSetElemData const* const b) {
+
+  // Switch according to the type of keys
+  switch (that->type) {
+
+    case GSetKeyType_Char:
+      return (a->Char == b->Char);
+    case GSetKeyType_UChar:
+      return (a->UChar == b->UChar);
+    case GSetKeyType_Int:
+      return (a->Int == b->Int);
+    case GSetKeyType_UInt:
+      return (a->UInt == b->UInt);
+    case GSetKeyType_Long:
+      return (a->Long == b->Long);
+    case GSetKeyType_ULong:
+      return (a->ULong == b->ULong);
+    case GSetKeyType_Float:
+      return (a->Float == b->Float);
+    case GSetKeyType_Double:
+      return (a->Double == b->Double);
+    case GSetKeyType_Ptr:
+      return (a->Ptr == b->Ptr);
+    case GSetKeyType_User:
+      return that->eq(a, b);
     default:
       Raise(TryCatchExc_NotYetImplemented);
 
   }
 
-  // Ensure the current element matches the current filter if any
-  if (that->elem != NULL && that->filter.fun != NULL) {
+  // Never reached
+  return false;
 
-    bool filtered =
-      that->filter.fun(
-        &(that->elem->data),
-        that->filter.params);
-    while (
-      that->elem != NULL &&
-      filtered == false) {
+}
 
-      if (GSetIterNext_(that) == false)
-        that->elem = NULL;
-      else
-        filtered =
-          that->filter.fun(
-            &(that->elem->data),
-            that->filter.params);
+// Insert an element in the slots of a hash index, without checking the
+// load of the index
+// Inputs:
+//   that: the index
+//   elem: the element
+//   hash: the hash of the element's data
+static void GSetIndexInsert(
+  GSetIndex* const that,
+   GSetElem* const elem,
+      size_t const hash) {
+
+  size_t mask = that->nbSlot - 1;
+  size_t iSlot = hash & mask;
+  while (that->slots[iSlot].elem != NULL) iSlot = (iSlot + 1) & mask;
+  that->slots[iSlot] = (GSetIndexSlot) { .elem = elem, .hash = hash };
+  ++(that->nbUsed);
+
+}
+
+// Add an element to a hash index
+// Inputs:
+//   that: the index
+//   elem: the element
+static void GSetIndexAdd(
+  GSetIndex* const that,
+   GSetElem* const elem) {
+
+  // If the load of the index is too high, double its number of slots
+  if (2 * (that->nbUsed + 1) > that->nbSlot) {
+
+    if (that->nbSlot > SIZE_MAX / (2 * sizeof(GSetIndexSlot)))
+      Raise(TryCatchExc_IntOverflow);
+    GSetIndexSlot* slots = calloc(2 * that->nbSlot, sizeof(GSetIndexSlot));
+    if (slots == NULL) Raise(TryCatchExc_MallocFailed);
+    GSetIndexSlot* prevSlots = that->slots;
+    size_t prevNbSlot = that->nbSlot;
+    that->slots = slots;
+    that->nbSlot *= 2;
+    that->nbUsed = 0;
+    FOR(iSlot, prevNbSlot)
+      if (prevSlots[iSlot].elem != NULL)
+        GSetIndexInsert(
+          that,
+          prevSlots[iSlot].elem,
+          prevSlots[iSlot].hash);
+    free(prevSlots);
+
+  }
+
+  // Insert the element
+  GSetIndexInsert(
+    that,
+    elem,
+    GSetIndexHash(that, &(elem->data)));
+
+}
+
+// Remove an element from a hash index
+// Inputs:
+//   that: the index
+//   elem: the element
+static void GSetIndexRemove(
+  GSetIndex* const that,
+   GSetElem* const elem) {
+
+  // Search the slot of the element
+  size_t mask = that->nbSlot - 1;
+  size_t iSlot = GSetIndexHash(that, &(elem->data)) & mask;
+  while (that->slots[iSlot].elem != elem) {
+
+    // If the element is not in the index, nothing to do
+    if (that->slots[iSlot].elem == NULL) return;
+    iSlot = (iSlot + 1) & mask;
+
+  }
+
+  // Shift back the following slots which can be moved to the emptied slot
+  size_t jSlot = iSlot;
+  while (true) {
+
+    jSlot = (jSlot + 1) & mask;
+    if (that->slots[jSlot].elem == NULL) break;
+    size_t kSlot = that->slots[jSlot].hash & mask;
+    bool isMovable =
+      (iSlot <= jSlot ?
+        (kSlot <= iSlot || kSlot > jSlot) :
+        (kSlot <= iSlot && kSlot > jSlot));
+    if (isMovable) {
+
+      that->slots[iSlot] = that->slots[jSlot];
+      iSlot = jSlot;
+
+    }
+
+  }
+  that->slots[iSlot].elem = NULL;
+  --(that->nbUsed);
+
+}
+
+// Search an element containing a data in a hash index
+// Inputs:
+//   that: the index
+//   data: the data
+// Output:
+//   Return one of the elements containing the data, or NULL if there is none
+static GSetElem* GSetIndexSearch(
+        GSetIndex const* const that,
+  union GSetElemData const* const data) {
+
+  size_t hash = GSetIndexHash(that, data);
+  size_t mask = that->nbSlot - 1;
+  size_t iSlot = hash & mask;
+  while (that->slots[iSlot].elem != NULL) {
+
+    if (
+      that->slots[iSlot].hash == hash &&
+      GSetIndexEq(that, &(that->slots[iSlot].elem->data), data)) {
+
+      return that->slots[iSlot].elem;
+
+    }
+    iSlot = (iSlot + 1) & mask;
+
+  }
+
+  return NULL;
+
+}
+
+// Empty a hash index and index all the elements of a set
+// Inputs:
+//   that: the index
+//    set: the set (if NULL the index is only emptied)
+static void GSetIndexRebuild(
+  GSetIndex* const that,
+  GSet const* const set) {
+
+  memset(that->slots, 0, sizeof(GSetIndexSlot) * that->nbSlot);
+  that->nbUsed = 0;
+  if (set != NULL)
+    for (GSetElem* ptr = set->first; ptr != NULL; ptr = ptr->next)
+      GSetIndexAdd(that, ptr);
+
+}
+
+// Create a new GSetIter
+// Input:
+//   type: the type of iteration
+// Output:
+//   Return the new GSetIter.
+GSetIter GSetIterCreate(
+  GSetIterType const type) {
+
+  // Create the GSet
+  GSetIter that = (GSetIter) {
+
+    .elem = NULL,
+    .type = type,
+    .filter = (GSetIterFilter) { .fun = NULL, .params = NULL },
+    .isConcurrent = false,
+
+  };
+
+  // Return the GSet
+  return that;
+
+}
+
+// Apply the function of a range on each of its elements
+// Input:
+//   arg: the GSetParallelRange
+// Output:
+//   Return NULL.
+static void* GSetParallelRangeRun(
+  void* arg) {
+
+  GSetParallelRange* range = arg;
+  FOR(iElem, range->nb) {
 
-    }
+    range->fun(
+      &(range->iter.elem->data),
+      range->params,
+      range->acc);
+    if (iElem < range->nb - 1) GSetIterNext_(&(range->iter));
 
   }
 
+  return NULL;
+
 }
 
-// Check if the iterator is ready
-// Input:
-//   that: the iterator
-// Output:
-//   Return true if the iterator is on an element of its set, false else
-//   (either it's because the set is empty, or the iterator's filter has
-//   no matching element in the set)
-bool GSetIterIsReady_(
-    GSetIter* const that) {
+// Take the range at the head of the queue of the pool, process it, and
+// signal it's done. The pool must be locked by the calling thread, it is
+// unlocked while the range is processed.
+static void GSetPoolProcessHead(
+  void) {
 
-  if (that->elem == NULL)
-    return false;
-  else
-    return true;
+  GSetPool* pool = &GSetPoolShared;
+  GSetParallelRange* range = pool->head;
+  pool->head = range->next;
+  if (pool->head == NULL) pool->tail = NULL;
+  pthread_mutex_unlock(&(pool->mutex));
+  GSetParallelRangeRun(range);
+  pthread_mutex_lock(&(pool->mutex));
+  --(*(range->nbPending));
+  pthread_cond_broadcast(&(pool->done));
 
 }
 
-// Move the iterator to the next element
+// Function of the threads of the pool: process the queued ranges until
+// the pool is stopped
 // Input:
-//   that: the iterator
+//   unused: unused, for compatibility with pthread_create
 // Output:
-// Return true if the iterator could move to the next element, else false
-bool GSetIterNext_(
-  GSetIter* const that) {
+//   Return NULL.
+static void* GSetPoolWorker(
+  void* unused) {
 
-  if (that->elem == NULL) return false;
+  (void)unused;
+  GSetPool* pool = &GSetPoolShared;
+  pthread_mutex_lock(&(pool->mutex));
+  while (true) {
 
-  // Variable to memorise the returned flag
-  bool flag = false;
+    // The queued ranges are processed even if the pool is stopping, as
+    // their calling threads wait for them
+    if (pool->head != NULL) GSetPoolProcessHead();
+    else if (pool->isStopping) break;
+    else pthread_cond_wait(&(pool->queued), &(pool->mutex));
 
-  // Switch according to the type of iterator
-  switch (that->type) {
+  }
 
-    case GSetIterForward:
-      if (that->elem->next != NULL) {
+  pthread_mutex_unlock(&(pool->mutex));
+  return NULL;
 
-        if (that->filter.fun == NULL) {
+}
+
+// Stop the threads of the pool when the program exits
+static void GSetPoolAtExit(
+  void) {
 
-          that->elem = that->elem->next;
-          flag = true;
+  // Stop the threads. If exit() is called from one of them it can't wait
+  // for itself, the threads are then left to the end of the process
+  GSetPool* pool = &GSetPoolShared;
+  pthread_mutex_lock(&(pool->mutex));
+  pool->isStopping = true;
+  pthread_cond_broadcast(&(pool->queued));
+  bool isWorker = false;
+  FOR(iWorker, pool->nbWorker)
+    if (pthread_equal(pool->workers[iWorker], pthread_self()))
+      isWorker = true;
+  pthread_mutex_unlock(&(pool->mutex));
+  if (isWorker) return;
+
+  // Wait for the threads, which release their slabs on exit
+  FOR(iWorker, pool->nbWorker) pthread_join(pool->workers[iWorker], NULL);
+  pool->nbWorker = 0;
 
-        } else {
+}
 
-          GSetElem* nextElem = that->elem->next;
-          bool filtered =
-            that->filter.fun(
-              &(nextElem->data),
-              that->filter.params);
-          while (
-            nextElem != NULL &&
-            filtered == false) {
+// Process ranges with the threads of the pool and the calling thread
+// Inputs:
+//   ranges: the ranges
+//       nb: the number of ranges, the first one being processed by the
+//           calling thread
+static void GSetPoolRun(
+  GSetParallelRange* const ranges,
+        size_t const nb) {
 
-            if (nextElem->next != NULL) {
+  GSetPool* pool = &GSetPoolShared;
+  size_t nbPending = nb - 1;
+  pthread_mutex_lock(&(pool->mutex));
 
-              nextElem = nextElem->next;
-              filtered =
-                that->filter.fun(
-                  &(nextElem->data),
-                  that->filter.params);
+  // Queue the ranges except the first one
+  for (size_t iRange = 1; iRange < nb; ++iRange) {
 
-            } else nextElem = NULL;
+    ranges[iRange].nbPending = &nbPending;
+    if (pool->tail == NULL) pool->head = ranges + iRange;
+    else pool->tail->next = ranges + iRange;
+    pool->tail = ranges + iRange;
 
-          }
+  }
 
-          if (nextElem != NULL) {
+  // Create the missing threads. If a thread can't be created, the ranges
+  // are processed by the existing threads and the calling thread.
+  if (pool->hasAtExit == false)
+    pool->hasAtExit = (atexit(GSetPoolAtExit) == 0);
+  while (
+    pool->hasAtExit &&
+    pool->isStopping == false &&
+    pool->nbWorker < nb - 1 &&
+    pool->nbWorker < GSET_POOL_NB_WORKER) {
+
+    int ret =
+      pthread_create(
+        pool->workers + pool->nbWorker, NULL, GSetPoolWorker, NULL);
+    if (ret != 0) break;
+    ++(pool->nbWorker);
 
-            that->elem = nextElem;
-            flag = true;
+  }
 
-          }
+  pthread_cond_broadcast(&(pool->queued));
+  pthread_mutex_unlock(&(pool->mutex));
 
-        }
+  // Process the first range in the calling thread
+  GSetParallelRangeRun(ranges);
 
-      }
+  // Wait for the other ranges, processing the queued ones meanwhile
+  pthread_mutex_lock(&(pool->mutex));
+  while (nbPending > 0) {
 
-      break;
+    if (pool->head != NULL) GSetPoolProcessHead();
+    else pthread_cond_wait(&(pool->done), &(pool->mutex));
 
-    case GSetIterBackward:
-      if (that->elem->prev != NULL) {
+  }
 
-        if (that->filter.fun == NULL) {
+  pthread_mutex_unlock(&(pool->mutex));
 
-          that->elem = that->elem->prev;
-          flag = true;
+}
 
-        } else {
+// Combine a sorted set into another sorted set with a single merge pass
+// Inputs:
+//    that: the first set, receiving the result
+//     tho: the second set
+//     cmp: the comparison function the sets are sorted with
+//   flags: the flags (cf GSetAlgebraFlag)
+//      op: the operation
+static void GSetAlgebra(
+           GSet* const that,
+           GSet* const tho,
+  int (* const cmp)(void const*, void const*),
+             int const flags,
+   GSetAlgebraOp const op) {
+
+  // A set combined with itself is either unchanged or emptied
+  if (that == tho) {
+
+    if (op == GSetAlgebraOp_Difference || op == GSetAlgebraOp_SymDiff)
+      GSetEmpty_(that);
+    return;
+
+  }
+
+  bool const inPlace = ((flags & GSetAlgebra_InPlace) != 0);
+  bool const gallop = ((flags & GSetAlgebra_Gallop) != 0);
+
+  // What is kept of the elements only in that, only in tho, and of the
+  // element of that matching an element of tho
+  bool const keepThat = (op != GSetAlgebraOp_Intersect);
+  bool const keepTho =
+    (op == GSetAlgebraOp_Union || op == GSetAlgebraOp_SymDiff);
+  bool const keepCommon =
+    (op == GSetAlgebraOp_Union || op == GSetAlgebraOp_Intersect);
 
-          GSetElem* prevElem = that->elem->prev;
-          bool filtered =
-            that->filter.fun(
-              &(prevElem->data),
-              that->filter.params);
-          while (
-            prevElem != NULL &&
-            filtered == false) {
+  // Loop on the elements of tho
+  GSetElem* a = that->first;
+  GSetElem* b = tho->first;
+  while (b != NULL) {
 
-            if (prevElem->prev != NULL) {
+    // If the remaining elements of tho are all to be moved at the tail of
+    // that, move them at once
+    if (a == NULL && inPlace && keepTho) {
 
-              prevElem = prevElem->prev;
-              filtered =
-                that->filter.fun(
-                  &(prevElem->data),
-                  that->filter.params);
+      GSetMerge_(that, tho);
+      break;
+
+    }
 
-            } else prevElem = NULL;
+    int const c = (a == NULL ? 1 : cmp(&(a->data), &(b->data)));
 
-          }
+    // If the current element of that is lower than the one of tho, it and
+    // the following ones lower than the one of tho are only in that
+    if (c < 0) {
 
-          if (prevElem != NULL) {
+      GSetElem* const end =
+        (gallop ? GSetElemLowerBound(a->next, &(b->data), cmp) : a->next);
+      while (a != end) {
 
-            that->elem = prevElem;
-            flag = true;
+        GSetElem* next = a->next;
+        if (keepThat == false) {
 
-          }
+          GSetRemoveElem(that, a);
+          GSetElemRelease(that, &a);
 
         }
 
+        a = next;
+
       }
 
-      break;
+      continue;
 
-    default:
-      Raise(TryCatchExc_NotYetImplemented);
+    }
 
-  }
+    // Get the range of elements of tho to process: the current one if it
+    // matches the one of that, else it and the following ones lower than
+    // the one of that
+    GSetElem* end = b->next;
+    bool keep = keepTho;
+    if (c == 0) {
 
-  // Return the flag
-  return flag;
+      GSetElem* next = a->next;
+      if (keepCommon == false) {
 
-}
+        GSetRemoveElem(that, a);
+        GSetElemRelease(that, &a);
 
-// Move the iterator to the previous element
-// Input:
-//   that: the iterator
-// Output:
-// Return true if the iterator could move to the previous element, else false
-bool GSetIterPrev_(
-  GSetIter* const that) {
+      }
 
-  if (that->elem == NULL) return false;
+      a = next;
+      keep = false;
 
-  // Variable to memorise the returned flag
-  bool flag = false;
+    } else if (gallop && a != NULL) {
 
-  // Switch according to the type of iterator
-  switch (that->type) {
+      end = GSetElemLowerBound(b->next, &(a->data), cmp);
 
-    case GSetIterForward:
-      if (that->elem->prev != NULL) {
+    } else if (a == NULL) {
 
-        if (that->filter.fun == NULL) {
+      end = NULL;
 
-          that->elem = that->elem->prev;
-          flag = true;
+    }
 
-        } else {
+    // Add the elements of the range before the current element of that,
+    // moving or copying them
+    while (b != end) {
 
-          GSetElem* prevElem = that->elem->prev;
-          bool filtered =
-            that->filter.fun(
-              &(prevElem->data),
-              that->filter.params);
-          while (
-            prevElem != NULL &&
-            filtered == false) {
+      GSetElem* next = b->next;
+      if (inPlace) GSetRemoveElem(tho, b);
+      if (keep) {
 
-            if (prevElem->prev != NULL) {
+        GSetElem* elem = b;
+        if (inPlace == false) {
 
-              prevElem = prevElem->prev;
-              filtered =
-                that->filter.fun(
-                  &(prevElem->data),
-                  that->filter.params);
+          elem = GSetElemAlloc();
+          elem->data = b->data;
 
-            } else prevElem = NULL;
+        }
 
-          }
+        if (a != NULL) {
 
-          if (prevElem != NULL) {
+          if (that->size > SIZE_MAX - 1) Raise(TryCatchExc_IntOverflow);
+          GSetElemAddElemBefore(a, elem, that);
 
-            that->elem = prevElem;
-            flag = true;
+        } else {
 
-          }
+          elem->next = NULL;
+          GSetAddElem(that, elem);
 
         }
 
+      } else if (inPlace) {
+
+        GSetElemRelease(tho, &b);
+
       }
 
-      break;
+      b = next;
 
-    case GSetIterBackward:
-      if (that->elem->next != NULL) {
+    }
+
+  }
 
-        if (that->filter.fun == NULL) {
+  // The remaining elements of that are only in that
+  if (keepThat == false) {
 
-          that->elem = that->elem->next;
-          flag = true;
+    while (a != NULL) {
 
-        } else {
+      GSetElem* next = a->next;
+      GSetRemoveElem(that, a);
+      GSetElemRelease(that, &a);
+      a = next;
+
+    }
+
+  }
+
+}
+
+// Search the first element of a sorted chain not lower than a data, with
+// an exponential search followed by a binary search
+// Inputs:
+//   elem: the head of the chain
+//   data: the data
+//    cmp: the comparison function the chain is sorted with
+// Output:
+//   Return the element, or NULL if all the elements are lower than the data
+static GSetElem* GSetElemLowerBound(
+                 GSetElem* const elem,
+  union GSetElemData const* const data,
+  int (* const cmp)(void const*, void const*)) {
 
-          GSetElem* nextElem = that->elem->next;
-          bool filtered =
-            that->filter.fun(
-              &(nextElem->data),
-              that->filter.params);
-          while (
-            nextElem != NULL &&
-            filtered == false) {
+  if (elem == NULL || cmp(&(elem->data), data) >= 0) return elem;
 
-            if (nextElem->next != NULL) {
+  // Double the step until an element not lower than the data is found.
+  // lo is always lower than the data
+  GSetElem* lo = elem;
+  size_t step = 1;
+  while (true) {
 
-              nextElem = nextElem->next;
-              filtered =
-                that->filter.fun(
-                  &(nextElem->data),
-                  that->filter.params);
+    GSetElem* hi = lo;
+    size_t nb = 0;
+    while (nb < step && hi->next != NULL) {
 
-            } else nextElem = NULL;
+      hi = hi->next;
+      ++nb;
 
-          }
+    }
+
+    if (cmp(&(hi->data), data) >= 0) {
+
+      // The searched element is in the nb elements after lo, up to hi
+      while (nb > 1) {
+
+        size_t half = nb / 2;
+        GSetElem* mid = lo;
+        FOR(i, half) mid = mid->next;
+        if (cmp(&(mid->data), data) >= 0) {
 
-          if (nextElem != NULL) {
+          hi = mid;
+          nb = half;
 
-            that->elem = nextElem;
-            flag = true;
+        } else {
 
-          }
+          lo = mid;
+          nb -= half;
 
         }
 
       }
 
-      break;
+      return hi;
 
-    default:
-      Raise(TryCatchExc_NotYetImplemented);
+    }
 
-  }
+    if (hi->next == NULL) return NULL;
+    lo = hi;
+    step *= 2;
 
-  // Return the flag
-  return flag;
+  }
 
 }
 
-// Check if an iterator is on its first element
-// Input:
-//   that: the iterator
-// Output:
-// Return true if the iterator is on its first element, else false
-bool GSetIterIsFirst_(
-  GSetIter* const that) {
+// Move down a head in the min-heap of a k-way merge until the heap property
+// is restored
+// Inputs:
+//   heap: the heap
+//     nb: the number of heads in the heap
+//      i: the position of the head to move
+//    cmp: the comparison function
+static void GSetMergeHeapSiftDown(
+  GSetMergeHead* const heap,
+          size_t const nb,
+                 size_t i,
+  int (* const cmp)(void const*, void const*)) {
+
+  GSetMergeHead head = heap[i];
+  while (2 * i + 1 < nb) {
+
+    // Get the lowest child, ties being broken by the rank of the chains
+    size_t child = 2 * i + 1;
+    if (child + 1 < nb) {
+
+      int c = cmp(&(heap[child + 1].elem->data), &(heap[child].elem->data));
+      if (c < 0 || (c == 0 && heap[child + 1].rank < heap[child].rank))
+        ++child;
 
-  if (that->elem == NULL) Raise(TryCatchExc_OutOfRange);
+    }
 
-  // Try to go the the previous element with a clone of the iterator and
-  // return true if it couldn't move
-  GSetIter clone = *that;
-  return (GSetIterPrev_(&clone) == false);
+    int c = cmp(&(heap[child].elem->data), &(head.elem->data));
+    if (c > 0 || (c == 0 && heap[child].rank > head.rank)) break;
+    heap[i] = heap[child];
+    i = child;
+
+  }
+
+  heap[i] = head;
 
 }
 
-// Check if an iterator is on its last element
-// Input:
-//   that: the iterator
+// Allocate memory for a new node of skip list
+// Inputs:
+//      elem: the element of the node
+//   nbLevel: the number of levels of the node
 // Output:
-// Return true if the iterator is on its last element, else false
-bool GSetIterIsLast_(
-  GSetIter* const that) {
-
-  if (that->elem == NULL) Raise(TryCatchExc_OutOfRange);
+//   Return the new node
+static GSetSkipNode* GSetSkipNodeAlloc(
+  GSetElem* const elem,
+     size_t const nbLevel) {
 
-  // Try to go the the previous element with a clone of the iterator and
-  // return true if it couldn't move
-  GSetIter clone = *that;
-  return (GSetIterNext_(&clone) == false);
+  GSetSkipNode* that = NULL;
+  MALLOC(that, sizeof(GSetSkipNode) + sizeof(GSetSkipNode*) * nbLevel);
+  that->elem = elem;
+  that->nbLevel = nbLevel;
+  FOR(iLvl, nbLevel) that->next[iLvl] = NULL;
+  return that;
 
 }
 
-// Clone an iterator
-// Input:
-//   that: the iterator
+// Get the skip list of a sorted set, building it if the set has none or
+// if it was built with another comparison function
+// Inputs:
+//   that: the set, sorted according to cmp
+//    cmp: the comparison function
 // Output:
-//   Return a clone of the iterator
-GSetIter* GSetIterClone_(
-  GSetIter const* const that) {
+//   Return the skip list
+static GSetSkipList* GSetSkipListGet(
+  GSet* const that,
+  int (* const cmp)(void const*, void const*)) {
 
-  // Allocate memory for the clone
-  GSetIter* clone = GSetIterAlloc(that->type);
+  if (that->skipList != NULL && that->skipList->cmp == cmp)
+    return that->skipList;
+  GSetSkipListFree(&(that->skipList));
 
-  // Copy the iterator
-  *clone = *that;
+  // Create the skip list
+  GSetSkipList* skipList = NULL;
+  MALLOC(skipList, sizeof(GSetSkipList));
+  *skipList = (GSetSkipList) {
 
-  // Return the clone
-  return clone;
+    .cmp = cmp,
+    .nbLevel = 1,
+    .rnd = 0x9E3779B97F4A7C15,
+    .head = NULL,
 
-}
+  };
+  Try {
 
-// Set the type of an iterator
-// Input:
-//   that: the iterator
-//   type: the type
-void GSetIterSetType_(
-     GSetIter* const that,
-  GSetIterType const type) {
+    skipList->head = GSetSkipNodeAlloc(NULL, GSET_SKIP_MAX_LEVEL);
 
-  // Set the type
-  that->type = type;
+  } CatchDefault {
 
-}
+    free(skipList);
 
-// Get the type of an iterator
-// Input:
-//   that: the iterator
-// Return the type of the iterator
-GSetIterType GSetIterGetType_(
-  GSetIter const* const that) {
+  } EndCatch;
+  ForwardExc();
 
-  // Return the type
-  return that->type;
+  // Add the elements of the set, in order, at the tail of the list
+  GSetSkipNode* tails[GSET_SKIP_MAX_LEVEL];
+  FOR(iLvl, GSET_SKIP_MAX_LEVEL) tails[iLvl] = skipList->head;
+  Try {
 
-}
+    for (GSetElem* ptr = that->first; ptr != NULL; ptr = ptr->next) {
 
-// Set the filter of an iterator
-// Inputs:
-//     that: the iterator
-//      fun: the filter's function
-//   params: the parameters of the filter's function
-void GSetIterSetFilter_(
-    GSetIter* const that,
-  GSetIterFilterFun fun,
-              void* params) {
+      GSetSkipNode* node =
+        GSetSkipNodeAlloc(ptr, GSetSkipListRandLevel(skipList));
+      if (skipList->nbLevel < node->nbLevel)
+        skipList->nbLevel = node->nbLevel;
+      FOR(iLvl, node->nbLevel) {
 
-  that->filter.fun = fun;
-  that->filter.params = params;
+        tails[iLvl]->next[iLvl] = node;
+        tails[iLvl] = node;
 
-}
+      }
 
-// Get the filter's function parameters
-// Input:
-//     that: the iterator
-// Output:
-//   Return the parameters of the filter's function
-void* GSetIterGetFilterParam_(
-  GSetIter* const that) {
+    }
 
-  return that->filter.params;
+  } CatchDefault {
 
-}
+    GSetSkipListFree(&skipList);
 
-// Count the number of elements enumerated by an iterator
-// Inputs:
-//   that: the iterator
-//    set: the set
-// Output:
-//   Return the number of elements
-size_t GSetIterCount_(
-  GSetIter const* const that,
-      GSet const* const set) {
+  } EndCatch;
+  ForwardExc();
 
-  // Create a clone to leave the iterator unchanged
-  GSetIter clone = *that;
+  that->skipList = skipList;
+  return skipList;
 
-  // Variable to memorise the number of elements
-  size_t nb = 0;
+}
 
-  // Count the elements
-  GSetIterReset_(
-    &clone,
-    set);
-  if (clone.elem != NULL) {
+// Free the memory used by a skip list
+// Input:
+//   that: the skip list
+static void GSetSkipListFree(
+  GSetSkipList** const that) {
 
-    nb = 1;
-    while (GSetIterNext_(&clone) == true) ++nb;
+  if (that == NULL || *that == NULL) return;
+  GSetSkipNode* node = (*that)->head;
+  while (node != NULL) {
+
+    GSetSkipNode* next = node->next[0];
+    free(node);
+    node = next;
 
   }
 
-  // Return the number of element
-  return nb;
+  free(*that);
+  *that = NULL;
 
 }
 
-// Deallocation functions for GSet<N>Flush on default typed GSet
-
-#define FREE_(N, T)                                                          \
-void N ## Free(T* const that) {                                              \
-  if (that == NULL || *that == NULL) return;                                 \
-  free(*that); *that = NULL;                                                 \
-}
+// Get a random number of levels for a new node of a skip list
+// Input:
+//   that: the skip list
+// Output:
+//   Return the number of levels, in [1, GSET_SKIP_MAX_LEVEL]
+static size_t GSetSkipListRandLevel(
+  GSetSkipList* const that) {
 
-FREE_(CharPtr, char*)
-FREE_(UCharPtr, unsigned char*)
-FREE_(IntPtr, int*)
-FREE_(UIntPtr, unsigned int*)
-FREE_(LongPtr, long*)
-FREE_(ULongPtr, unsigned long*)
-FREE_(FloatPtr, float*)
-FREE_(DoublePtr, double*)
-FREE_(Str, char*)
+  // Xorshift generator, each additional level has a probability of 1/4
+  that->rnd ^= that->rnd << 13;
+  that->rnd ^= that->rnd >> 7;
+  that->rnd ^= that->rnd << 17;
+  uint64_t bits = that->rnd;
+  size_t nbLevel = 1;
+  while (nbLevel < GSET_SKIP_MAX_LEVEL && (bits & 3) == 0) {
 
-// Comparison functions for GSet<N>Sort on default typed GSet
+    ++nbLevel;
+    bits >>= 2;
 
-int GSetCharCmp(
-  void const* a,
-  void const* b) {
+  }
 
-  return (*(char const*)a < *(char const*)b ? -1 :
-          *(char const*)a > *(char const*)b ? 1 : 0);
+  return nbLevel;
 
 }
 
-int GSetUCharCmp(
-  void const* a,
-  void const* b) {
+// Search the first node of a skip list whose data is not lower (or greater
+// if upper is true) than a data
+// Inputs:
+//     that: the skip list
+//     data: the data
+//    upper: the flag to search for the upper bound instead of the lower one
+//   update: if not NULL, receives for each level the last node before the
+//           searched one
+// Output:
+//   Return the node, or NULL if there is none
+static GSetSkipNode* GSetSkipListSearch(
+  GSetSkipList const* const that,
+          void const* const data,
+                 bool const upper,
+        GSetSkipNode** const update) {
 
-  return (*(unsigned char const*)a < *(unsigned char const*)b ? -1 :
-          *(unsigned char const*)a > *(unsigned char const*)b ? 1 : 0);
+  GSetSkipNode* node = that->head;
+  for (size_t iLvl = that->nbLevel; iLvl > 0; --iLvl) {
 
-}
+    GSetSkipNode* next = node->next[iLvl - 1];
+    while (next != NULL) {
 
-int GSetIntCmp(
-  void const* a,
-  void const* b) {
+      int c = that->cmp(&(next->elem->data), data);
+      if (c > 0 || (c == 0 && upper == false)) break;
+      node = next;
+      next = node->next[iLvl - 1];
 
-  return (*(int const*)a < *(int const*)b ? -1 :
-          *(int const*)a > *(int const*)b ? 1 : 0);
+    }
 
-}
+    if (update != NULL) update[iLvl - 1] = node;
 
-int GSetUIntCmp(
-  void const* a,
-  void const* b) {
+  }
 
-  return (*(unsigned int const*)a < *(unsigned int const*)b ? -1 :
-          *(unsigned int const*)a > *(unsigned int const*)b ? 1 : 0);
+  return node->next[0];
 
 }
 
-int GSetLongCmp(
-  void const* a,
-  void const* b) {
+// Remove the node of an element from a skip list
+// Inputs:
+//   that: the skip list
+//   elem: the element
+static void GSetSkipListRemove(
+  GSetSkipList* const that,
+      GSetElem* const elem) {
 
-  return (*(long const*)a < *(long const*)b ? -1 :
-          *(long const*)a > *(long const*)b ? 1 : 0);
+  // Search the first node with the same data, then move along the nodes
+  // with the same data up to the one of the element, keeping track of the
+  // last node before it on each level
+  GSetSkipNode* update[GSET_SKIP_MAX_LEVEL];
+  GSetSkipListSearch(that, &(elem->data), false, update);
+  GSetSkipNode* node = update[0]->next[0];
+  while (node != NULL && node->elem != elem) {
 
-}
+    FOR(iLvl, node->nbLevel) update[iLvl] = node;
+    node = node->next[0];
 
-int GSetULongCmp(
-  void const* a,
-  void const* b) {
+  }
 
-  return (*(unsigned long const*)a < *(unsigned long const*)b ? -1 :
-          *(unsigned long const*)a > *(unsigned long const*)b ? 1 : 0);
+  // The element is always in the list, but stay safe if it is not
+  if (node == NULL) return;
+
+  // Unlink and free the node
+  FOR(iLvl, node->nbLevel) update[iLvl]->next[iLvl] = node->next[iLvl];
+  free(node);
+  while (that->nbLevel > 1 && that->head->next[that->nbLevel - 1] == NULL)
+    --(that->nbLevel);
 
 }
 
-int GSetFloatCmp(
-  void const* a,
-  void const* b) {
+// Move an iterator on the first element of a sorted set whose data is not
+// lower (or greater if upper is true) than a data
+// Inputs:
+//    that: the iterator
+//     set: the set, sorted according to cmp
+//    data: the data
+//     cmp: the comparison function
+//   upper: the flag to search for the upper bound instead of the lower one
+// Output:
+//   Return true if the iterator has been moved, false if there is no such
+//   element
+static bool GSetIterBound(
+   GSetIter* const that,
+       GSet* const set,
+  void const* const data,
+  int (* const cmp)(void const*, void const*),
+        bool const upper) {
+
+  GSetSkipNode* node =
+    GSetSkipListSearch(GSetSkipListGet(set, cmp), data, upper, NULL);
+  GSetElem* elem = (node != NULL ? node->elem : NULL);
+
+  // Skip the elements rejected by the filter of the iterator
+  if (that->filter.fun != NULL)
+    while (
+      elem != NULL &&
+      that->filter.fun(&(elem->data), that->filter.params) == false)
+      elem = elem->next;
 
-  float x = *(float*)a;
-  float y = *(float*)b;
-  if ((x - y) > DBL_EPSILON) return 1;
-  else if ((x - y) < -DBL_EPSILON) return -1;
-  else return 0;
+  if (elem == NULL) return false;
+  that->elem = elem;
+  return true;
 
 }
 
-int GSetDoubleCmp(
-  void const* a,
-  void const* b) {
+// Move a chain of elements from a set to another
+// Inputs:
+//     that: the set containing the chain
+//    first: the first element of the chain
+//     last: the last element of the chain
+//       nb: the number of elements in the chain
+//      dst: the set receiving the chain
+//   before: the element of dst before which the chain is inserted (NULL to
+//           insert it at the tail of dst)
+static void GSetMoveChain(
+       GSet* const that,
+   GSetElem* const first,
+   GSetElem* const last,
+      size_t const nb,
+       GSet* const dst,
+   GSetElem* const before) {
 
-  double x = *(double*)a;
-  double y = *(double*)b;
-  if ((x - y) > DBL_EPSILON) return 1;
-  else if ((x - y) < -DBL_EPSILON) return -1;
-  else return 0;
+  // Check for overflow
+  if (dst->size > SIZE_MAX - nb) Raise(TryCatchExc_IntOverflow);
 
-}
+  // Move the elements from the index of that to the one of dst
+  if (that->index != NULL || dst->index != NULL) {
 
-int GsetCharPtrCmp(
-  void const* a,
-  void const* b) {
+    for (GSetElem* ptr = first; ptr != last->next; ptr = ptr->next) {
 
-  char const* sa = *(char* const*)a;
-  char const* sb = *(char* const*)b;
-  if (sa == NULL && sb == NULL) return 0;
-  if (sa == NULL && sb != NULL) return -1;
-  if (sa != NULL && sb == NULL) return 1;
-  return strcmp(
-    sa,
-    sb);
+      if (that->index != NULL) GSetIndexRemove(that->index, ptr);
+      if (dst->index != NULL) GSetIndexAdd(dst->index, ptr);
 
-}
+    }
 
-// ================== Private functions definition =========================
+  }
 
-// Create a new GSetElem
-// Output:
-//   Return the new GSetElem.
-static GSetElem GSetElemCreate(
-  void) {
+  // The skip lists would reference the moved elements, and dst may not be
+  // sorted anymore
+  GSetSkipListFree(&(that->skipList));
+  GSetSkipListFree(&(dst->skipList));
+  GSetWindowInvalidate(that->window);
+  GSetWindowInvalidate(dst->window);
+
+  // Unlink the chain
+  if (first->prev != NULL) first->prev->next = last->next;
+  else that->first = last->next;
+  if (last->next != NULL) last->next->prev = first->prev;
+  else that->last = first->prev;
+  that->size -= nb;
+
+  // Link the chain before the element or at the tail of dst
+  if (before == NULL) {
+
+    first->prev = dst->last;
+    last->next = NULL;
+    if (dst->last != NULL) dst->last->next = first;
+    else dst->first = first;
+    dst->last = last;
 
-  // Create the GSetElem
-  GSetElem that = (GSetElem) {
+  } else {
 
-    .prev = NULL,
-    .next = NULL,
+    first->prev = before->prev;
+    last->next = before;
+    if (before->prev != NULL) before->prev->next = first;
+    else dst->first = first;
+    before->prev = last;
 
-  };
+  }
 
-  // Return the GSetElem
-  return that;
+  dst->size += nb;
 
 }
 
-// Allocate memory for a new GSetElem
-// Output:
-//   Return the new GSetElem.
-static GSetElem* GSetElemAlloc(
-  void) {
+// Attach a new window aggregate to a set
+// Inputs:
+//   that: the set
+//   type: the type of data
+static void GSetWindowAttach(
+         GSet* const that,
+  GSetKeyType const type) {
 
-  // Allocate memory for the element
-  GSetElem* that = NULL;
-  MALLOC(that, sizeof(GSetElem));
+  // Create the window aggregate, computed at the first query
+  GSetWindow* window = NULL;
+  MALLOC(window, sizeof(GSetWindow));
+  *window = (GSetWindow) {
 
-  // Create the element
-  *that = GSetElemCreate();
+    .type = type,
+    .isValid = false,
+    .isMinMaxValid = false,
+    .comp = 0.0,
+    .nbPosInf = 0,
+    .nbNegInf = 0,
+    .nbNaN = 0,
+    .min = { .elems = NULL, .nbSlot = 0, .head = 0, .nb = 0 },
+    .max = { .elems = NULL, .nbSlot = 0, .head = 0, .nb = 0 },
 
-  // Return the new GSetElem
-  return that;
+  };
+
+  // Replace the current window aggregate
+  GSetWindowFree(&(that->window));
+  that->window = window;
 
 }
 
-// Free the memory used by a GSetElem, do not free the memory used by the data
-// it contains.
+// Free the memory used by a window aggregate
 // Input:
-//   that: the GSetElem to be freed
-static void GSetElemFree(
-  GSetElem** const that) {
+//   that: the window aggregate
+static void GSetWindowFree(
+  GSetWindow** const that) {
 
-  // If the memory is already freed, nothing to do
   if (that == NULL || *that == NULL) return;
-
-  // Free the memory
+  free((*that)->min.elems);
+  free((*that)->max.elems);
   free(*that);
   *that = NULL;
 
 }
 
-// Add an element before a given element
-// Inputs:
-//   that: the GSetElem before which the new element must be added
-//   elem: the GSetElem to be added
-//    set: the GSet containing 'that'
-static void GSetElemAddElemBefore(
-  GSetElem* const that,
-  GSetElem* const elem,
-      GSet* const set) {
+// Invalidate a window aggregate, which will be recomputed at the next query
+// Input:
+//   that: the window aggregate (may be NULL)
+static void GSetWindowInvalidate(
+  GSetWindow* const that) {
 
-  // Add the new element
-  if (that->prev != NULL) that->prev->next = elem;
-  elem->prev = that->prev;
-  elem->next = that;
-  that->prev = elem;
-  if (set->first == that) set->first = elem;
-  ++(set->size);
+  if (that == NULL) return;
+  that->isValid = false;
+  that->isMinMaxValid = false;
 
 }
 
-// Create a new GSet
-// Output:
-//   Return the new GSet.
-static GSet GSetCreate(
-  void) {
+// Update a window aggregate after an element has been linked into its set
+// Inputs:
+//   that: the set
+//   elem: the linked element
+static void GSetWindowAdd(
+      GSet* const that,
+  GSetElem* const elem) {
 
-  // Create the GSet
-  GSet that = (GSet) {
+  GSetWindow* window = that->window;
+  if (window->isValid == false) return;
+  GSetWindowSumElem(window, elem, true);
+  if (window->isMinMaxValid == false) return;
 
-    .size = 0,
-    .first = NULL,
-    .last = NULL,
+  // The deques stay valid only if the element is added at the tail
+  if (
+    elem != that->last ||
+    GSetWindowDequePush(&(window->min), elem, window->type, 1) == false ||
+    GSetWindowDequePush(&(window->max), elem, window->type, -1) == false
+  ) {
 
-  };
+    window->isMinMaxValid = false;
 
-  // Return the GSet
-  return that;
+  }
 
 }
 
-// Push an element at the head of the set
+// Update a window aggregate before an element is unlinked from its set
 // Inputs:
 //   that: the set
-//   elem: the element
-static void GSetPushElem(
+//   elem: the element about to be unlinked
+static void GSetWindowRemove(
       GSet* const that,
   GSetElem* const elem) {
 
-  // Check for overflow
-  if (that->size > SIZE_MAX - 1) Raise(TryCatchExc_IntOverflow);
+  GSetWindow* window = that->window;
+  if (window->isValid == false) return;
+  GSetWindowSumElem(window, elem, false);
+  if (window->isMinMaxValid == false) return;
 
-  // Add the element to the head of the set
-  elem->next = that->first;
-  if (that->first != NULL) that->first->prev = elem;
-  that->first = elem;
-  if (that->size == 0) that->last = elem;
+  // The deques stay valid only if the element is removed from the head
+  if (elem != that->first) {
 
-  // Update the size of the set
-  ++(that->size);
+    window->isMinMaxValid = false;
+    return;
 
-}
+  }
 
-// Add an element at the tail of the set
-// Inputs:
-//   that: the set
-//   elem: the element
-static void GSetAddElem(
-      GSet* const that,
-  GSetElem* const elem) {
+  // Remove the element from the head of the deques
+  GSetWindowDeque* deques[2] = {&(window->min), &(window->max)};
+  FOR(iDeque, 2) {
 
-  // Check for overflow
-  if (that->size > SIZE_MAX - 1) Raise(TryCatchExc_IntOverflow);
+    GSetWindowDeque* deque = deques[iDeque];
+    if (deque->nb > 0 && deque->elems[deque->head] == elem) {
 
-  // Add the element to the tail of the set
-  elem->prev = that->last;
-  if (that->last != NULL) that->last->next = elem;
-  that->last = elem;
-  if (that->size == 0) that->first = elem;
+      deque->head = (deque->head + 1) & (deque->nbSlot - 1);
+      --(deque->nb);
 
-  // Update the size of the set
-  ++(that->size);
+    }
+
+  }
 
 }
 
-// Pop an element from the head of the set
+// Recompute what is not up to date in the window aggregate of a set
 // Input:
 //   that: the set
-// Output:
-//   Return the element
-static GSetElem* GSetPopElem(
-  GSet* const that) {
+static void GSetWindowUpdate(
+  GSet const* const that) {
 
-  // Remove the first element
-  GSetElem* elem = that->first;
-  if (that->last == that->first) that->last = NULL;
-  that->first = elem->next;
-  if (that->first != NULL) that->first->prev = NULL;
+  GSetWindow* window = that->window;
 
-  // Update the size of the set
-  --(that->size);
+  // Recompute the sum
+  if (window->isValid == false) {
 
-  // Return the element
-  return elem;
+    if (
+      window->type == GSetKeyType_Float || window->type == GSetKeyType_Double
+    ) window->sum.d = 0.0;
+    else window->sum.ul = 0;
+    window->comp = 0.0;
+    window->nbPosInf = 0;
+    window->nbNegInf = 0;
+    window->nbNaN = 0;
+    for (GSetElem* ptr = that->first; ptr != NULL; ptr = ptr->next)
+      GSetWindowSumElem(window, ptr, true);
+    window->isValid = true;
+    window->isMinMaxValid = false;
+
+  }
+
+  // Recompute the deques
+  if (window->isMinMaxValid == false) {
+
+    window->min.head = 0;
+    window->min.nb = 0;
+    window->max.head = 0;
+    window->max.nb = 0;
+    for (GSetElem* ptr = that->first; ptr != NULL; ptr = ptr->next) {
+
+      if (
+        GSetWindowDequePush(&(window->min), ptr, window->type, 1) == false ||
+        GSetWindowDequePush(&(window->max), ptr, window->type, -1) == false
+      ) {
+
+        Raise(TryCatchExc_MallocFailed);
+
+      }
+
+    }
+
+    window->isMinMaxValid = true;
+
+  }
 
 }
 
-// Drop an element from the tail of the set
-// Input:
-//   that: the set
+// Compare the data of two elements of a set with a window aggregate
+// Inputs:
+//   type: the type of data
+//      a: the first element
+//      b: the second element
 // Output:
-//   Return the element
-static GSetElem* GSetDropElem(
-  GSet* const that) {
+//   Return a negative value if a's data is less than b's data, a positive
+//   value if greater, 0 else
+static int GSetWindowCmp(
+  GSetKeyType const type,
+   GSetElem const* a,
+   GSetElem const* b) {
+
+#define GSETWINDOWCMP(N) \
+  return (a->data.N > b->data.N) - (a->data.N < b->data.N)
+
+  switch (type) {
+
+    case GSetKeyType_Int: GSETWINDOWCMP(Int);
+    case GSetKeyType_UInt: GSETWINDOWCMP(UInt);
+    case GSetKeyType_Long: GSETWINDOWCMP(Long);
+    case GSetKeyType_ULong: GSETWINDOWCMP(ULong);
+    case GSetKeyType_Float: GSETWINDOWCMP(Float);
+    case GSetKeyType_Double: GSETWINDOWCMP(Double);
+    default: return 0;
 
-  // Remove the last element
-  GSetElem* elem = that->last;
-  if (that->last == that->first) that->first = NULL;
-  that->last = elem->prev;
-  if (that->last != NULL) that->last->next = NULL;
+  }
 
-  // Update the size of the set
-  --(that->size);
+#undef GSETWINDOWCMP
 
-  // Return the element
-  return elem;
+}
+
+// Add or subtract the data of an element to the sum of a window aggregate
+// Inputs:
+//    that: the window aggregate
+//    elem: the element
+//   isAdd: true to add the data, false to subtract it
+static void GSetWindowSumElem(
+       GSetWindow* const that,
+   GSetElem const* const elem,
+        bool const isAdd) {
+
+  // Integer data are summed modulo 2^n, so a signed data is added or
+  // subtracted as its unsigned equivalent
+  unsigned long n = 0;
+  double x = 0.0;
+  switch (that->type) {
+
+    case GSetKeyType_Int:
+      n = (unsigned long)(long)(elem->data.Int);
+      break;
+    case GSetKeyType_Long:
+      n = (unsigned long)(elem->data.Long);
+      break;
+    case GSetKeyType_UInt:
+      n = elem->data.UInt;
+      break;
+    case GSetKeyType_ULong:
+      n = elem->data.ULong;
+      break;
+    case GSetKeyType_Float:
+      x = (double)(elem->data.Float);
+      break;
+    case GSetKeyType_Double:
+      x = elem->data.Double;
+      break;
+    default:
+      return;
+
+  }
+
+  if (that->type != GSetKeyType_Float && that->type != GSetKeyType_Double) {
+
+    if (isAdd) that->sum.ul += n;
+    else that->sum.ul -= n;
+    return;
+
+  }
+
+  // Count the non finite data instead of summing them, else the sum would
+  // stay NaN after they are removed
+  if (!isfinite(x)) {
+
+    size_t* nb =
+      (isnan(x) ? &(that->nbNaN) :
+       x > 0.0 ? &(that->nbPosInf) : &(that->nbNegInf));
+    if (isAdd) ++(*nb);
+    else --(*nb);
+    return;
+
+  }
+
+  // Compensated summation of floating point data. If the sum overflows it
+  // is recomputed at the next query
+  if (isAdd == false) x = -x;
+  double t = that->sum.d + x;
+  if (!isfinite(that->sum.d) || !isfinite(t)) that->isValid = false;
+  if (fabs(that->sum.d) >= fabs(x))
+    that->comp += (that->sum.d - t) + x;
+  else
+    that->comp += (x - t) + that->sum.d;
+  that->sum.d = t;
 
 }
 
-// Create a new GSetIter
+// Get the floating point sum of a window aggregate
 // Input:
-//   type: the type of iteration
+//   that: the window aggregate
 // Output:
-//   Return the new GSetIter.
-GSetIter GSetIterCreate(
-  GSetIterType const type) {
+//   Return the sum
+static double GSetWindowSumFloat(
+  GSetWindow const* const that) {
 
-  // Create the GSet
-  GSetIter that = (GSetIter) {
+  if (that->nbNaN > 0 || (that->nbPosInf > 0 && that->nbNegInf > 0))
+    return NAN;
+  if (that->nbPosInf > 0) return INFINITY;
+  if (that->nbNegInf > 0) return -INFINITY;
+  if (!isfinite(that->sum.d)) return that->sum.d;
+  return that->sum.d + that->comp;
 
-    .elem = NULL,
-    .type = type,
-    .filter = (GSetIterFilter) { .fun = NULL, .params = NULL },
+}
 
-  };
+// Add an element at the tail of a monotonic deque, after removing from its
+// tail the elements which can't be the minimum (or maximum) anymore
+// Inputs:
+//    that: the deque
+//    elem: the element
+//    type: the type of data
+//   order: 1 for the deque of the minimum, -1 for the one of the maximum
+// Output:
+//   Return false if the deque couldn't be extended, true else
+static bool GSetWindowDequePush(
+  GSetWindowDeque* const that,
+         GSetElem* const elem,
+       GSetKeyType const type,
+               int const order) {
 
-  // Return the GSet
-  return that;
+  // Remove the elements greater (or lower) than the new one
+  while (that->nb > 0) {
+
+    GSetElem const* back =
+      that->elems[(that->head + that->nb - 1) & (that->nbSlot - 1)];
+    if (order * GSetWindowCmp(type, back, elem) <= 0) break;
+    --(that->nb);
+
+  }
+
+  // Extend the deque if it is full
+  if (that->nb == that->nbSlot) {
+
+    size_t nbSlot = (that->nbSlot == 0 ? 16 : that->nbSlot * 2);
+    if (nbSlot < that->nbSlot) return false;
+    GSetElem** elems = malloc(sizeof(GSetElem*) * nbSlot);
+    if (elems == NULL) return false;
+    FOR(iElem, that->nb)
+      elems[iElem] = that->elems[(that->head + iElem) & (that->nbSlot - 1)];
+    free(that->elems);
+    that->elems = elems;
+    that->nbSlot = nbSlot;
+    that->head = 0;
+
+  }
+
+  // Add the element
+  that->elems[(that->head + that->nb) & (that->nbSlot - 1)] = elem;
+  ++(that->nb);
+  return true;
 
 }
 
@@ -6,6 +6,7 @@
 
 // Include external modules header
 #include <stdlib.h>
+#include <stdio.h>
 #include <stdbool.h>
 #include <TryCatchC/trycatchc.h>
 
@@ -19,12 +20,122 @@ enum GSetIterType {
 };
 typedef enum GSetIterType GSetIterType;
 
+// Built-in operations of GSetApply, a and b are the operation's parameters
+enum GSetApplyOp {
+
+  // x <- a * x
+  GSetApplyOp_Scale,
+
+  // x <- x + a
+  GSetApplyOp_Offset,
+
+  // x <- a * x + b
+  GSetApplyOp_Affine,
+
+  // x <- a if x < a, b if x > b, x else
+  GSetApplyOp_Clamp,
+
+};
+typedef enum GSetApplyOp GSetApplyOp;
+
+// Modes of GSetUnique
+enum GSetUniqueMode {
+
+  // The set may be unsorted, duplicates are detected with a hash table
+  GSetUniqueHash,
+
+  // The set is sorted, duplicates are adjacent and detected by comparing
+  // each data with the previous one
+  GSetUniqueSorted,
+
+};
+typedef enum GSetUniqueMode GSetUniqueMode;
+
+// Policies of a bounded set when data are added while it is full
+enum GSetBoundedPolicy {
+
+  // The data at the other end of the set (the oldest one when data are
+  // always added at the same end) is removed and its element reused for the
+  // new data
+  GSetBounded_Overwrite,
+
+  // The new data is rejected and TryCatchExc_OutOfRange is raised
+  GSetBounded_Reject,
+
+};
+typedef enum GSetBoundedPolicy GSetBoundedPolicy;
+
+// Flags of the operations on sorted sets (GSetUnion, GSetIntersect,
+// GSetDifference, GSetSymDiff), to be combined with |
+enum GSetAlgebraFlag {
+
+  // The data of the second set are copied in new elements, the second set
+  // is left unchanged
+  GSetAlgebra_Copy = 0,
+
+  // The elements of the second set are moved into the first one or freed,
+  // the second set is empty after the operation
+  GSetAlgebra_InPlace = 1,
+
+  // Runs of elements are skipped with an exponential search, reducing the
+  // number of comparisons when the sizes of the sets are very unbalanced
+  GSetAlgebra_Gallop = 2,
+
+};
+typedef enum GSetAlgebraFlag GSetAlgebraFlag;
+
+// Position in a text parsed by GSetParseText_<N> and GSetParseTextBuf_<N>
+struct GSetTextPos {
+
+  // Offset in bytes from the beginning of the text
+  size_t offset;
+
+  // Line and column (in bytes) in the text, starting at 1
+  size_t line;
+  size_t col;
+
+};
+typedef struct GSetTextPos GSetTextPos;
+
 // Structure of a set and its iterators
 struct GSet;
 struct GSetIter;
 typedef struct GSet GSet;
 typedef struct GSetIter GSetIter;
 
+// Structure of a concurrent queue
+struct GSetConc;
+typedef struct GSetConc GSetConc;
+
+// Structure of a ring queue for one producer and one consumer
+struct GSetSpsc;
+typedef struct GSetSpsc GSetSpsc;
+
+// Structure of a work-stealing deque
+struct GSetDeque;
+typedef struct GSetDeque GSetDeque;
+
+// Structure of a blocking queue
+struct GSetBlockingQueue;
+typedef struct GSetBlockingQueue GSetBlockingQueue;
+
+// Structure of a sharded concurrent set
+struct GSetSharded;
+typedef struct GSetSharded GSetSharded;
+
+// Structure of a read-only view of a file saved with GSetSave and of an
+// iterator on it
+struct GSetMap;
+typedef struct GSetMap GSetMap;
+struct GSetMapIter;
+typedef struct GSetMapIter GSetMapIter;
+
+// Structure of a compressed sorted set of integers and its iterators
+struct GSetPacked;
+typedef struct GSetPacked GSetPacked;
+struct GSetPackedIter;
+typedef struct GSetPackedIter GSetPackedIter;
+
 // ================= Public functions declarations ======================
 
 // Function to get the commit id of the library
@@ -40,6 +151,24 @@ char const* GSetGetCommitId(
 GSet* GSetAlloc(
   void);
 
+// Allocate memory for a new GSet, without raising exception
+// Output:
+//   Return the new GSet, or NULL if the allocation failed.
+GSet* GSetAllocNoExc(
+  void);
+
+// Allocate memory for a new bounded GSet. The elements for the data are
+// allocated once here and reused, adding data to or removing data from the
+// set then doesn't allocate or free memory.
+// Inputs:
+//   capacity: the maximum number of data in the set (greater than 0)
+//     policy: the policy when data are added to the set while it is full
+// Output:
+//   Return the new GSet.
+GSet* GSetAllocBounded(
+       size_t const capacity,
+  GSetBoundedPolicy const policy);
+
 // Empty the GSet with GSetEmpty() and free the memory it used.
 // Input:
 //   that: the GSet to be freed
@@ -175,6 +304,96 @@ GSETDROP_(Float, float);
 GSETDROP_(Double, double);
 GSETDROP_(Ptr, void*);
 
+// Pop data from the head of the set, without raising exception
+// Inputs:
+//   that: the set
+//   data: receives the data (may be NULL)
+// Output:
+//   If the set is not empty, remove the data at its head, copy it into
+//   'data' and return true. Else, return false.
+#define GSETTRYPOP_(N, T)     \
+bool GSetTryPop_ ## N(        \
+  GSet* const that,           \
+     T* const data)
+GSETTRYPOP_(Char, char);
+GSETTRYPOP_(UChar, unsigned char);
+GSETTRYPOP_(Int, int);
+GSETTRYPOP_(UInt, unsigned int);
+GSETTRYPOP_(Long, long);
+GSETTRYPOP_(ULong, unsigned long);
+GSETTRYPOP_(Float, float);
+GSETTRYPOP_(Double, double);
+GSETTRYPOP_(Ptr, void*);
+
+// Drop data from the tail of the set, without raising exception
+// Inputs:
+//   that: the set
+//   data: receives the data (may be NULL)
+// Output:
+//   If the set is not empty, remove the data at its tail, copy it into
+//   'data' and return true. Else, return false.
+#define GSETTRYDROP_(N, T)     \
+bool GSetTryDrop_ ## N(        \
+  GSet* const that,            \
+     T* const data)
+GSETTRYDROP_(Char, char);
+GSETTRYDROP_(UChar, unsigned char);
+GSETTRYDROP_(Int, int);
+GSETTRYDROP_(UInt, unsigned int);
+GSETTRYDROP_(Long, long);
+GSETTRYDROP_(ULong, unsigned long);
+GSETTRYDROP_(Float, float);
+GSETTRYDROP_(Double, double);
+GSETTRYDROP_(Ptr, void*);
+
+// Pop several data from the head of the set at once
+// Inputs:
+//   that: the set
+//     nb: the number of data to pop
+//    arr: the array receiving the data, in the order they are popped (may
+//         be NULL)
+// Output:
+//   Remove the min(nb, size of the set) data at the head of the set, copy
+//   them into 'arr' and return their number
+#define GSETPOPARR_(N, T)     \
+size_t GSetPopArr_ ## N(      \
+  GSet* const that,           \
+  size_t const nb,            \
+     T* const arr)
+GSETPOPARR_(Char, char);
+GSETPOPARR_(UChar, unsigned char);
+GSETPOPARR_(Int, int);
+GSETPOPARR_(UInt, unsigned int);
+GSETPOPARR_(Long, long);
+GSETPOPARR_(ULong, unsigned long);
+GSETPOPARR_(Float, float);
+GSETPOPARR_(Double, double);
+GSETPOPARR_(Ptr, void*);
+
+// Drop several data from the tail of the set at once
+// Inputs:
+//   that: the set
+//     nb: the number of data to drop
+//    arr: the array receiving the data, in the order they are dropped (may
+//         be NULL)
+// Output:
+//   Remove the min(nb, size of the set) data at the tail of the set, copy
+//   them into 'arr' and return their number
+#define GSETDROPARR_(N, T)     \
+size_t GSetDropArr_ ## N(      \
+  GSet* const that,            \
+  size_t const nb,             \
+     T* const arr)
+GSETDROPARR_(Char, char);
+GSETDROPARR_(UChar, unsigned char);
+GSETDROPARR_(Int, int);
+GSETDROPARR_(UInt, unsigned int);
+GSETDROPARR_(Long, long);
+GSETDROPARR_(ULong, unsigned long);
+GSETDROPARR_(Float, float);
+GSETDROPARR_(Double, double);
+GSETDROPARR_(Ptr, void*);
+
 // Append data from a set to the end of another
 // Input:
 //   that: the set where data are added
@@ -183,6 +402,14 @@ void GSetAppend_(
         GSet* const that,
   GSet const* const tho);
 
+// Clone a set. The hash index and skip list of the set are not cloned.
+// Input:
+//   that: the set
+// Output:
+//   Return the clone of the set
+GSet* GSetClone_(
+  GSet const* const that);
+
 // Merge a set into another. The merged set is empty after this operation
 // Input:
 //   that: the extended set
@@ -191,6 +418,72 @@ void GSetMerge_(
   GSet* const that,
   GSet* const tho);
 
+// Union of two sets sorted with the same comparison function, the result
+// replacing the first set
+// Inputs:
+//    that: the first set
+//     tho: the second set
+//     cmp: the comparison function
+//   flags: the flags (cf GSetAlgebraFlag)
+void GSetUnion_(
+           GSet* const that,
+           GSet* const tho,
+  int (* const cmp)(void const*, void const*),
+             int const flags);
+
+// Intersection of two sets sorted with the same comparison function, the
+// result replacing the first set
+// Inputs:
+//    that: the first set
+//     tho: the second set
+//     cmp: the comparison function
+//   flags: the flags (cf GSetAlgebraFlag)
+void GSetIntersect_(
+           GSet* const that,
+           GSet* const tho,
+  int (* const cmp)(void const*, void const*),
+             int const flags);
+
+// Difference of two sets sorted with the same comparison function, the
+// result replacing the first set
+// Inputs:
+//    that: the first set
+//     tho: the second set
+//     cmp: the comparison function
+//   flags: the flags (cf GSetAlgebraFlag)
+void GSetDifference_(
+           GSet* const that,
+           GSet* const tho,
+  int (* const cmp)(void const*, void const*),
+             int const flags);
+
+// Symmetric difference of two sets sorted with the same comparison
+// function, the result replacing the first set
+// Inputs:
+//    that: the first set
+//     tho: the second set
+//     cmp: the comparison function
+//   flags: the flags (cf GSetAlgebraFlag)
+void GSetSymDiff_(
+           GSet* const that,
+           GSet* const tho,
+  int (* const cmp)(void const*, void const*),
+             int const flags);
+
+// Merge sets sorted with the same comparison function into another sorted
+// set, with a k-way merge relinking their elements. The merged sets are
+// empty after this operation
+// Inputs:
+//   that: the extended set
+//   sets: the merged sets
+//     nb: the number of merged sets
+//    cmp: the comparison function
+void GSetMergeSorted_(
+         GSet* const that,
+  GSet* const* const sets,
+         size_t const nb,
+  int (* const cmp)(void const*, void const*));
+
 // Return the number of element in the set
 // Input:
 //   that: the set
@@ -199,6 +492,15 @@ void GSetMerge_(
 size_t GSetGetSize_(
   GSet const* const that);
 
+// Return the capacity of the set
+// Input:
+//   that: the set
+// Output:
+//   Return the maximum number of element of a bounded set, 0 for an unbounded
+//   set.
+size_t GSetGetCapacity_(
+  GSet const* const that);
+
 // Empty the set. Memory used by data in it is not freed.
 // To empty the set and free data, use GSet<N>Flush() instead.
 // Input:
@@ -236,6 +538,472 @@ GSETSORT_(Float, float);
 GSETSORT_(Double, double);
 GSETSORT_(Ptr, void*);
 
+// Apply a built-in operation on each data of a set, the result replacing
+// the data in the set
+// Inputs:
+//   that: the set
+//     op: the operation
+//      a: the first parameter of the operation
+//      b: the second parameter of the operation (unused by some operations)
+// Raise TryCatchExc_NotYetImplemented if op is not a valid operation
+#define GSETAPPLY_(N, T)         \
+void GSetApply_ ## N(            \
+         GSet* const that,       \
+  GSetApplyOp const op,          \
+            T const a,           \
+            T const b)
+GSETAPPLY_(Int, int);
+GSETAPPLY_(UInt, unsigned int);
+GSETAPPLY_(Long, long);
+GSETAPPLY_(ULong, unsigned long);
+GSETAPPLY_(Float, float);
+GSETAPPLY_(Double, double);
+
+// Apply a user defined function on each data of a set
+// Inputs:
+//     that: the set
+//      fun: the function, it receives a pointer to the data, which it can
+//           modify in place, and params
+//   params: the parameters of the function
+typedef void (*GSetApplyFun)(
+  void*,
+  void*);
+void GSetApplyWith_(
+  GSet* const that,
+   GSetApplyFun fun,
+          void* params);
+
+// Remove the duplicate data of a set, keeping the first occurrence of each
+// data. Data are compared with ==, pointers by identity, unless the set has
+// a hash index in which case its equality (and hash) are used.
+// Inputs:
+//   that: the set
+//   mode: the mode (cf GSetUniqueMode)
+// Output:
+//   Return the number of removed elements
+#define GSETUNIQUE_(N, T)              \
+size_t GSetUnique_ ## N(               \
+             GSet* const that,         \
+  GSetUniqueMode const mode)
+GSETUNIQUE_(Char, char);
+GSETUNIQUE_(UChar, unsigned char);
+GSETUNIQUE_(Int, int);
+GSETUNIQUE_(UInt, unsigned int);
+GSETUNIQUE_(Long, long);
+GSETUNIQUE_(ULong, unsigned long);
+GSETUNIQUE_(Float, float);
+GSETUNIQUE_(Double, double);
+GSETUNIQUE_(Ptr, void*);
+
+// Get the sum of the data of a set. Integer data are summed into a long
+// (unsigned long for unsigned data) and wrap around on overflow, floating
+// point data are summed into a double with compensated summation.
+// Input:
+//   that: the set
+// Output:
+//   Return the sum (0 if the set is empty)
+#define GSETSUM_(N, T, R)       \
+R GSetSum_ ## N(                \
+  GSet const* const that)
+GSETSUM_(Int, int, long);
+GSETSUM_(UInt, unsigned int, unsigned long);
+GSETSUM_(Long, long, long);
+GSETSUM_(ULong, unsigned long, unsigned long);
+GSETSUM_(Float, float, double);
+GSETSUM_(Double, double, double);
+
+// Get the minimum and maximum of the data of a set
+// Inputs:
+//   that: the set
+//    min: where to store the minimum (may be NULL)
+//    max: where to store the maximum (may be NULL)
+// Raise TryCatchExc_OutOfRange if the set is empty
+#define GSETMINMAX_(N, T)      \
+void GSetMinMax_ ## N(         \
+  GSet const* const that,      \
+           T* const min,       \
+           T* const max)
+GSETMINMAX_(Int, int);
+GSETMINMAX_(UInt, unsigned int);
+GSETMINMAX_(Long, long);
+GSETMINMAX_(ULong, unsigned long);
+GSETMINMAX_(Float, float);
+GSETMINMAX_(Double, double);
+
+// Get the mean of the data of a set
+// Input:
+//   that: the set
+// Output:
+//   Return the mean
+// Raise TryCatchExc_OutOfRange if the set is empty
+#define GSETMEAN_(N, T)         \
+double GSetMean_ ## N(          \
+  GSet const* const that)
+GSETMEAN_(Int, int);
+GSETMEAN_(UInt, unsigned int);
+GSETMEAN_(Long, long);
+GSETMEAN_(ULong, unsigned long);
+GSETMEAN_(Float, float);
+GSETMEAN_(Double, double);
+
+// Get the (population) variance of the data of a set
+// Input:
+//   that: the set
+// Output:
+//   Return the variance
+// Raise TryCatchExc_OutOfRange if the set is empty
+#define GSETVARIANCE_(N, T)     \
+double GSetVariance_ ## N(      \
+  GSet const* const that)
+GSETVARIANCE_(Int, int);
+GSETVARIANCE_(UInt, unsigned int);
+GSETVARIANCE_(Long, long);
+GSETVARIANCE_(ULong, unsigned long);
+GSETVARIANCE_(Float, float);
+GSETVARIANCE_(Double, double);
+
+// Attach a window aggregate to a numeric set, making GSetWindowSum,
+// GSetWindowMin, GSetWindowMax and GSetWindowMean run in O(1). The sum and
+// the monotonic deques giving the minimum and maximum are updated in O(1)
+// (amortized) when data are added at the tail and removed from the head of
+// the set (i.e. when the set is used as a sliding window). The sum is also
+// updated in O(1) by other single additions and removals, while other
+// modifications of the set make the aggregate recomputed in O(n) at the
+// next query. If the set already has a window aggregate it is replaced.
+// Input:
+//   that: the set
+#define GSETATTACHWINDOW_(N, T)  \
+void GSetAttachWindow_ ## N(     \
+  GSet* const that)
+GSETATTACHWINDOW_(Int, int);
+GSETATTACHWINDOW_(UInt, unsigned int);
+GSETATTACHWINDOW_(Long, long);
+GSETATTACHWINDOW_(ULong, unsigned long);
+GSETATTACHWINDOW_(Float, float);
+GSETATTACHWINDOW_(Double, double);
+
+// Detach and free the window aggregate of a set, if any
+// Input:
+//   that: the set
+void GSetDetachWindow_(
+  GSet* const that);
+
+// Check if a set has a window aggregate
+// Input:
+//   that: the set
+// Output:
+//   Return true if the set has a window aggregate, false else
+bool GSetHasWindow_(
+  GSet const* const that);
+
+// Get the sum of the data of a set from its window aggregate, or as
+// GSetSum if it has none
+// Input:
+//   that: the set
+// Output:
+//   Return the sum (0 if the set is empty)
+#define GSETWINDOWSUM_(N, T, R)  \
+R GSetWindowSum_ ## N(           \
+  GSet const* const that)
+GSETWINDOWSUM_(Int, int, long);
+GSETWINDOWSUM_(UInt, unsigned int, unsigned long);
+GSETWINDOWSUM_(Long, long, long);
+GSETWINDOWSUM_(ULong, unsigned long, unsigned long);
+GSETWINDOWSUM_(Float, float, double);
+GSETWINDOWSUM_(Double, double, double);
+
+// Get the minimum of the data of a set from its window aggregate, or as
+// GSetMinMax if it has none
+// Input:
+//   that: the set
+// Output:
+//   Return the minimum
+// Raise TryCatchExc_OutOfRange if the set is empty
+#define GSETWINDOWMIN_(N, T)  \
+T GSetWindowMin_ ## N(        \
+  GSet const* const that)
+GSETWINDOWMIN_(Int, int);
+GSETWINDOWMIN_(UInt, unsigned int);
+GSETWINDOWMIN_(Long, long);
+GSETWINDOWMIN_(ULong, unsigned long);
+GSETWINDOWMIN_(Float, float);
+GSETWINDOWMIN_(Double, double);
+
+// Get the maximum of the data of a set from its window aggregate, or as
+// GSetMinMax if it has none
+// Input:
+//   that: the set
+// Output:
+//   Return the maximum
+// Raise TryCatchExc_OutOfRange if the set is empty
+#define GSETWINDOWMAX_(N, T)  \
+T GSetWindowMax_ ## N(        \
+  GSet const* const that)
+GSETWINDOWMAX_(Int, int);
+GSETWINDOWMAX_(UInt, unsigned int);
+GSETWINDOWMAX_(Long, long);
+GSETWINDOWMAX_(ULong, unsigned long);
+GSETWINDOWMAX_(Float, float);
+GSETWINDOWMAX_(Double, double);
+
+// Get the mean of the data of a set from its window aggregate, or as
+// GSetMean if it has none
+// Input:
+//   that: the set
+// Output:
+//   Return the mean
+// Raise TryCatchExc_OutOfRange if the set is empty
+#define GSETWINDOWMEAN_(N, T)  \
+double GSetWindowMean_ ## N(   \
+  GSet const* const that)
+GSETWINDOWMEAN_(Int, int);
+GSETWINDOWMEAN_(UInt, unsigned int);
+GSETWINDOWMEAN_(Long, long);
+GSETWINDOWMEAN_(ULong, unsigned long);
+GSETWINDOWMEAN_(Float, float);
+GSETWINDOWMEAN_(Double, double);
+
+// Switch a set to concurrent-read mode: reader threads can iterate on the
+// set without lock while one writer thread adds and removes data. The
+// removed elements are freed only once no reader can access them anymore
+// (epoch-based reclamation).
+// Input:
+//   that: the set
+void GSetAttachEpoch_(
+  GSet* const that);
+
+// Switch a set back from concurrent-read mode, freeing the removed
+// elements not freed yet. No reader must be accessing the set.
+// Input:
+//   that: the set
+void GSetDetachEpoch_(
+  GSet* const that);
+
+// Check if a set is in concurrent-read mode
+// Input:
+//   that: the set
+// Output:
+//   Return true if the set is in concurrent-read mode, false else
+bool GSetHasEpoch_(
+  GSet const* const that);
+
+// Enter a read section on a set in concurrent-read mode. The elements the
+// reader accesses until it leaves the section are not freed. The reader
+// must reset its iterators in the section.
+// Input:
+//   that: the set
+// Output:
+//   Return the slot of the reader, to be given to GSetEpochLeave.
+size_t GSetEpochEnter_(
+  GSet* const that);
+
+// Leave a read section on a set in concurrent-read mode
+// Inputs:
+//   that: the set
+//   slot: the slot returned by GSetEpochEnter
+void GSetEpochLeave_(
+  GSet* const that,
+  size_t const slot);
+
+// Free the removed elements of a set in concurrent-read mode which can't
+// be accessed by the readers anymore. Must be called by the writer thread.
+// Input:
+//   that: the set
+// Output:
+//   Return the number of removed elements still waiting to be freed.
+size_t GSetEpochReclaim_(
+  GSet* const that);
+
+// Functions hashing a data and checking the equality of two data, used by
+// the hash index of sets of pointers. They receive pointers to the data
+// in the set (i.e. pointers to the pointers).
+typedef size_t (*GSetHashFun)(
+  void const*);
+typedef bool (*GSetEqFun)(
+  void const*,
+  void const*);
+
+// Attach a hash index to a set, making GSetContains, GSetIterFind and
+// GSetRemove run in O(1). The index is kept up to date by all the
+// functions modifying the set. Data are compared with ==, pointers by
+// identity. If the set already has an index it is replaced.
+// Input:
+//   that: the set
+#define GSETATTACHINDEX_(N, T)  \
+void GSetAttachIndex_ ## N(     \
+  GSet* const that)
+GSETATTACHINDEX_(Char, char);
+GSETATTACHINDEX_(UChar, unsigned char);
+GSETATTACHINDEX_(Int, int);
+GSETATTACHINDEX_(UInt, unsigned int);
+GSETATTACHINDEX_(Long, long);
+GSETATTACHINDEX_(ULong, unsigned long);
+GSETATTACHINDEX_(Float, float);
+GSETATTACHINDEX_(Double, double);
+GSETATTACHINDEX_(Ptr, void*);
+
+// Attach a hash index to a set of pointers using user defined hash and
+// equality functions. If the set already has an index it is replaced.
+// Inputs:
+//   that: the set
+//   hash: the hash function
+//     eq: the equality function
+void GSetAttachIndexWith_(
+  GSet* const that,
+   GSetHashFun hash,
+     GSetEqFun eq);
+
+// Detach and free the hash index of a set, if any
+// Input:
+//   that: the set
+void GSetDetachIndex_(
+  GSet* const that);
+
+// Check if a set has a hash index
+// Input:
+//   that: the set
+// Output:
+//   Return true if the set has a hash index, false else
+bool GSetHasIndex_(
+  GSet const* const that);
+
+// Check if a set contains a data. Without hash index the search is linear,
+// and pointers are compared by identity.
+// Inputs:
+//   that: the set
+//   data: the data
+// Output:
+//   Return true if the data is in the set, else false
+#define GSETCONTAINS_(N, T)      \
+bool GSetContains_ ## N(         \
+  GSet const* const that,        \
+            T const data)
+GSETCONTAINS_(Char, char);
+GSETCONTAINS_(UChar, unsigned char);
+GSETCONTAINS_(Int, int);
+GSETCONTAINS_(UInt, unsigned int);
+GSETCONTAINS_(Long, long);
+GSETCONTAINS_(ULong, unsigned long);
+GSETCONTAINS_(Float, float);
+GSETCONTAINS_(Double, double);
+GSETCONTAINS_(Ptr, void*);
+
+// Move an iterator to an element containing a data. If the set has a hash
+// index and the iterator has no filter, the search is in O(1) and the
+// iterator is moved to any of the elements containing the data. Else the
+// search is linear and the iterator is moved to the first element
+// containing the data according to its type and filter.
+// Inputs:
+//   that: the iterator
+//    set: the associated set
+//   data: the data
+// Output:
+//   Return true if the data was found, else false (in which case the
+//   iterator is left unchanged)
+#define GSETITERFIND_(N, T)      \
+bool GSetIterFind_ ## N(         \
+     GSetIter* const that,       \
+  GSet const* const set,         \
+            T const data)
+GSETITERFIND_(Char, char);
+GSETITERFIND_(UChar, unsigned char);
+GSETITERFIND_(Int, int);
+GSETITERFIND_(UInt, unsigned int);
+GSETITERFIND_(Long, long);
+GSETITERFIND_(ULong, unsigned long);
+GSETITERFIND_(Float, float);
+GSETITERFIND_(Double, double);
+GSETITERFIND_(Ptr, void*);
+
+// Insert a data in a sorted set at its sorted position, after the data
+// equal to it, in O(log n) using a skip list on the elements of the set.
+// The skip list is built (in O(n)) at the first call, and rebuilt after the
+// set has been modified other than by GSetInsertSorted or a removal.
+// Inputs:
+//   that: the set, sorted in increasing order according to cmp
+//   data: the data
+//    cmp: the comparison function
+#define GSETINSERTSORTED_(N, T)                        \
+void GSetInsertSorted_ ## N(                           \
+       GSet* const that,                               \
+          T const data,                                \
+  int (* const cmp)(void const*, void const*))
+GSETINSERTSORTED_(Char, char);
+GSETINSERTSORTED_(UChar, unsigned char);
+GSETINSERTSORTED_(Int, int);
+GSETINSERTSORTED_(UInt, unsigned int);
+GSETINSERTSORTED_(Long, long);
+GSETINSERTSORTED_(ULong, unsigned long);
+GSETINSERTSORTED_(Float, float);
+GSETINSERTSORTED_(Double, double);
+GSETINSERTSORTED_(Ptr, void*);
+
+// Move an iterator to the first element of a sorted set whose data is not
+// lower than a data (then to the next one accepted by the filter of the
+// iterator), in O(log n) using the skip list of GSetInsertSorted
+// Inputs:
+//   that: the iterator
+//    set: the associated set, sorted in increasing order according to cmp
+//   data: the data
+//    cmp: the comparison function
+// Output:
+//   Return true if there is such an element, else false (in which case the
+//   iterator is left unchanged)
+#define GSETITERLOWERBOUND_(N, T)                      \
+bool GSetIterLowerBound_ ## N(                         \
+  GSetIter* const that,                                \
+       GSet* const set,                                \
+          T const data,                                \
+  int (* const cmp)(void const*, void const*))
+GSETITERLOWERBOUND_(Char, char);
+GSETITERLOWERBOUND_(UChar, unsigned char);
+GSETITERLOWERBOUND_(Int, int);
+GSETITERLOWERBOUND_(UInt, unsigned int);
+GSETITERLOWERBOUND_(Long, long);
+GSETITERLOWERBOUND_(ULong, unsigned long);
+GSETITERLOWERBOUND_(Float, float);
+GSETITERLOWERBOUND_(Double, double);
+GSETITERLOWERBOUND_(Ptr, void*);
+
+// Same as GSetIterLowerBound but for the first element whose data is
+// greater than the data
+#define GSETITERUPPERBOUND_(N, T)                      \
+bool GSetIterUpperBound_ ## N(                         \
+  GSetIter* const that,                                \
+       GSet* const set,                                \
+          T const data,                                \
+  int (* const cmp)(void const*, void const*))
+GSETITERUPPERBOUND_(Char, char);
+GSETITERUPPERBOUND_(UChar, unsigned char);
+GSETITERUPPERBOUND_(Int, int);
+GSETITERUPPERBOUND_(UInt, unsigned int);
+GSETITERUPPERBOUND_(Long, long);
+GSETITERUPPERBOUND_(ULong, unsigned long);
+GSETITERUPPERBOUND_(Float, float);
+GSETITERUPPERBOUND_(Double, double);
+GSETITERUPPERBOUND_(Ptr, void*);
+
+// Remove one element containing a data from a set, in O(1) if the set has
+// a hash index. Iterators on the removed element become invalid.
+// Inputs:
+//   that: the set
+//   data: the data
+// Output:
+//   Return true if an element was removed, false if the data was not found
+#define GSETREMOVE_(N, T)        \
+bool GSetRemove_ ## N(           \
+  GSet* const that,              \
+      T const data)
+GSETREMOVE_(Char, char);
+GSETREMOVE_(UChar, unsigned char);
+GSETREMOVE_(Int, int);
+GSETREMOVE_(UInt, unsigned int);
+GSETREMOVE_(Long, long);
+GSETREMOVE_(ULong, unsigned long);
+GSETREMOVE_(Float, float);
+GSETREMOVE_(Double, double);
+GSETREMOVE_(Ptr, void*);
+
 // Allocate memory for a new GSetIter
 // Input:
 //   type: the type of iteration
@@ -288,109 +1056,1338 @@ GSETITERPICK_(Float, float);
 GSETITERPICK_(Double, double);
 GSETITERPICK_(Ptr, void*);
 
-// Reset the iterator to its first element
+// Get the current data from a set, without raising exception
+// Inputs:
+//   that: the iterator
+//   data: receives the data
+// Output:
+//   If the iterator is on an element, copy its data into 'data' and return
+//   true. Else, return false.
+#define GSETITERTRYGET_(N, T)     \
+bool GSetIterTryGet_ ## N(        \
+  GSetIter const* const that,     \
+               T* const data)
+GSETITERTRYGET_(Char, char);
+GSETITERTRYGET_(UChar, unsigned char);
+GSETITERTRYGET_(Int, int);
+GSETITERTRYGET_(UInt, unsigned int);
+GSETITERTRYGET_(Long, long);
+GSETITERTRYGET_(ULong, unsigned long);
+GSETITERTRYGET_(Float, float);
+GSETITERTRYGET_(Double, double);
+GSETITERTRYGET_(Ptr, void*);
+
+// Pick the current data from a set, without raising exception
+// Inputs:
+//   that: the iterator
+//    set: the associated set
+//   data: receives the data (may be NULL)
+// Output:
+//   If the iterator is on an element, remove it from the set, copy its data
+//   into 'data' and return true. Else, return false.
+#define GSETITERTRYPICK_(N, T)     \
+bool GSetIterTryPick_ ## N(        \
+  GSetIter* const that,            \
+      GSet* const set,             \
+         T* const data)
+GSETITERTRYPICK_(Char, char);
+GSETITERTRYPICK_(UChar, unsigned char);
+GSETITERTRYPICK_(Int, int);
+GSETITERTRYPICK_(UInt, unsigned int);
+GSETITERTRYPICK_(Long, long);
+GSETITERTRYPICK_(ULong, unsigned long);
+GSETITERTRYPICK_(Float, float);
+GSETITERTRYPICK_(Double, double);
+GSETITERTRYPICK_(Ptr, void*);
+
+// Reset the iterator to its first element
+// Input:
+//   that: the iterator
+//    set: the associated set
+void GSetIterReset_(
+    GSetIter* const that,
+  GSet const* const set);
+
+// Check if the iterator is ready
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator is on an element of its set, false else
+//   (either it's because the set is empty, or the iterator's filter has
+//   no matching element in the set)
+bool GSetIterIsReady_(
+    GSetIter* const that);
+
+// Move the iterator to the next element
+// Input:
+//   that: the iterator
+// Output:
+// Return true if the iterator could move to the next element, else false
+bool GSetIterNext_(
+  GSetIter* const that);
+
+// Move the iterator to the previous element
+// Input:
+//   that: the iterator
+// Output:
+// Return true if the iterator could move to the previous element, else false
+bool GSetIterPrev_(
+  GSetIter* const that);
+
+// Check if an iterator is on its first element
+// Input:
+//   that: the iterator
+// Output:
+// Return true if the iterator is on its first element, else false
+bool GSetIterIsFirst_(
+  GSetIter* const that);
+
+// Check if an iterator is on its last element
+// Input:
+//   that: the iterator
+// Output:
+// Return true if the iterator is on its last element, else false
+bool GSetIterIsLast_(
+  GSetIter* const that);
+
+// Clone an iterator
+// Input:
+//   that: the iterator
+// Output:
+//   Return a clone of the iterator
+GSetIter* GSetIterClone_(
+  GSetIter const* const that);
+
+// Set the type of an iterator
+// Input:
+//   that: the iterator
+//   type: the type
+void GSetIterSetType_(
+     GSetIter* const that,
+  GSetIterType const type);
+
+// Get the type of an iterator
+// Input:
+//   that: the iterator
+// Return the type of the iterator
+GSetIterType GSetIterGetType_(
+  GSetIter const* const that);
+
+// Set the filter of an iterator
+// Inputs:
+//     that: the iterator
+//      fun: the filter's function
+//   params: the parameters of the filter's function
+typedef bool (*GSetIterFilterFun)(
+  void*,
+  void*);
+void GSetIterSetFilter_(
+    GSetIter* const that,
+  GSetIterFilterFun fun,
+              void* params);
+
+// Get the filter's function parameters
+// Input:
+//     that: the iterator
+// Output:
+//   Return the parameters of the filter's function
+void* GSetIterGetFilterParam_(
+  GSetIter* const that);
+
+// Count the number of elements enumerated by an iterator
+// Inputs:
+//   that: the iterator
+//    set: the set
+// Output:
+//   Return the number of elements
+size_t GSetIterCount_(
+  GSetIter const* const that,
+      GSet const* const set);
+
+// Remove from a set, in a single pass, the elements whose data satisfy a
+// predicate. The removed elements are freed (but not their data), or moved
+// without allocation at the tail of another set
+// Inputs:
+//     that: the set
+//      fun: the predicate, same interface as a filter of iterator, returns
+//           true for the data to remove
+//   params: the parameters of the predicate
+//      out: the set receiving the removed elements, or NULL to free them
+// Output:
+//   Return the number of removed elements
+size_t GSetRemoveIf_(
+         GSet* const that,
+  GSetIterFilterFun fun,
+               void* params,
+         GSet* const out);
+
+// Move the elements of a set from the current element of an iterator to
+// the tail, at the tail of another set. The elements are relinked in O(1),
+// their number is counted in O(min(k, n - k)), and indexed in O(k) if a
+// set has a hash index
+// Inputs:
+//   that: the set
+//   iter: the iterator on the set
+//    out: the set receiving the elements
+void GSetSplitAt_(
+            GSet* const that,
+  GSetIter const* const iter,
+            GSet* const out);
+
+// Move all the elements of a set before the current element of an iterator
+// on another set (at its tail if the iterator has no current element), in
+// O(1) or O(k) if a set has a hash index. The moved set is empty after
+// this operation
+// Inputs:
+//   that: the iterator
+//    set: the set of the iterator
+//    src: the moved set
+void GSetSpliceBefore_(
+  GSetIter const* const that,
+            GSet* const set,
+            GSet* const src);
+
+// Move the elements of a set from the current element of an iterator up
+// to the current element of another iterator (included) at the tail of
+// another set. The elements are relinked in O(1) and counted in O(k)
+// Inputs:
+//   that: the set
+//   from: the iterator on the first moved element
+//     to: the iterator on the last moved element
+//    dst: the set receiving the elements
+void GSetMoveRange_(
+            GSet* const that,
+  GSetIter const* const from,
+  GSetIter const* const to,
+            GSet* const dst);
+
+// Function applied on each element by GSetParallelForEach
+// Inputs:
+//     data: pointer to the data of the element
+//   params: the parameters of the function
+//      acc: the accumulator of the thread processing the element (NULL if
+//           there is no accumulator)
+typedef void (*GSetParallelFun)(
+  void*,
+  void*,
+  void*);
+
+// Function combining the accumulators of GSetParallelForEach
+// Inputs:
+//      acc: the accumulator receiving the combination
+//    other: the accumulator to be combined into acc
+//   params: the parameters of the function
+typedef void (*GSetReduceFun)(
+  void*,
+  void const*,
+  void*);
+
+// Apply a function on each element enumerated by an iterator, using several
+// threads. The enumerated elements are split into nbThread ranges of equal
+// size, each processed by one thread (the calling thread processes the
+// first range). The type and filter of the iterator are respected, but the
+// order in which elements are processed across ranges is undefined.
+// Inputs:
+//       that: the iterator
+//        set: the associated set
+//        fun: the function applied on each element
+//     params: the parameters of fun and reduce
+//   nbThread: the number of threads (0 is treated as 1)
+//       accs: array of nbThread accumulators of sizeAcc bytes, the i-th
+//             range uses the i-th accumulator (may be NULL)
+//    sizeAcc: the size in bytes of one accumulator
+//     reduce: the function combining the accumulators once all threads have
+//             completed, the i-th accumulator is combined into the first one
+//             for i in 1..(nbThread-1) (may be NULL)
+void GSetIterParallelForEach_(
+   GSetIter const* const that,
+       GSet const* const set,
+           GSetParallelFun fun,
+                     void* params,
+              size_t const nbThread,
+                     void* accs,
+              size_t const sizeAcc,
+             GSetReduceFun reduce);
+
+// Apply a function on each element of a set, using several threads.
+// Same as GSetIterParallelForEach_ with a forward iterator without filter.
+void GSetParallelForEach_(
+  GSet const* const set,
+      GSetParallelFun fun,
+                void* params,
+         size_t const nbThread,
+                void* accs,
+         size_t const sizeAcc,
+        GSetReduceFun reduce);
+
+// Allocate memory for a new concurrent queue. Data can be added to the
+// queue by several threads simultaneously, without lock, while one thread
+// pops them.
+// Output:
+//   Return the new GSetConc.
+GSetConc* GSetConcAlloc(
+  void);
+
+// Free the memory used by a concurrent queue and the data still in it. No
+// thread must be using the queue.
+// Input:
+//   that: the GSetConc to be freed
+void GSetConcFree_(
+  GSetConc** const that);
+
+// Add data at the tail of a concurrent queue. Can be called by several
+// threads simultaneously.
+// Inputs:
+//   that: the queue
+//   data: the data
+#define GSETCONCADD_(N, T)     \
+void GSetConcAdd_ ## N(        \
+  GSetConc* const that,        \
+          T const data)
+GSETCONCADD_(Char, char);
+GSETCONCADD_(UChar, unsigned char);
+GSETCONCADD_(Int, int);
+GSETCONCADD_(UInt, unsigned int);
+GSETCONCADD_(Long, long);
+GSETCONCADD_(ULong, unsigned long);
+GSETCONCADD_(Float, float);
+GSETCONCADD_(Double, double);
+GSETCONCADD_(Ptr, void*);
+
+// Pop data from the head of a concurrent queue, without blocking. Must be
+// called by one thread at a time.
+// Inputs:
+//   that: the queue
+//   data: receives the data (may be NULL)
+// Output:
+//   If a data is available, remove it from the queue, copy it into 'data'
+//   and return true. Else, return false. False may be returned while the
+//   queue is not empty if a thread is in the middle of adding a data.
+#define GSETCONCPOP_(N, T)     \
+bool GSetConcPop_ ## N(        \
+  GSetConc* const that,        \
+         T* const data)
+GSETCONCPOP_(Char, char);
+GSETCONCPOP_(UChar, unsigned char);
+GSETCONCPOP_(Int, int);
+GSETCONCPOP_(UInt, unsigned int);
+GSETCONCPOP_(Long, long);
+GSETCONCPOP_(ULong, unsigned long);
+GSETCONCPOP_(Float, float);
+GSETCONCPOP_(Double, double);
+GSETCONCPOP_(Ptr, void*);
+
+// Allocate memory for a new ring queue for one producer thread and one
+// consumer thread. Data are stored in an array of fixed capacity, and
+// added and popped without lock.
+// Input:
+//   capacity: the minimum number of data the queue can hold, rounded up
+//             to a power of 2, greater than 0
+// Output:
+//   Return the new GSetSpsc.
+GSetSpsc* GSetSpscAlloc(
+  size_t const capacity);
+
+// Free the memory used by a ring queue. No thread must be using the queue.
+// Input:
+//   that: the GSetSpsc to be freed
+void GSetSpscFree_(
+  GSetSpsc** const that);
+
+// Get the number of data a ring queue can hold
+// Input:
+//   that: the queue
+// Output:
+//   Return the capacity of the queue.
+size_t GSetSpscGetCapacity_(
+  GSetSpsc const* const that);
+
+// Get the number of data in a ring queue
+// Input:
+//   that: the queue
+// Output:
+//   Return the number of data. If the producer or the consumer is using
+//   the queue simultaneously, the result may be already outdated.
+size_t GSetSpscGetSize_(
+  GSetSpsc const* const that);
+
+// Add data at the tail of a ring queue. Must be called by the producer
+// thread only.
+// Inputs:
+//   that: the queue
+//   data: the data
+// Output:
+//   Return true if the data was added, or false if the queue is full.
+#define GSETSPSCADD_(N, T) \
+bool GSetSpscAdd_ ## N(    \
+  GSetSpsc* const that,    \
+          T const data)
+GSETSPSCADD_(Char, char);
+GSETSPSCADD_(UChar, unsigned char);
+GSETSPSCADD_(Int, int);
+GSETSPSCADD_(UInt, unsigned int);
+GSETSPSCADD_(Long, long);
+GSETSPSCADD_(ULong, unsigned long);
+GSETSPSCADD_(Float, float);
+GSETSPSCADD_(Double, double);
+GSETSPSCADD_(Ptr, void*);
+
+// Add an array of data at the tail of a ring queue, as many as the free
+// room in the queue allows. Must be called by the producer thread only.
+// Inputs:
+//   that: the queue
+//     nb: the number of data in the array
+//    arr: the array of data
+// Output:
+//   Return the number of data added, from the beginning of the array.
+#define GSETSPSCADDARR_(N, T) \
+size_t GSetSpscAddArr_ ## N(  \
+  GSetSpsc* const that,       \
+     size_t const nb,         \
+   T const* const arr)
+GSETSPSCADDARR_(Char, char);
+GSETSPSCADDARR_(UChar, unsigned char);
+GSETSPSCADDARR_(Int, int);
+GSETSPSCADDARR_(UInt, unsigned int);
+GSETSPSCADDARR_(Long, long);
+GSETSPSCADDARR_(ULong, unsigned long);
+GSETSPSCADDARR_(Float, float);
+GSETSPSCADDARR_(Double, double);
+GSETSPSCADDARR_(Ptr, void*);
+
+// Pop data from the head of a ring queue, without blocking. Must be
+// called by the consumer thread only.
+// Inputs:
+//   that: the queue
+//   data: receives the data (may be NULL)
+// Output:
+//   If the queue is not empty, remove the data at its head, copy it into
+//   'data' and return true. Else, return false.
+#define GSETSPSCPOP_(N, T) \
+bool GSetSpscPop_ ## N(    \
+  GSetSpsc* const that,    \
+         T* const data)
+GSETSPSCPOP_(Char, char);
+GSETSPSCPOP_(UChar, unsigned char);
+GSETSPSCPOP_(Int, int);
+GSETSPSCPOP_(UInt, unsigned int);
+GSETSPSCPOP_(Long, long);
+GSETSPSCPOP_(ULong, unsigned long);
+GSETSPSCPOP_(Float, float);
+GSETSPSCPOP_(Double, double);
+GSETSPSCPOP_(Ptr, void*);
+
+// Pop data from the head of a ring queue into an array, as many as
+// available up to the size of the array, without blocking. Must be called
+// by the consumer thread only.
+// Inputs:
+//   that: the queue
+//     nb: the size of the array
+//    arr: receives the data (may be NULL)
+// Output:
+//   Return the number of data popped.
+#define GSETSPSCPOPARR_(N, T) \
+size_t GSetSpscPopArr_ ## N(  \
+  GSetSpsc* const that,       \
+     size_t const nb,         \
+         T* const arr)
+GSETSPSCPOPARR_(Char, char);
+GSETSPSCPOPARR_(UChar, unsigned char);
+GSETSPSCPOPARR_(Int, int);
+GSETSPSCPOPARR_(UInt, unsigned int);
+GSETSPSCPOPARR_(Long, long);
+GSETSPSCPOPARR_(ULong, unsigned long);
+GSETSPSCPOPARR_(Float, float);
+GSETSPSCPOPARR_(Double, double);
+GSETSPSCPOPARR_(Ptr, void*);
+
+// Allocate memory for a new work-stealing deque of pointers. The owner
+// thread of the deque pushes and pops data at its head, while other
+// threads steal data at its tail.
+// Output:
+//   Return the new GSetDeque.
+GSetDeque* GSetDequeAlloc(
+  void);
+
+// Free the memory used by a work-stealing deque, not the data still in
+// it. No thread must be using the deque.
+// Input:
+//   that: the GSetDeque to be freed
+void GSetDequeFree(
+  GSetDeque** const that);
+
+// Push data at the head of a work-stealing deque. Must be called by the
+// owner thread only.
+// Inputs:
+//   that: the deque
+//   data: the data
+void GSetDequePush(
+  GSetDeque* const that,
+       void* const data);
+
+// Pop data from the head of a work-stealing deque. Must be called by the
+// owner thread only.
+// Inputs:
+//   that: the deque
+//   data: receives the data (may be NULL)
+// Output:
+//   If the deque is not empty, remove the data at its head, copy it into
+//   'data' and return true. Else, or if a thief stole the last data
+//   simultaneously, return false.
+bool GSetDequePop(
+  GSetDeque* const that,
+      void** const data);
+
+// Steal data from the tail of a work-stealing deque. Can be called by
+// several threads simultaneously.
+// Inputs:
+//   that: the deque
+//   data: receives the data (may be NULL)
+// Output:
+//   If the deque is not empty, remove the data at its tail, copy it into
+//   'data' and return true. Else, or if another thread took the data at
+//   the tail simultaneously, return false.
+bool GSetDequeSteal(
+  GSetDeque* const that,
+      void** const data);
+
+// Get the number of data in a work-stealing deque
+// Input:
+//   that: the deque
+// Output:
+//   Return the number of data. If threads are using the deque
+//   simultaneously, the result may be already outdated.
+size_t GSetDequeGetSize(
+  GSetDeque const* const that);
+
+// Allocate memory for a new blocking queue. Data are added and popped by
+// any number of threads, which wait while the queue is full or empty.
+// Input:
+//   capacity: the maximum number of data in the queue, 0 for no maximum
+// Output:
+//   Return the new GSetBlockingQueue.
+GSetBlockingQueue* GSetBlockingQueueAlloc(
+  size_t const capacity);
+
+// Free the memory used by a blocking queue, not the data still in it. No
+// thread must be using the queue.
+// Input:
+//   that: the GSetBlockingQueue to be freed
+void GSetBlockingQueueFree_(
+  GSetBlockingQueue** const that);
+
+// Close a blocking queue. Data can't be added anymore, the data still in
+// the queue can be popped, and the waiting threads are woken up.
+// Input:
+//   that: the queue
+void GSetBlockingQueueClose_(
+  GSetBlockingQueue* const that);
+
+// Check if a blocking queue is closed
+// Input:
+//   that: the queue
+// Output:
+//   Return true if the queue is closed, else false.
+bool GSetBlockingQueueIsClosed_(
+  GSetBlockingQueue* const that);
+
+// Get the number of data in a blocking queue
+// Input:
+//   that: the queue
+// Output:
+//   Return the number of data. If threads are using the queue
+//   simultaneously, the result may be already outdated.
+size_t GSetBlockingQueueGetSize_(
+  GSetBlockingQueue* const that);
+
+// Get the maximum number of data in a blocking queue
+// Input:
+//   that: the queue
+// Output:
+//   Return the capacity of the queue, 0 if it has no maximum.
+size_t GSetBlockingQueueGetCapacity_(
+  GSetBlockingQueue const* const that);
+
+// Add data at the tail of a blocking queue, waiting while the queue is
+// full
+// Inputs:
+//   that: the queue
+//   data: the data
+// Output:
+//   Return true if the data was added, or false if the queue is closed.
+#define GSETBLOCKINGQUEUEADD_(N, T) \
+bool GSetBlockingQueueAdd_ ## N(    \
+  GSetBlockingQueue* const that,    \
+                  T const data)
+GSETBLOCKINGQUEUEADD_(Char, char);
+GSETBLOCKINGQUEUEADD_(UChar, unsigned char);
+GSETBLOCKINGQUEUEADD_(Int, int);
+GSETBLOCKINGQUEUEADD_(UInt, unsigned int);
+GSETBLOCKINGQUEUEADD_(Long, long);
+GSETBLOCKINGQUEUEADD_(ULong, unsigned long);
+GSETBLOCKINGQUEUEADD_(Float, float);
+GSETBLOCKINGQUEUEADD_(Double, double);
+GSETBLOCKINGQUEUEADD_(Ptr, void*);
+
+// Add an array of data at the tail of a blocking queue, waiting while the
+// queue is full. The data are added by as large blocks as the free room in
+// the queue allows, with one lock and one wake up of the waiting threads
+// per block.
+// Inputs:
+//   that: the queue
+//     nb: the number of data in the array
+//    arr: the array of data
+// Output:
+//   Return the number of data added, lower than 'nb' only if the queue has
+//   been closed.
+#define GSETBLOCKINGQUEUEADDARR_(N, T) \
+size_t GSetBlockingQueueAddArr_ ## N(  \
+  GSetBlockingQueue* const that,       \
+             size_t const nb,          \
+           T const* const arr)
+GSETBLOCKINGQUEUEADDARR_(Char, char);
+GSETBLOCKINGQUEUEADDARR_(UChar, unsigned char);
+GSETBLOCKINGQUEUEADDARR_(Int, int);
+GSETBLOCKINGQUEUEADDARR_(UInt, unsigned int);
+GSETBLOCKINGQUEUEADDARR_(Long, long);
+GSETBLOCKINGQUEUEADDARR_(ULong, unsigned long);
+GSETBLOCKINGQUEUEADDARR_(Float, float);
+GSETBLOCKINGQUEUEADDARR_(Double, double);
+GSETBLOCKINGQUEUEADDARR_(Ptr, void*);
+
+// Pop data from the head of a blocking queue, waiting while the queue is
+// empty
+// Inputs:
+//   that: the queue
+//   data: receives the data (may be NULL)
+// Output:
+//   Return true if a data was popped, or false if the queue is closed and
+//   empty.
+#define GSETBLOCKINGQUEUEPOP_(N, T) \
+bool GSetBlockingQueuePop_ ## N(    \
+  GSetBlockingQueue* const that,    \
+                 T* const data)
+GSETBLOCKINGQUEUEPOP_(Char, char);
+GSETBLOCKINGQUEUEPOP_(UChar, unsigned char);
+GSETBLOCKINGQUEUEPOP_(Int, int);
+GSETBLOCKINGQUEUEPOP_(UInt, unsigned int);
+GSETBLOCKINGQUEUEPOP_(Long, long);
+GSETBLOCKINGQUEUEPOP_(ULong, unsigned long);
+GSETBLOCKINGQUEUEPOP_(Float, float);
+GSETBLOCKINGQUEUEPOP_(Double, double);
+GSETBLOCKINGQUEUEPOP_(Ptr, void*);
+
+// Pop data from the head of a blocking queue, waiting at most a given time
+// while the queue is empty
+// Inputs:
+//      that: the queue
+//      data: receives the data (may be NULL)
+//   timeout: the maximum waiting time, in seconds
+// Output:
+//   Return true if a data was popped, or false if the queue is closed and
+//   empty or the waiting time has elapsed.
+#define GSETBLOCKINGQUEUETIMEDPOP_(N, T) \
+bool GSetBlockingQueueTimedPop_ ## N(    \
+  GSetBlockingQueue* const that,         \
+                 T* const data,          \
+             double const timeout)
+GSETBLOCKINGQUEUETIMEDPOP_(Char, char);
+GSETBLOCKINGQUEUETIMEDPOP_(UChar, unsigned char);
+GSETBLOCKINGQUEUETIMEDPOP_(Int, int);
+GSETBLOCKINGQUEUETIMEDPOP_(UInt, unsigned int);
+GSETBLOCKINGQUEUETIMEDPOP_(Long, long);
+GSETBLOCKINGQUEUETIMEDPOP_(ULong, unsigned long);
+GSETBLOCKINGQUEUETIMEDPOP_(Float, float);
+GSETBLOCKINGQUEUETIMEDPOP_(Double, double);
+GSETBLOCKINGQUEUETIMEDPOP_(Ptr, void*);
+
+// Pop data from the head of a blocking queue into an array, waiting while
+// the queue is empty, then popping all the available data up to the size
+// of the array with one lock
+// Inputs:
+//   that: the queue
+//     nb: the size of the array, greater than 0
+//    arr: receives the data (may be NULL)
+// Output:
+//   Return the number of data popped, 0 only if the queue is closed and
+//   empty.
+#define GSETBLOCKINGQUEUEPOPARR_(N, T) \
+size_t GSetBlockingQueuePopArr_ ## N(  \
+  GSetBlockingQueue* const that,       \
+             size_t const nb,          \
+                 T* const arr)
+GSETBLOCKINGQUEUEPOPARR_(Char, char);
+GSETBLOCKINGQUEUEPOPARR_(UChar, unsigned char);
+GSETBLOCKINGQUEUEPOPARR_(Int, int);
+GSETBLOCKINGQUEUEPOPARR_(UInt, unsigned int);
+GSETBLOCKINGQUEUEPOPARR_(Long, long);
+GSETBLOCKINGQUEUEPOPARR_(ULong, unsigned long);
+GSETBLOCKINGQUEUEPOPARR_(Float, float);
+GSETBLOCKINGQUEUEPOPARR_(Double, double);
+GSETBLOCKINGQUEUEPOPARR_(Ptr, void*);
+
+// Allocate memory for a new sharded set. The data are distributed by hash
+// over shards, each a set with a hash index protected by its own mutex,
+// so threads using different shards don't wait for each other. Data are
+// compared with ==, pointers by identity.
+// Input:
+//   nbShard: the number of shards (greater than 0), rounded up to a power
+//            of 2
+// Output:
+//   Return the new GSetSharded.
+GSetSharded* GSetShardedAlloc(
+  size_t const nbShard);
+
+// Free the memory used by a sharded set, not the data it contains. No
+// thread must be using the set.
+// Input:
+//   that: the GSetSharded to be freed
+void GSetShardedFree_(
+  GSetSharded** const that);
+
+// Get the number of shards of a sharded set
+// Input:
+//   that: the set
+// Output:
+//   Return the number of shards.
+size_t GSetShardedGetNbShard_(
+  GSetSharded const* const that);
+
+// Get the number of data in a sharded set
+// Input:
+//   that: the set
+// Output:
+//   Return the number of data. If threads are using the set
+//   simultaneously, the result may be already outdated.
+size_t GSetShardedGetSize_(
+  GSetSharded* const that);
+
+// Add a data to a sharded set if it doesn't contain it yet
+// Inputs:
+//   that: the set
+//   data: the data
+// Output:
+//   Return true if the data was added, false if it was already in the set.
+#define GSETSHARDEDADD_(N, T) \
+bool GSetShardedAdd_ ## N(    \
+  GSetSharded* const that,    \
+            T const data)
+GSETSHARDEDADD_(Char, char);
+GSETSHARDEDADD_(UChar, unsigned char);
+GSETSHARDEDADD_(Int, int);
+GSETSHARDEDADD_(UInt, unsigned int);
+GSETSHARDEDADD_(Long, long);
+GSETSHARDEDADD_(ULong, unsigned long);
+GSETSHARDEDADD_(Float, float);
+GSETSHARDEDADD_(Double, double);
+GSETSHARDEDADD_(Ptr, void*);
+
+// Check if a sharded set contains a data
+// Inputs:
+//   that: the set
+//   data: the data
+// Output:
+//   Return true if the data is in the set, else false.
+#define GSETSHARDEDCONTAINS_(N, T) \
+bool GSetShardedContains_ ## N(    \
+  GSetSharded* const that,         \
+            T const data)
+GSETSHARDEDCONTAINS_(Char, char);
+GSETSHARDEDCONTAINS_(UChar, unsigned char);
+GSETSHARDEDCONTAINS_(Int, int);
+GSETSHARDEDCONTAINS_(UInt, unsigned int);
+GSETSHARDEDCONTAINS_(Long, long);
+GSETSHARDEDCONTAINS_(ULong, unsigned long);
+GSETSHARDEDCONTAINS_(Float, float);
+GSETSHARDEDCONTAINS_(Double, double);
+GSETSHARDEDCONTAINS_(Ptr, void*);
+
+// Remove a data from a sharded set
+// Inputs:
+//   that: the set
+//   data: the data
+// Output:
+//   Return true if the data was removed, false if it was not in the set.
+#define GSETSHARDEDREMOVE_(N, T) \
+bool GSetShardedRemove_ ## N(    \
+  GSetSharded* const that,       \
+            T const data)
+GSETSHARDEDREMOVE_(Char, char);
+GSETSHARDEDREMOVE_(UChar, unsigned char);
+GSETSHARDEDREMOVE_(Int, int);
+GSETSHARDEDREMOVE_(UInt, unsigned int);
+GSETSHARDEDREMOVE_(Long, long);
+GSETSHARDEDREMOVE_(ULong, unsigned long);
+GSETSHARDEDREMOVE_(Float, float);
+GSETSHARDEDREMOVE_(Double, double);
+GSETSHARDEDREMOVE_(Ptr, void*);
+
+// Apply a user defined function on each data of a sharded set. The shards
+// are locked one after the other, data added or removed by other threads
+// meanwhile may or may not be visited.
+// Inputs:
+//     that: the set
+//      fun: the function, it receives a pointer to the data and params, and
+//           must not modify the data nor use the set
+//   params: the parameters of the function
+void GSetShardedForEach_(
+  GSetSharded* const that,
+   GSetApplyFun fun,
+          void* params);
+
+// Save the data of a set in a stream, in binary format: a header (the
+// format version, the type and size of the data, the byte order of the
+// machine and the number of data) followed by the data, written by blocks
+// Inputs:
+//     that: the set
+//   stream: the stream, opened in binary mode
+#define GSETSAVE_(N, T)        \
+void GSetSave_ ## N(           \
+  GSet const* const that,      \
+        FILE* const stream)
+GSETSAVE_(Char, char);
+GSETSAVE_(UChar, unsigned char);
+GSETSAVE_(Int, int);
+GSETSAVE_(UInt, unsigned int);
+GSETSAVE_(Long, long);
+GSETSAVE_(ULong, unsigned long);
+GSETSAVE_(Float, float);
+GSETSAVE_(Double, double);
+
+// Load data saved with GSetSave_<N> from a stream and add them at the tail
+// of a set. Data saved on a machine of the other byte order are converted.
+// Raise TryCatchExc_IOError if the header doesn't match the type of data or
+// the stream ends before all the data were read, the data read before
+// the error being added to the set.
+// Inputs:
+//     that: the set
+//   stream: the stream, opened in binary mode
+// Output:
+//   Return the number of data added to the set
+#define GSETLOAD_(N, T)        \
+size_t GSetLoad_ ## N(         \
+  GSet* const that,            \
+  FILE* const stream)
+GSETLOAD_(Char, char);
+GSETLOAD_(UChar, unsigned char);
+GSETLOAD_(Int, int);
+GSETLOAD_(UInt, unsigned int);
+GSETLOAD_(Long, long);
+GSETLOAD_(ULong, unsigned long);
+GSETLOAD_(Float, float);
+GSETLOAD_(Double, double);
+
+// Functions writing a data of a set of pointers in a stream and reading it
+// back, used by GSetSaveWith_ and GSetLoadWith_. They receive the data (a
+// pointer to where to store the data for the reading function), the stream
+// and user defined parameters, and return false if they failed.
+typedef bool (*GSetSaveFun)(
+  void const*,
+  FILE*,
+  void*);
+typedef bool (*GSetLoadFun)(
+  void**,
+  FILE*,
+  void*);
+
+// Save the data of a set of pointers in a stream, with the header of
+// GSetSave_<N> followed by the data written one by one by a user defined
+// function. Raise TryCatchExc_IOError if the function fails.
+// Inputs:
+//     that: the set
+//   stream: the stream, opened in binary mode
+//      fun: the function writing a data
+//   params: the parameters of the function
+void GSetSaveWith_(
+  GSet const* const that,
+        FILE* const stream,
+     GSetSaveFun fun,
+           void* params);
+
+// Load data saved with GSetSaveWith_ from a stream and add them at the tail
+// of a set of pointers. Raise TryCatchExc_IOError if the header is not the
+// one of GSetSaveWith_ or the function fails, the data read before the
+// error being added to the set.
+// Inputs:
+//     that: the set
+//   stream: the stream, opened in binary mode
+//      fun: the function reading a data
+//   params: the parameters of the function
+// Output:
+//   Return the number of data added to the set
+size_t GSetLoadWith_(
+        GSet* const that,
+        FILE* const stream,
+     GSetLoadFun fun,
+           void* params);
+
+// Parse a text stream of numbers separated by delimiters and add them at
+// the tail of a set. The numbers are read in the C locale format whatever
+// the current locale: integers in decimal with an optional sign, reals
+// with an optional fractional part and exponent, "inf" and "nan". The text
+// is read by large buffers and the data are added by blocks, the elements
+// of a block being allocated at once (one by one if the set is bounded, to
+// apply its policy). Raise TryCatchExc_IOError if a number is invalid or
+// out of the range of the type of data, the data before it being added to
+// the set, or if the stream can't be read.
+// Inputs:
+//     that: the set
+//   stream: the stream
+//   delims: the characters separating the numbers, consecutive delimiters
+//           being considered as one, if NULL spaces, tabs, line ends,
+//           commas and semicolons
+//      pos: if not NULL, receives the position of the invalid number if
+//           the parsing failed, else the position of the end of the text
+// Output:
+//   Return the number of data added to the set
+#define GSETPARSETEXT_(N, T)        \
+size_t GSetParseText_ ## N(         \
+         GSet* const that,          \
+         FILE* const stream,        \
+    char const* const delims,       \
+  GSetTextPos* const pos)
+GSETPARSETEXT_(Char, char);
+GSETPARSETEXT_(UChar, unsigned char);
+GSETPARSETEXT_(Int, int);
+GSETPARSETEXT_(UInt, unsigned int);
+GSETPARSETEXT_(Long, long);
+GSETPARSETEXT_(ULong, unsigned long);
+GSETPARSETEXT_(Float, float);
+GSETPARSETEXT_(Double, double);
+
+// Parse a buffer of numbers separated by delimiters and add them at the
+// tail of a set, as GSetParseText_<N>
+// Inputs:
+//     that: the set
+//     text: the buffer
+//      len: the length in bytes of the buffer
+//   delims: the characters separating the numbers, as GSetParseText_<N>
+//      pos: if not NULL, receives the position of the invalid number if
+//           the parsing failed, else the position of the end of the text
+// Output:
+//   Return the number of data added to the set
+#define GSETPARSETEXTBUF_(N, T)     \
+size_t GSetParseTextBuf_ ## N(      \
+         GSet* const that,          \
+    char const* const text,         \
+        size_t const len,           \
+    char const* const delims,       \
+  GSetTextPos* const pos)
+GSETPARSETEXTBUF_(Char, char);
+GSETPARSETEXTBUF_(UChar, unsigned char);
+GSETPARSETEXTBUF_(Int, int);
+GSETPARSETEXTBUF_(UInt, unsigned int);
+GSETPARSETEXTBUF_(Long, long);
+GSETPARSETEXTBUF_(ULong, unsigned long);
+GSETPARSETEXTBUF_(Float, float);
+GSETPARSETEXTBUF_(Double, double);
+
+// Map in memory a file saved with GSetSave_<N> and get a read-only view on
+// its data, without copying them. The pages of the file are loaded on
+// demand and shared between the processes mapping the same file.
+// Raise TryCatchExc_IOError if the file can't be mapped, if its header
+// doesn't match the type of data, if it's truncated or if it was saved on a
+// machine of the other byte order.
+// Input:
+//   path: the path to the file
+// Output:
+//   Return the new GSetMap.
+#define GSETMAPFILE_(N, T)      \
+GSetMap* GSetMapFile_ ## N(     \
+  char const* const path)
+GSETMAPFILE_(Char, char);
+GSETMAPFILE_(UChar, unsigned char);
+GSETMAPFILE_(Int, int);
+GSETMAPFILE_(UInt, unsigned int);
+GSETMAPFILE_(Long, long);
+GSETMAPFILE_(ULong, unsigned long);
+GSETMAPFILE_(Float, float);
+GSETMAPFILE_(Double, double);
+
+// Unmap the file of a read-only view and free the memory it used
+// Input:
+//   that: the GSetMap to be freed
+void GSetMapFree_(
+  GSetMap** const that);
+
+// Get the number of data in a read-only view
+// Input:
+//   that: the view
+// Output:
+//   Return the number of data.
+size_t GSetMapGetSize_(
+  GSetMap const* const that);
+
+// Get the data of a read-only view as an array
+// Input:
+//   that: the view
+// Output:
+//   Return the array of data, in the mapped file.
+#define GSETMAPGETARR_(N, T)    \
+T const* GSetMapGetArr_ ## N(   \
+  GSetMap const* const that)
+GSETMAPGETARR_(Char, char);
+GSETMAPGETARR_(UChar, unsigned char);
+GSETMAPGETARR_(Int, int);
+GSETMAPGETARR_(UInt, unsigned int);
+GSETMAPGETARR_(Long, long);
+GSETMAPGETARR_(ULong, unsigned long);
+GSETMAPGETARR_(Float, float);
+GSETMAPGETARR_(Double, double);
+
+// Allocate memory for a new iterator on a read-only view
+// Input:
+//   type: the type of iteration
+// Output:
+//   Return the new GSetMapIter.
+GSetMapIter* GSetMapIterAlloc(
+  GSetIterType const type);
+
+// Free the memory used by an iterator on a read-only view
+// Input:
+//   that: the GSetMapIter to be freed
+void GSetMapIterFree_(
+  GSetMapIter** const that);
+
+// Reset an iterator on a read-only view to its first data
+// Inputs:
+//   that: the iterator
+//    map: the view
+void GSetMapIterReset_(
+  GSetMapIter* const that,
+  GSetMap const* const map);
+
+// Check if an iterator on a read-only view is on a data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator is on a data, false else (the view is
+//   empty or no data matches the iterator's filter)
+bool GSetMapIterIsReady_(
+  GSetMapIter const* const that);
+
+// Move an iterator on a read-only view to the next data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator could move to the next data, else false
+bool GSetMapIterNext_(
+  GSetMapIter* const that);
+
+// Move an iterator on a read-only view to the previous data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator could move to the previous data, else false
+bool GSetMapIterPrev_(
+  GSetMapIter* const that);
+
+// Check if an iterator on a read-only view is on its first data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator is on its first data, else false
+bool GSetMapIterIsFirst_(
+  GSetMapIter const* const that);
+
+// Check if an iterator on a read-only view is on its last data
+// Input:
+//   that: the iterator
+// Output:
+//   Return true if the iterator is on its last data, else false
+bool GSetMapIterIsLast_(
+  GSetMapIter const* const that);
+
+// Set the type of an iterator on a read-only view
+// Inputs:
+//   that: the iterator
+//   type: the type
+void GSetMapIterSetType_(
+  GSetMapIter* const that,
+  GSetIterType const type);
+
+// Get the type of an iterator on a read-only view
+// Input:
+//   that: the iterator
+// Output:
+//   Return the type of the iterator
+GSetIterType GSetMapIterGetType_(
+  GSetMapIter const* const that);
+
+// Set the filter of an iterator on a read-only view. The filter's function
+// receives a pointer to the data in the mapped file and must not modify it.
+// Inputs:
+//     that: the iterator
+//      fun: the filter's function
+//   params: the parameters of the filter's function
+void GSetMapIterSetFilter_(
+  GSetMapIter* const that,
+  GSetIterFilterFun fun,
+              void* params);
+
+// Get the parameters of the filter's function of an iterator on a
+// read-only view
+// Input:
+//   that: the iterator
+// Output:
+//   Return the parameters of the filter's function
+void* GSetMapIterGetFilterParam_(
+  GSetMapIter* const that);
+
+// Count the number of data enumerated by an iterator on a read-only view
+// Inputs:
+//   that: the iterator
+//    map: the view
+// Output:
+//   Return the number of data
+size_t GSetMapIterCount_(
+  GSetMapIter const* const that,
+      GSetMap const* const map);
+
+// Get the current data of an iterator on a read-only view. Raise
+// TryCatchExc_OutOfRange if the iterator is not on a data.
+// Input:
+//   that: the iterator
+// Output:
+//   Return the data
+#define GSETMAPITERGET_(N, T)       \
+T GSetMapIterGet_ ## N(             \
+  GSetMapIter const* const that)
+GSETMAPITERGET_(Char, char);
+GSETMAPITERGET_(UChar, unsigned char);
+GSETMAPITERGET_(Int, int);
+GSETMAPITERGET_(UInt, unsigned int);
+GSETMAPITERGET_(Long, long);
+GSETMAPITERGET_(ULong, unsigned long);
+GSETMAPITERGET_(Float, float);
+GSETMAPITERGET_(Double, double);
+
+// Get the current data of an iterator on a read-only view, without raising
+// exception
+// Inputs:
+//   that: the iterator
+//   data: receives the data
+// Output:
+//   If the iterator is on a data, copy it into 'data' and return true.
+//   Else, return false.
+#define GSETMAPITERTRYGET_(N, T)    \
+bool GSetMapIterTryGet_ ## N(       \
+  GSetMapIter const* const that,    \
+                 T* const data)
+GSETMAPITERTRYGET_(Char, char);
+GSETMAPITERTRYGET_(UChar, unsigned char);
+GSETMAPITERTRYGET_(Int, int);
+GSETMAPITERTRYGET_(UInt, unsigned int);
+GSETMAPITERTRYGET_(Long, long);
+GSETMAPITERTRYGET_(ULong, unsigned long);
+GSETMAPITERTRYGET_(Float, float);
+GSETMAPITERTRYGET_(Double, double);
+
+// Encode a set of integers sorted in increasing order into a compressed
+// set. The data are encoded by blocks of 128: the first data of the block,
+// and the differences between consecutive data bit-packed with the number
+// of bits of the largest one. A set not sorted in increasing order is
+// encoded without loss, but less compactly and GSetPackedContains_<N> then
+// checks all its data.
+// Input:
+//   that: the set
+// Output:
+//   Return the new GSetPacked.
+#define GSETPACK_(N, T)             \
+GSetPacked* GSetPack_ ## N(         \
+  GSet const* const that)
+GSETPACK_(Long, long);
+GSETPACK_(ULong, unsigned long);
+
+// Free the memory used by a compressed set
+// Input:
+//   that: the GSetPacked to be freed
+void GSetPackedFree_(
+  GSetPacked** const that);
+
+// Get the number of data in a compressed set
 // Input:
-//   that: the iterator
-//    set: the associated set
-void GSetIterReset_(
-    GSetIter* const that,
-  GSet const* const set);
+//   that: the compressed set
+// Output:
+//   Return the number of data.
+size_t GSetPackedGetSize_(
+  GSetPacked const* const that);
 
-// Check if the iterator is ready
+// Get the memory used by a compressed set
 // Input:
-//   that: the iterator
+//   that: the compressed set
 // Output:
-//   Return true if the iterator is on an element of its set, false else
-//   (either it's because the set is empty, or the iterator's filter has
-//   no matching element in the set)
-bool GSetIterIsReady_(
-    GSetIter* const that);
+//   Return the number of bytes allocated for the compressed set.
+size_t GSetPackedGetMemSize_(
+  GSetPacked const* const that);
+
+// Decode the data of a compressed set and add them at the tail of a set.
+// The data are decoded one block at a time and the elements of a block
+// are allocated at once (one by one if the set is bounded, to apply its
+// policy).
+// Inputs:
+//     that: the set
+//   packed: the compressed set
+// Output:
+//   Return the number of data added to the set
+#define GSETUNPACK_(N, T)           \
+size_t GSetUnpack_ ## N(            \
+              GSet* const that,     \
+  GSetPacked const* const packed)
+GSETUNPACK_(Long, long);
+GSETUNPACK_(ULong, unsigned long);
+
+// Check if a compressed set contains a data. The block which may contain
+// the data is searched by dichotomy and only this block is decoded.
+// Inputs:
+//   that: the compressed set
+//   data: the data
+// Output:
+//   Return true if the data is in the compressed set, else false.
+#define GSETPACKEDCONTAINS_(N, T)   \
+bool GSetPackedContains_ ## N(      \
+  GSetPacked const* const that,     \
+                T const data)
+GSETPACKEDCONTAINS_(Long, long);
+GSETPACKEDCONTAINS_(ULong, unsigned long);
+
+// Allocate memory for a new iterator on a compressed set. The iterator
+// decodes the block of its current data, the other blocks staying
+// compressed.
+// Input:
+//   type: the type of iteration
+// Output:
+//   Return the new GSetPackedIter.
+GSetPackedIter* GSetPackedIterAlloc(
+  GSetIterType const type);
 
-// Move the iterator to the next element
+// Free the memory used by an iterator on a compressed set
+// Input:
+//   that: the GSetPackedIter to be freed
+void GSetPackedIterFree_(
+  GSetPackedIter** const that);
+
+// Reset an iterator on a compressed set to its first data
+// Inputs:
+//     that: the iterator
+//   packed: the compressed set
+void GSetPackedIterReset_(
+  GSetPackedIter* const that,
+  GSetPacked const* const packed);
+
+// Check if an iterator on a compressed set is on a data
 // Input:
 //   that: the iterator
 // Output:
-// Return true if the iterator could move to the next element, else false
-bool GSetIterNext_(
-  GSetIter* const that);
+//   Return true if the iterator is on a data, false else (the set is
+//   empty or no data matches the iterator's filter)
+bool GSetPackedIterIsReady_(
+  GSetPackedIter const* const that);
 
-// Move the iterator to the previous element
+// Move an iterator on a compressed set to the next data
 // Input:
 //   that: the iterator
 // Output:
-// Return true if the iterator could move to the previous element, else false
-bool GSetIterPrev_(
-  GSetIter* const that);
+//   Return true if the iterator could move to the next data, else false
+bool GSetPackedIterNext_(
+  GSetPackedIter* const that);
 
-// Check if an iterator is on its first element
+// Move an iterator on a compressed set to the previous data
 // Input:
 //   that: the iterator
 // Output:
-// Return true if the iterator is on its first element, else false
-bool GSetIterIsFirst_(
-  GSetIter* const that);
+//   Return true if the iterator could move to the previous data, else false
+bool GSetPackedIterPrev_(
+  GSetPackedIter* const that);
 
-// Check if an iterator is on its last element
+// Check if an iterator on a compressed set is on its first data
 // Input:
 //   that: the iterator
 // Output:
-// Return true if the iterator is on its last element, else false
-bool GSetIterIsLast_(
-  GSetIter* const that);
+//   Return true if the iterator is on its first data, else false
+bool GSetPackedIterIsFirst_(
+  GSetPackedIter const* const that);
 
-// Clone an iterator
+// Check if an iterator on a compressed set is on its last data
 // Input:
 //   that: the iterator
 // Output:
-//   Return a clone of the iterator
-GSetIter* GSetIterClone_(
-  GSetIter const* const that);
+//   Return true if the iterator is on its last data, else false
+bool GSetPackedIterIsLast_(
+  GSetPackedIter const* const that);
 
-// Set the type of an iterator
-// Input:
+// Set the type of an iterator on a compressed set
+// Inputs:
 //   that: the iterator
 //   type: the type
-void GSetIterSetType_(
-     GSetIter* const that,
-  GSetIterType const type);
+void GSetPackedIterSetType_(
+  GSetPackedIter* const that,
+     GSetIterType const type);
 
-// Get the type of an iterator
+// Get the type of an iterator on a compressed set
 // Input:
 //   that: the iterator
-// Return the type of the iterator
-GSetIterType GSetIterGetType_(
-  GSetIter const* const that);
+// Output:
+//   Return the type of the iterator
+GSetIterType GSetPackedIterGetType_(
+  GSetPackedIter const* const that);
 
-// Set the filter of an iterator
+// Set the filter of an iterator on a compressed set. The filter's function
+// receives a pointer to the decoded data and must not modify it.
 // Inputs:
 //     that: the iterator
 //      fun: the filter's function
 //   params: the parameters of the filter's function
-typedef bool (*GSetIterFilterFun)(
-  void*,
-  void*);
-void GSetIterSetFilter_(
-    GSetIter* const that,
+void GSetPackedIterSetFilter_(
+  GSetPackedIter* const that,
   GSetIterFilterFun fun,
               void* params);
 
-// Get the filter's function parameters
+// Get the parameters of the filter's function of an iterator on a
+// compressed set
 // Input:
-//     that: the iterator
+//   that: the iterator
 // Output:
 //   Return the parameters of the filter's function
-void* GSetIterGetFilterParam_(
-  GSetIter* const that);
+void* GSetPackedIterGetFilterParam_(
+  GSetPackedIter* const that);
 
-// Count the number of elements enumerated by an iterator
+// Count the number of data enumerated by an iterator on a compressed set
 // Inputs:
+//     that: the iterator
+//   packed: the compressed set
+// Output:
+//   Return the number of data
+size_t GSetPackedIterCount_(
+  GSetPackedIter const* const that,
+      GSetPacked const* const packed);
+
+// Get the current data of an iterator on a compressed set. Raise
+// TryCatchExc_OutOfRange if the iterator is not on a data.
+// Input:
 //   that: the iterator
-//    set: the set
 // Output:
-//   Return the number of elements
-size_t GSetIterCount_(
-  GSetIter const* const that,
-      GSet const* const set);
+//   Return the data
+#define GSETPACKEDITERGET_(N, T)    \
+T GSetPackedIterGet_ ## N(          \
+  GSetPackedIter const* const that)
+GSETPACKEDITERGET_(Long, long);
+GSETPACKEDITERGET_(ULong, unsigned long);
+
+// Get the current data of an iterator on a compressed set, without raising
+// exception
+// Inputs:
+//   that: the iterator
+//   data: receives the data
+// Output:
+//   If the iterator is on a data, copy it into 'data' and return true.
+//   Else, return false.
+#define GSETPACKEDITERTRYGET_(N, T) \
+bool GSetPackedIterTryGet_ ## N(    \
+  GSetPackedIter const* const that, \
+                    T* const data)
+GSETPACKEDITERTRYGET_(Long, long);
+GSETPACKEDITERTRYGET_(ULong, unsigned long);
 
 // ================== Typed GSet code auto generation  ======================
 
@@ -401,16 +2398,33 @@ size_t GSetIterCount_(
     Type t;                                                                  \
   };                                                                         \
   typedef struct GSet ## Name GSet ## Name;                                  \
-  static inline GSet ## Name* GSet ## Name ## Alloc(                         \
+  static inline GSet ## Name* GSet ## Name ## AllocNoExc(                    \
     void) {                                                                  \
     GSet ## Name* that = malloc(sizeof(GSet ## Name));                       \
-    if (that == NULL) Raise(TryCatchExc_MallocFailed);                       \
-    Try {                                                                    \
-      *that = (GSet ## Name ) { .s = GSetAlloc() };                          \
-    } CatchDefault {                                                         \
+    if (that == NULL) return NULL;                                           \
+    *that = (GSet ## Name ) { .s = GSetAllocNoExc() };                       \
+    if (that->s == NULL) {                                                   \
       free(that);                                                            \
-    } EndCatch;                                                              \
-    ForwardExc();                                                            \
+      return NULL;                                                           \
+    }                                                                        \
+    return that;                                                             \
+  }                                                                          \
+  static inline GSet ## Name* GSet ## Name ## Alloc(                         \
+    void) {                                                                  \
+    GSet ## Name* that = GSet ## Name ## AllocNoExc();                       \
+    if (that == NULL) Raise(TryCatchExc_MallocFailed);                       \
+    return that;                                                             \
+  }                                                                          \
+  static inline GSet ## Name* GSet ## Name ## AllocBounded(                  \
+    size_t const capacity,                                                   \
+    GSetBoundedPolicy const policy) {                                        \
+    GSet* s = GSetAllocBounded(capacity, policy);                            \
+    GSet ## Name* that = malloc(sizeof(GSet ## Name));                       \
+    if (that == NULL) {                                                      \
+      GSetFree_(&s);                                                         \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    *that = (GSet ## Name ) { .s = s };                                      \
     return that;                                                             \
   }                                                                          \
   static inline GSet ## Name* GSet ## Name ## FromArr(                       \
@@ -437,6 +2451,98 @@ size_t GSetIterCount_(
       default: GSetAddArr_Ptr)(that->s, size, arr);                          \
     return that;                                                             \
   }                                                                          \
+  static inline GSet ## Name* GSet ## Name ## Clone(                         \
+    GSet ## Name const* const that) {                                        \
+    GSet* s = GSetClone_(that->s);                                           \
+    GSet ## Name* clone = malloc(sizeof(GSet ## Name));                      \
+    if (clone == NULL) {                                                     \
+      GSetFree_(&s);                                                         \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    *clone = (GSet ## Name ) { .s = s };                                     \
+    return clone;                                                            \
+  }                                                                          \
+  static inline void GSet ## Name ## MergeSorted(                            \
+    GSet ## Name* const that,                                                \
+    GSet ## Name* const* const sets,                                         \
+    size_t const nb,                                                         \
+    int (* const cmp)(void const*, void const*)) {                           \
+    if (nb == 0) return;                                                     \
+    GSet** arr = malloc(sizeof(GSet*) * nb);                                 \
+    if (arr == NULL) Raise(TryCatchExc_MallocFailed);                        \
+    for (size_t i = 0; i < nb; ++i) arr[i] = sets[i]->s;                     \
+    Try {                                                                    \
+      GSetMergeSorted_(that->s, arr, nb, cmp);                               \
+    } EndCatch;                                                              \
+    free(arr);                                                               \
+    ForwardExc();                                                            \
+  }                                                                          \
+  struct GSetConc ## Name {                                                  \
+    GSetConc* q;                                                             \
+    Type t;                                                                  \
+  };                                                                         \
+  typedef struct GSetConc ## Name GSetConc ## Name;                          \
+  static inline GSetConc ## Name* GSetConc ## Name ## Alloc(                 \
+    void) {                                                                  \
+    GSetConc* q = GSetConcAlloc();                                           \
+    GSetConc ## Name* that = malloc(sizeof(GSetConc ## Name));               \
+    if (that == NULL) {                                                      \
+      GSetConcFree_(&q);                                                     \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    *that = (GSetConc ## Name ) { .q = q };                                  \
+    return that;                                                             \
+  }                                                                          \
+  struct GSetSpsc ## Name {                                                  \
+    GSetSpsc* q;                                                             \
+    Type t;                                                                  \
+  };                                                                         \
+  typedef struct GSetSpsc ## Name GSetSpsc ## Name;                          \
+  static inline GSetSpsc ## Name* GSetSpsc ## Name ## Alloc(                 \
+    size_t const capacity) {                                                 \
+    GSetSpsc* q = GSetSpscAlloc(capacity);                                   \
+    GSetSpsc ## Name* that = malloc(sizeof(GSetSpsc ## Name));               \
+    if (that == NULL) {                                                      \
+      GSetSpscFree_(&q);                                                     \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    *that = (GSetSpsc ## Name ) { .q = q };                                  \
+    return that;                                                             \
+  }                                                                          \
+  struct GSetBlockingQueue ## Name {                                         \
+    GSetBlockingQueue* q;                                                    \
+    Type t;                                                                  \
+  };                                                                         \
+  typedef struct GSetBlockingQueue ## Name GSetBlockingQueue ## Name;        \
+  static inline GSetBlockingQueue ## Name*                                   \
+    GSetBlockingQueue ## Name ## Alloc(                                      \
+    size_t const capacity) {                                                 \
+    GSetBlockingQueue* q = GSetBlockingQueueAlloc(capacity);                 \
+    GSetBlockingQueue ## Name* that =                                        \
+      malloc(sizeof(GSetBlockingQueue ## Name));                             \
+    if (that == NULL) {                                                      \
+      GSetBlockingQueueFree_(&q);                                            \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    *that = (GSetBlockingQueue ## Name ) { .q = q };                         \
+    return that;                                                             \
+  }                                                                          \
+  struct GSetSharded ## Name {                                               \
+    GSetSharded* s;                                                          \
+    Type t;                                                                  \
+  };                                                                         \
+  typedef struct GSetSharded ## Name GSetSharded ## Name;                    \
+  static inline GSetSharded ## Name* GSetSharded ## Name ## Alloc(           \
+    size_t const nbShard) {                                                  \
+    GSetSharded* s = GSetShardedAlloc(nbShard);                              \
+    GSetSharded ## Name* that = malloc(sizeof(GSetSharded ## Name));         \
+    if (that == NULL) {                                                      \
+      GSetShardedFree_(&s);                                                  \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    *that = (GSetSharded ## Name ) { .s = s };                               \
+    return that;                                                             \
+  }                                                                          \
   struct GSetIter ## Name {                                                  \
     GSet ## Name* set;                                                       \
     GSetIter* i;                                                             \
@@ -444,62 +2550,52 @@ size_t GSetIterCount_(
   typedef struct GSetIter ## Name GSetIter ## Name;                          \
   static inline GSetIter ## Name* GSetIter ## Name ## Alloc(                 \
     GSet ## Name* const set) {                                               \
+    GSetIter* i = GSetIterAlloc(GSetIterForward);                            \
     GSetIter ## Name* that = malloc(sizeof(GSetIter ## Name));               \
-    if (that == NULL) Raise(TryCatchExc_MallocFailed);                       \
-    Try {                                                                    \
-      *that =                                                                \
-        (GSetIter ## Name ) {                                                \
-          .set = set, .i = GSetIterAlloc(GSetIterForward)                    \
-        };                                                                   \
-    } CatchDefault {                                                         \
-      free(that);                                                            \
-    } EndCatch;                                                              \
-    ForwardExc();                                                            \
+    if (that == NULL) {                                                      \
+      GSetIterFree_(&i);                                                     \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    *that = (GSetIter ## Name ) { .set = set, .i = i };                      \
     GSetIterReset_(that->i, set->s);                                         \
     return that;                                                             \
   }                                                                          \
   static inline GSetIter ## Name* GSetIter ## Name ## Clone(                 \
     GSetIter ## Name const* const that) {                                    \
+    GSetIter* i = GSetIterClone_(that->i);                                   \
     GSetIter ## Name* clone = malloc(sizeof(GSetIter ## Name));              \
-    if (clone == NULL) Raise(TryCatchExc_MallocFailed);                      \
-    Try {                                                                    \
-      *clone = (GSetIter ## Name)                                            \
-        { .set = that->set, .i = GSetIterClone_(that->i) };                  \
-    } CatchDefault {                                                         \
-      free(clone);                                                           \
-    } EndCatch;                                                              \
-    ForwardExc();                                                            \
+    if (clone == NULL) {                                                     \
+      GSetIterFree_(&i);                                                     \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    *clone = (GSetIter ## Name) { .set = that->set, .i = i };                \
     return clone;                                                            \
   }                                                                          \
   static inline Type* GSetIter ## Name ## ToArr(                             \
     GSetIter ## Name const* const that) {                                    \
     size_t size = GSetIterCount_(that->i, that->set->s);                     \
     if (size == 0) return NULL;                                              \
+    GSetIter* iter = GSetIterClone_(that->i);                                \
     Type* arr = malloc(sizeof(Type) * size);                                 \
-    if (arr == NULL) Raise(TryCatchExc_MallocFailed);                        \
-    GSetIter* iter = NULL;                                                   \
-    Try {                                                                    \
-      iter = GSetIterClone_(that->i);                                        \
-      GSetIterReset_(iter, that->set->s);                                    \
-      size_t i = 0;                                                          \
-      do {                                                                   \
-        arr[i] =                                                             \
-          _Generic((that->set->t),                                           \
-            char: GSetIterGet_Char,                                          \
-            unsigned char: GSetIterGet_UChar,                                \
-            int: GSetIterGet_Int,                                            \
-            unsigned int: GSetIterGet_UInt,                                  \
-            long: GSetIterGet_Long,                                          \
-            unsigned long: GSetIterGet_ULong,                                \
-            float: GSetIterGet_Float,                                        \
-            double: GSetIterGet_Double,                                      \
-            default: GSetIterGet_Ptr)(iter);                                 \
-        ++i;                                                                 \
-      } while(GSetIterNext_(iter));                                          \
-    } CatchDefault {                                                         \
-      free(arr); GSetIterFree_(&iter);                                       \
-    } EndCatch;                                                              \
-    ForwardExc();                                                            \
+    if (arr == NULL) {                                                       \
+      GSetIterFree_(&iter);                                                  \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    GSetIterReset_(iter, that->set->s);                                      \
+    size_t i = 0;                                                            \
+    do {                                                                     \
+      _Generic((that->set->t),                                               \
+        char: GSetIterTryGet_Char,                                           \
+        unsigned char: GSetIterTryGet_UChar,                                 \
+        int: GSetIterTryGet_Int,                                             \
+        unsigned int: GSetIterTryGet_UInt,                                   \
+        long: GSetIterTryGet_Long,                                           \
+        unsigned long: GSetIterTryGet_ULong,                                 \
+        float: GSetIterTryGet_Float,                                         \
+        double: GSetIterTryGet_Double,                                       \
+        default: GSetIterTryGet_Ptr)(iter, (void*)(arr + i));                \
+      ++i;                                                                   \
+    } while(GSetIterNext_(iter));                                            \
     GSetIterFree_(&iter);                                                    \
     return arr;                                                              \
   }
@@ -527,9 +2623,21 @@ DEFINEGSETBASE(Double, double)
 GSETDEF(CharPtr, char*)
 #define GSetStr GSetCharPtr
 #define GSetStrAlloc GSetCharPtrAlloc
+#define GSetStrAllocNoExc GSetCharPtrAllocNoExc
+#define GSetStrAllocBounded GSetCharPtrAllocBounded
 #define GSetStrFree GSetCharPtrFree
 #define GSetStrFromArr GSetCharPtrFromArr
 #define GSetStrFlush GSetCharPtrFlush
+#define GSetStrMergeSorted GSetCharPtrMergeSorted
+#define GSetStrClone GSetCharPtrClone
+#define GSetConcStr GSetConcCharPtr
+#define GSetConcStrAlloc GSetConcCharPtrAlloc
+#define GSetSpscStr GSetSpscCharPtr
+#define GSetSpscStrAlloc GSetSpscCharPtrAlloc
+#define GSetBlockingQueueStr GSetBlockingQueueCharPtr
+#define GSetBlockingQueueStrAlloc GSetBlockingQueueCharPtrAlloc
+#define GSetShardedStr GSetShardedCharPtr
+#define GSetShardedStrAlloc GSetShardedCharPtrAlloc
 #define GSetIterStr GSetIterCharPtr
 #define GSetIterStrAlloc GSetIterCharPtrAlloc
 #define GSetIterStrClone GSetIterCharPtrClone
@@ -543,9 +2651,104 @@ GSETDEF(ULongPtr, unsigned long*)
 GSETDEF(FloatPtr, float*)
 GSETDEF(DoublePtr, double*)
 
+// Declare a typed read-only view GSetMap<N> of a file saved with GSetSave
+// and its iterator GSetMapIter<N>, defined for the numeric types only
+#define DEFINEGSETMAP(N, T)                                                  \
+  struct GSetMap ## N {                                                      \
+    GSetMap* s;                                                              \
+    T t;                                                                     \
+  };                                                                         \
+  typedef struct GSetMap ## N GSetMap ## N;                                  \
+  static inline GSetMap ## N* GSetMap ## N ## File(                          \
+    char const* const path) {                                                \
+    GSetMap* s = GSetMapFile_ ## N(path);                                    \
+    GSetMap ## N* that = malloc(sizeof(GSetMap ## N));                       \
+    if (that == NULL) {                                                      \
+      GSetMapFree_(&s);                                                      \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    *that = (GSetMap ## N) { .s = s };                                       \
+    return that;                                                             \
+  }                                                                          \
+  struct GSetMapIter ## N {                                                  \
+    GSetMap ## N* set;                                                       \
+    GSetMapIter* i;                                                          \
+  };                                                                         \
+  typedef struct GSetMapIter ## N GSetMapIter ## N;                          \
+  static inline GSetMapIter ## N* GSetMapIter ## N ## Alloc(                 \
+    GSetMap ## N* const set) {                                               \
+    GSetMapIter* i = GSetMapIterAlloc(GSetIterForward);                      \
+    GSetMapIter ## N* that = malloc(sizeof(GSetMapIter ## N));               \
+    if (that == NULL) {                                                      \
+      GSetMapIterFree_(&i);                                                  \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    *that = (GSetMapIter ## N) { .set = set, .i = i };                       \
+    GSetMapIterReset_(that->i, set->s);                                      \
+    return that;                                                             \
+  }
+
+DEFINEGSETMAP(Char, char)
+DEFINEGSETMAP(UChar, unsigned char)
+DEFINEGSETMAP(Int, int)
+DEFINEGSETMAP(UInt, unsigned int)
+DEFINEGSETMAP(Long, long)
+DEFINEGSETMAP(ULong, unsigned long)
+DEFINEGSETMAP(Float, float)
+DEFINEGSETMAP(Double, double)
+
+#define DEFINEGSETPACKED(N, T)                                               \
+  struct GSetPacked ## N {                                                   \
+    GSetPacked* s;                                                           \
+    T t;                                                                     \
+  };                                                                         \
+  typedef struct GSetPacked ## N GSetPacked ## N;                            \
+  static inline GSetPacked ## N* GSetPacked ## N ## Encode(                  \
+    GSet ## N const* const set) {                                            \
+    GSetPacked* s = GSetPack_ ## N(set->s);                                  \
+    GSetPacked ## N* that = malloc(sizeof(GSetPacked ## N));                 \
+    if (that == NULL) {                                                      \
+      GSetPackedFree_(&s);                                                   \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    *that = (GSetPacked ## N) { .s = s };                                    \
+    return that;                                                             \
+  }                                                                          \
+  static inline size_t GSetPacked ## N ## Decode(                            \
+    GSetPacked ## N const* const that,                                       \
+    GSet ## N* const set) {                                                  \
+    return GSetUnpack_ ## N(set->s, that->s);                                \
+  }                                                                          \
+  struct GSetPackedIter ## N {                                               \
+    GSetPacked ## N* set;                                                    \
+    GSetPackedIter* i;                                                       \
+  };                                                                         \
+  typedef struct GSetPackedIter ## N GSetPackedIter ## N;                    \
+  static inline GSetPackedIter ## N* GSetPackedIter ## N ## Alloc(           \
+    GSetPacked ## N* const set) {                                            \
+    GSetPackedIter* i = GSetPackedIterAlloc(GSetIterForward);                \
+    GSetPackedIter ## N* that = malloc(sizeof(GSetPackedIter ## N));         \
+    if (that == NULL) {                                                      \
+      GSetPackedIterFree_(&i);                                               \
+      Raise(TryCatchExc_MallocFailed);                                       \
+    }                                                                        \
+    *that = (GSetPackedIter ## N) { .set = set, .i = i };                    \
+    GSetPackedIterReset_(that->i, set->s);                                   \
+    return that;                                                             \
+  }
+
+DEFINEGSETPACKED(Long, long)
+DEFINEGSETPACKED(ULong, unsigned long)
+
 // ================== Polymorphism  ======================
 
-#define GSetGetSize(PtrToSet) GSetGetSize_((PtrToSet)->s)
+#define GSetGetSize(PtrToSet)                                                \
+  _Generic(((PtrToSet)->s),                                                  \
+    GSetMap*: GSetMapGetSize_,                                               \
+    GSetPacked*: GSetPackedGetSize_,                                         \
+    default: GSetGetSize_)((PtrToSet)->s)
+
+#define GSetGetCapacity(PtrToSet) GSetGetCapacity_((PtrToSet)->s)
 #define GSetShuffle(PtrToSet) GSetShuffle_((PtrToSet)->s)
 #define GSetEmpty(PtrToSet) GSetEmpty_((PtrToSet)->s)
 
@@ -642,6 +2845,58 @@ GSETDEF(DoublePtr, double*)
        GSetDouble*: GSetDrop_Double,                                         \
        default: GSetDrop_Ptr)((PtrToSet)->s)) == 0 ? 0 : (PtrToSet)->t)
 
+#define GSetTryPop(PtrToSet, PtrToData)                                      \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetTryPop_Char,                                              \
+    GSetUChar*: GSetTryPop_UChar,                                            \
+    GSetInt*: GSetTryPop_Int,                                                \
+    GSetUInt*: GSetTryPop_UInt,                                              \
+    GSetLong*: GSetTryPop_Long,                                              \
+    GSetULong*: GSetTryPop_ULong,                                            \
+    GSetFloat*: GSetTryPop_Float,                                            \
+    GSetDouble*: GSetTryPop_Double,                                          \
+    default: GSetTryPop_Ptr)(                                                \
+      (PtrToSet)->s, (void*)(1 ? (PtrToData) : &((PtrToSet)->t)))
+
+#define GSetTryDrop(PtrToSet, PtrToData)                                     \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetTryDrop_Char,                                             \
+    GSetUChar*: GSetTryDrop_UChar,                                           \
+    GSetInt*: GSetTryDrop_Int,                                               \
+    GSetUInt*: GSetTryDrop_UInt,                                             \
+    GSetLong*: GSetTryDrop_Long,                                             \
+    GSetULong*: GSetTryDrop_ULong,                                           \
+    GSetFloat*: GSetTryDrop_Float,                                           \
+    GSetDouble*: GSetTryDrop_Double,                                         \
+    default: GSetTryDrop_Ptr)(                                               \
+      (PtrToSet)->s, (void*)(1 ? (PtrToData) : &((PtrToSet)->t)))
+
+#define GSetPopArr(PtrToSet, Nb, Arr)                                        \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetPopArr_Char,                                              \
+    GSetUChar*: GSetPopArr_UChar,                                            \
+    GSetInt*: GSetPopArr_Int,                                                \
+    GSetUInt*: GSetPopArr_UInt,                                              \
+    GSetLong*: GSetPopArr_Long,                                              \
+    GSetULong*: GSetPopArr_ULong,                                            \
+    GSetFloat*: GSetPopArr_Float,                                            \
+    GSetDouble*: GSetPopArr_Double,                                          \
+    default: GSetPopArr_Ptr)(                                                \
+      (PtrToSet)->s, Nb, (void*)(1 ? (Arr) : &((PtrToSet)->t)))
+
+#define GSetDropArr(PtrToSet, Nb, Arr)                                       \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetDropArr_Char,                                             \
+    GSetUChar*: GSetDropArr_UChar,                                           \
+    GSetInt*: GSetDropArr_Int,                                               \
+    GSetUInt*: GSetDropArr_UInt,                                             \
+    GSetLong*: GSetDropArr_Long,                                             \
+    GSetULong*: GSetDropArr_ULong,                                           \
+    GSetFloat*: GSetDropArr_Float,                                           \
+    GSetDouble*: GSetDropArr_Double,                                         \
+    default: GSetDropArr_Ptr)(                                               \
+      (PtrToSet)->s, Nb, (void*)(1 ? (Arr) : &((PtrToSet)->t)))
+
 void GSetAppendInvalidType(
   void*,
   void*);
@@ -754,6 +3009,163 @@ void GSetMergeInvalidType(
      GSetDouble*: GSetMergeInvalidType,                                      \
      default: GSetMerge_))((PtrToSetDst)->s, (PtrToSetSrc)->s)
 
+void GSetAlgebraInvalidType(
+  void*,
+  void*,
+  int (* const)(void const*, void const*),
+  int const);
+#define GSetCheckSameType(Fun, InvalidFun, PtrToSetDst, PtrToSetSrc)        \
+ _Generic((PtrToSetDst),                                                     \
+   GSetChar*:                                                                \
+     _Generic((PtrToSetSrc),                                                 \
+       GSetChar*: Fun,                                                       \
+       default: InvalidFun),                                                 \
+   GSetUChar*:                                                               \
+     _Generic((PtrToSetSrc),                                                 \
+       GSetUChar*: Fun,                                                      \
+       default: InvalidFun),                                                 \
+   GSetInt*:                                                                 \
+     _Generic((PtrToSetSrc),                                                 \
+       GSetInt*: Fun,                                                        \
+       default: InvalidFun),                                                 \
+   GSetUInt*:                                                                \
+     _Generic((PtrToSetSrc),                                                 \
+       GSetUInt*: Fun,                                                       \
+       default: InvalidFun),                                                 \
+   GSetLong*:                                                                \
+     _Generic((PtrToSetSrc),                                                 \
+       GSetLong*: Fun,                                                       \
+       default: InvalidFun),                                                 \
+   GSetULong*:                                                               \
+     _Generic((PtrToSetSrc),                                                 \
+       GSetULong*: Fun,                                                      \
+       default: InvalidFun),                                                 \
+   GSetFloat*:                                                               \
+     _Generic((PtrToSetSrc),                                                 \
+       GSetFloat*: Fun,                                                      \
+       default: InvalidFun),                                                 \
+   GSetDouble*:                                                              \
+     _Generic((PtrToSetSrc),                                                 \
+       GSetDouble*: Fun,                                                     \
+       default: InvalidFun),                                                 \
+   default: _Generic((PtrToSetSrc),                                          \
+     GSetChar*: InvalidFun,                                                  \
+     GSetUChar*: InvalidFun,                                                 \
+     GSetInt*: InvalidFun,                                                   \
+     GSetUInt*: InvalidFun,                                                  \
+     GSetLong*: InvalidFun,                                                  \
+     GSetULong*: InvalidFun,                                                 \
+     GSetFloat*: InvalidFun,                                                 \
+     GSetDouble*: InvalidFun,                                                \
+     default: Fun))
+
+void GSetRemoveIfInvalidType(
+  void*,
+  GSetIterFilterFun,
+  void*,
+  void*);
+#define GSetRemoveIf(PtrToSet, Fun, Params) \
+  GSetRemoveIf_((PtrToSet)->s, Fun, Params, NULL)
+
+#define GSetMoveIf(PtrToSet, Fun, Params, PtrToSetOut)                       \
+  GSetCheckSameType(                                                         \
+    GSetRemoveIf_, GSetRemoveIfInvalidType, PtrToSet, PtrToSetOut)(         \
+    (PtrToSet)->s, Fun, Params, (PtrToSetOut)->s)
+
+void GSetSplitAtInvalidType(
+  void*,
+  GSetIter const* const,
+  void*);
+#define GSetSplitAt(PtrToSet, PtrToSetIter, PtrToSetOut)                     \
+  GSetCheckSameType(                                                         \
+    GSetSplitAt_, GSetSplitAtInvalidType, PtrToSet, PtrToSetOut)(           \
+    (PtrToSet)->s, (PtrToSetIter)->i, (PtrToSetOut)->s)
+
+void GSetSpliceBeforeInvalidType(
+  GSetIter const* const,
+  void*,
+  void*);
+#define GSetSpliceBefore(PtrToSetIter, PtrToSetSrc)                          \
+  GSetCheckSameType(                                                         \
+    GSetSpliceBefore_, GSetSpliceBeforeInvalidType,                          \
+    (PtrToSetIter)->set, PtrToSetSrc)(                                       \
+    (PtrToSetIter)->i, (PtrToSetIter)->set->s, (PtrToSetSrc)->s)
+
+void GSetMoveRangeInvalidType(
+  void*,
+  GSetIter const* const,
+  GSetIter const* const,
+  void*);
+#define GSetMoveRange(PtrToSetIterFrom, PtrToSetIterTo, PtrToSetDst)         \
+  GSetCheckSameType(                                                         \
+    GSetMoveRange_, GSetMoveRangeInvalidType,                                \
+    (PtrToSetIterFrom)->set, PtrToSetDst)(                                   \
+    (PtrToSetIterFrom)->set->s, (PtrToSetIterFrom)->i,                       \
+    (PtrToSetIterTo)->i, (PtrToSetDst)->s)
+
+#define GSetUnion(PtrToSetDst, PtrToSetSrc, CmpFun, Flags)                   \
+  GSetCheckSameType(                                                         \
+    GSetUnion_, GSetAlgebraInvalidType, PtrToSetDst, PtrToSetSrc)(           \
+    (PtrToSetDst)->s, (PtrToSetSrc)->s, CmpFun, Flags)
+
+#define GSetIntersect(PtrToSetDst, PtrToSetSrc, CmpFun, Flags)               \
+  GSetCheckSameType(                                                         \
+    GSetIntersect_, GSetAlgebraInvalidType, PtrToSetDst, PtrToSetSrc)(       \
+    (PtrToSetDst)->s, (PtrToSetSrc)->s, CmpFun, Flags)
+
+#define GSetDifference(PtrToSetDst, PtrToSetSrc, CmpFun, Flags)              \
+  GSetCheckSameType(                                                         \
+    GSetDifference_, GSetAlgebraInvalidType, PtrToSetDst, PtrToSetSrc)(      \
+    (PtrToSetDst)->s, (PtrToSetSrc)->s, CmpFun, Flags)
+
+#define GSetSymDiff(PtrToSetDst, PtrToSetSrc, CmpFun, Flags)                 \
+  GSetCheckSameType(                                                         \
+    GSetSymDiff_, GSetAlgebraInvalidType, PtrToSetDst, PtrToSetSrc)(         \
+    (PtrToSetDst)->s, (PtrToSetSrc)->s, CmpFun, Flags)
+
+#define GSetClone(PtrToSet)                                                  \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetCharClone,                                                \
+    GSetUChar*: GSetUCharClone,                                              \
+    GSetInt*: GSetIntClone,                                                  \
+    GSetUInt*: GSetUIntClone,                                                \
+    GSetLong*: GSetLongClone,                                                \
+    GSetULong*: GSetULongClone,                                              \
+    GSetFloat*: GSetFloatClone,                                              \
+    GSetDouble*: GSetDoubleClone,                                            \
+    GSetChar const*: GSetCharClone,                                          \
+    GSetUChar const*: GSetUCharClone,                                        \
+    GSetInt const*: GSetIntClone,                                            \
+    GSetUInt const*: GSetUIntClone,                                          \
+    GSetLong const*: GSetLongClone,                                          \
+    GSetULong const*: GSetULongClone,                                        \
+    GSetFloat const*: GSetFloatClone,                                        \
+    GSetDouble const*: GSetDoubleClone)(PtrToSet)
+
+#define GSetMergeSorted(PtrToSetDst, ArrPtrToSetSrc, Nb, CmpFun)             \
+  _Generic((PtrToSetDst),                                                    \
+    GSetChar*: GSetCharMergeSorted,                                          \
+    GSetUChar*: GSetUCharMergeSorted,                                        \
+    GSetInt*: GSetIntMergeSorted,                                            \
+    GSetUInt*: GSetUIntMergeSorted,                                          \
+    GSetLong*: GSetLongMergeSorted,                                          \
+    GSetULong*: GSetULongMergeSorted,                                        \
+    GSetFloat*: GSetFloatMergeSorted,                                        \
+    GSetDouble*: GSetDoubleMergeSorted)(                                     \
+      PtrToSetDst, ArrPtrToSetSrc, Nb, CmpFun)
+
+#define GSetInsertSorted(PtrToSet, Data, CmpFun)                             \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetInsertSorted_Char,                                        \
+    GSetUChar*: GSetInsertSorted_UChar,                                      \
+    GSetInt*: GSetInsertSorted_Int,                                          \
+    GSetUInt*: GSetInsertSorted_UInt,                                        \
+    GSetLong*: GSetInsertSorted_Long,                                        \
+    GSetULong*: GSetInsertSorted_ULong,                                      \
+    GSetFloat*: GSetInsertSorted_Float,                                      \
+    GSetDouble*: GSetInsertSorted_Double,                                    \
+    default: GSetInsertSorted_Ptr)((PtrToSet)->s, Data, CmpFun)
+
 #define GSetSort(PtrToSet, CmpFun, FlagIncreasing)                           \
   _Generic((PtrToSet),                                                       \
     GSetChar*: GSetSort_Char,                                                \
@@ -766,9 +3178,168 @@ void GSetMergeInvalidType(
     GSetDouble*: GSetSort_Double,                                            \
     default: GSetSort_Ptr)((PtrToSet)->s, CmpFun, FlagIncreasing)
 
+#define GSetApply(PtrToSet, Op, A, B)                                        \
+  _Generic((PtrToSet),                                                       \
+    GSetInt*: GSetApply_Int,                                                 \
+    GSetUInt*: GSetApply_UInt,                                               \
+    GSetLong*: GSetApply_Long,                                               \
+    GSetULong*: GSetApply_ULong,                                             \
+    GSetFloat*: GSetApply_Float,                                             \
+    GSetDouble*: GSetApply_Double)((PtrToSet)->s, Op, A, B)
+
+#define GSetApplyWith(PtrToSet, Fun, Params) \
+  GSetApplyWith_((PtrToSet)->s, Fun, Params)
+
+#define GSetUnique(PtrToSet, Mode)                                           \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetUnique_Char,                                              \
+    GSetUChar*: GSetUnique_UChar,                                            \
+    GSetInt*: GSetUnique_Int,                                                \
+    GSetUInt*: GSetUnique_UInt,                                              \
+    GSetLong*: GSetUnique_Long,                                              \
+    GSetULong*: GSetUnique_ULong,                                            \
+    GSetFloat*: GSetUnique_Float,                                            \
+    GSetDouble*: GSetUnique_Double,                                          \
+    default: GSetUnique_Ptr)((PtrToSet)->s, Mode)
+
+#define GSetSum(PtrToSet)                                                    \
+  _Generic((PtrToSet),                                                       \
+    GSetInt*: GSetSum_Int,                                                   \
+    GSetUInt*: GSetSum_UInt,                                                 \
+    GSetLong*: GSetSum_Long,                                                 \
+    GSetULong*: GSetSum_ULong,                                               \
+    GSetFloat*: GSetSum_Float,                                               \
+    GSetDouble*: GSetSum_Double)((PtrToSet)->s)
+
+#define GSetMinMax(PtrToSet, PtrToMin, PtrToMax)                             \
+  _Generic((PtrToSet),                                                       \
+    GSetInt*: GSetMinMax_Int,                                                \
+    GSetUInt*: GSetMinMax_UInt,                                              \
+    GSetLong*: GSetMinMax_Long,                                              \
+    GSetULong*: GSetMinMax_ULong,                                            \
+    GSetFloat*: GSetMinMax_Float,                                            \
+    GSetDouble*: GSetMinMax_Double)((PtrToSet)->s, PtrToMin, PtrToMax)
+
+#define GSetMean(PtrToSet)                                                   \
+  _Generic((PtrToSet),                                                       \
+    GSetInt*: GSetMean_Int,                                                  \
+    GSetUInt*: GSetMean_UInt,                                                \
+    GSetLong*: GSetMean_Long,                                                \
+    GSetULong*: GSetMean_ULong,                                              \
+    GSetFloat*: GSetMean_Float,                                              \
+    GSetDouble*: GSetMean_Double)((PtrToSet)->s)
+
+#define GSetVariance(PtrToSet)                                               \
+  _Generic((PtrToSet),                                                       \
+    GSetInt*: GSetVariance_Int,                                              \
+    GSetUInt*: GSetVariance_UInt,                                            \
+    GSetLong*: GSetVariance_Long,                                            \
+    GSetULong*: GSetVariance_ULong,                                          \
+    GSetFloat*: GSetVariance_Float,                                          \
+    GSetDouble*: GSetVariance_Double)((PtrToSet)->s)
+
+#define GSetAttachWindow(PtrToSet)                                           \
+  _Generic((PtrToSet),                                                       \
+    GSetInt*: GSetAttachWindow_Int,                                          \
+    GSetUInt*: GSetAttachWindow_UInt,                                        \
+    GSetLong*: GSetAttachWindow_Long,                                        \
+    GSetULong*: GSetAttachWindow_ULong,                                      \
+    GSetFloat*: GSetAttachWindow_Float,                                      \
+    GSetDouble*: GSetAttachWindow_Double)((PtrToSet)->s)
+
+#define GSetWindowSum(PtrToSet)                                              \
+  _Generic((PtrToSet),                                                       \
+    GSetInt*: GSetWindowSum_Int,                                             \
+    GSetUInt*: GSetWindowSum_UInt,                                           \
+    GSetLong*: GSetWindowSum_Long,                                           \
+    GSetULong*: GSetWindowSum_ULong,                                         \
+    GSetFloat*: GSetWindowSum_Float,                                         \
+    GSetDouble*: GSetWindowSum_Double)((PtrToSet)->s)
+
+#define GSetWindowMin(PtrToSet)                                              \
+  _Generic((PtrToSet),                                                       \
+    GSetInt*: GSetWindowMin_Int,                                             \
+    GSetUInt*: GSetWindowMin_UInt,                                           \
+    GSetLong*: GSetWindowMin_Long,                                           \
+    GSetULong*: GSetWindowMin_ULong,                                         \
+    GSetFloat*: GSetWindowMin_Float,                                         \
+    GSetDouble*: GSetWindowMin_Double)((PtrToSet)->s)
+
+#define GSetWindowMax(PtrToSet)                                              \
+  _Generic((PtrToSet),                                                       \
+    GSetInt*: GSetWindowMax_Int,                                             \
+    GSetUInt*: GSetWindowMax_UInt,                                           \
+    GSetLong*: GSetWindowMax_Long,                                           \
+    GSetULong*: GSetWindowMax_ULong,                                         \
+    GSetFloat*: GSetWindowMax_Float,                                         \
+    GSetDouble*: GSetWindowMax_Double)((PtrToSet)->s)
+
+#define GSetWindowMean(PtrToSet)                                             \
+  _Generic((PtrToSet),                                                       \
+    GSetInt*: GSetWindowMean_Int,                                            \
+    GSetUInt*: GSetWindowMean_UInt,                                          \
+    GSetLong*: GSetWindowMean_Long,                                          \
+    GSetULong*: GSetWindowMean_ULong,                                        \
+    GSetFloat*: GSetWindowMean_Float,                                        \
+    GSetDouble*: GSetWindowMean_Double)((PtrToSet)->s)
+
+#define GSetDetachWindow(PtrToSet) GSetDetachWindow_((PtrToSet)->s)
+#define GSetHasWindow(PtrToSet) GSetHasWindow_((PtrToSet)->s)
+
+#define GSetAttachEpoch(PtrToSet) GSetAttachEpoch_((PtrToSet)->s)
+#define GSetDetachEpoch(PtrToSet) GSetDetachEpoch_((PtrToSet)->s)
+#define GSetHasEpoch(PtrToSet) GSetHasEpoch_((PtrToSet)->s)
+#define GSetEpochEnter(PtrToSet) GSetEpochEnter_((PtrToSet)->s)
+#define GSetEpochLeave(PtrToSet, Slot) GSetEpochLeave_((PtrToSet)->s, Slot)
+#define GSetEpochReclaim(PtrToSet) GSetEpochReclaim_((PtrToSet)->s)
+
+#define GSetAttachIndex(PtrToSet)                                            \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetAttachIndex_Char,                                         \
+    GSetUChar*: GSetAttachIndex_UChar,                                       \
+    GSetInt*: GSetAttachIndex_Int,                                           \
+    GSetUInt*: GSetAttachIndex_UInt,                                         \
+    GSetLong*: GSetAttachIndex_Long,                                         \
+    GSetULong*: GSetAttachIndex_ULong,                                       \
+    GSetFloat*: GSetAttachIndex_Float,                                       \
+    GSetDouble*: GSetAttachIndex_Double,                                     \
+    default: GSetAttachIndex_Ptr)((PtrToSet)->s)
+
+#define GSetAttachIndexWith(PtrToSet, HashFun, EqFun) \
+  GSetAttachIndexWith_((PtrToSet)->s, HashFun, EqFun)
+#define GSetDetachIndex(PtrToSet) GSetDetachIndex_((PtrToSet)->s)
+#define GSetHasIndex(PtrToSet) GSetHasIndex_((PtrToSet)->s)
+
+#define GSetContains(PtrToSet, Data)                                         \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetContains_Char,                                            \
+    GSetUChar*: GSetContains_UChar,                                          \
+    GSetInt*: GSetContains_Int,                                              \
+    GSetUInt*: GSetContains_UInt,                                            \
+    GSetLong*: GSetContains_Long,                                            \
+    GSetULong*: GSetContains_ULong,                                          \
+    GSetFloat*: GSetContains_Float,                                          \
+    GSetDouble*: GSetContains_Double,                                        \
+    default: GSetContains_Ptr)((PtrToSet)->s, Data)
+
+#define GSetRemove(PtrToSet, Data)                                           \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetRemove_Char,                                              \
+    GSetUChar*: GSetRemove_UChar,                                            \
+    GSetInt*: GSetRemove_Int,                                                \
+    GSetUInt*: GSetRemove_UInt,                                              \
+    GSetLong*: GSetRemove_Long,                                              \
+    GSetULong*: GSetRemove_ULong,                                            \
+    GSetFloat*: GSetRemove_Float,                                            \
+    GSetDouble*: GSetRemove_Double,                                          \
+    default: GSetRemove_Ptr)((PtrToSet)->s, Data)
+
 #define GSetIterFree(PtrToPtrToSetIter)                                      \
   if (((PtrToPtrToSetIter) != NULL) && (*(PtrToPtrToSetIter) != NULL)) {     \
-    GSetIterFree_(&((*(PtrToPtrToSetIter))->i));                             \
+    _Generic(((*(PtrToPtrToSetIter))->i),                                    \
+      GSetMapIter*: GSetMapIterFree_,                                        \
+      GSetPackedIter*: GSetPackedIterFree_,                                  \
+      default: GSetIterFree_)(&((*(PtrToPtrToSetIter))->i));                 \
     free(*(PtrToPtrToSetIter));                                              \
     *(PtrToPtrToSetIter) = NULL;                                             \
   }                                                                          \
@@ -792,6 +3363,16 @@ void GSetMergeInvalidType(
        GSetIterULong const*: GSetIterGet_ULong,                              \
        GSetIterFloat const*: GSetIterGet_Float,                              \
        GSetIterDouble const*: GSetIterGet_Double,                            \
+       GSetMapIterChar*: GSetMapIterGet_Char,                                \
+       GSetMapIterUChar*: GSetMapIterGet_UChar,                              \
+       GSetMapIterInt*: GSetMapIterGet_Int,                                  \
+       GSetMapIterUInt*: GSetMapIterGet_UInt,                                \
+       GSetMapIterLong*: GSetMapIterGet_Long,                                \
+       GSetMapIterULong*: GSetMapIterGet_ULong,                              \
+       GSetMapIterFloat*: GSetMapIterGet_Float,                              \
+       GSetMapIterDouble*: GSetMapIterGet_Double,                            \
+       GSetPackedIterLong*: GSetPackedIterGet_Long,                          \
+       GSetPackedIterULong*: GSetPackedIterGet_ULong,                        \
        default: GSetIterGet_Ptr)((PtrToSetIter)->i)) == 0 ?                  \
          0 : (PtrToSetIter)->set->t)
 #define GSetGet GSetIterGet
@@ -812,6 +3393,54 @@ void GSetMergeInvalidType(
            0 : (PtrToSetIter)->set->t)
 #define GSetPick GSetIterPick
 
+#define GSetIterTryGet(PtrToSetIter, PtrToData)                              \
+  _Generic((PtrToSetIter),                                                   \
+    GSetIterChar*: GSetIterTryGet_Char,                                      \
+    GSetIterUChar*: GSetIterTryGet_UChar,                                    \
+    GSetIterInt*: GSetIterTryGet_Int,                                        \
+    GSetIterUInt*: GSetIterTryGet_UInt,                                      \
+    GSetIterLong*: GSetIterTryGet_Long,                                      \
+    GSetIterULong*: GSetIterTryGet_ULong,                                    \
+    GSetIterFloat*: GSetIterTryGet_Float,                                    \
+    GSetIterDouble*: GSetIterTryGet_Double,                                  \
+    GSetIterChar const*: GSetIterTryGet_Char,                                \
+    GSetIterUChar const*: GSetIterTryGet_UChar,                              \
+    GSetIterInt const*: GSetIterTryGet_Int,                                  \
+    GSetIterUInt const*: GSetIterTryGet_UInt,                                \
+    GSetIterLong const*: GSetIterTryGet_Long,                                \
+    GSetIterULong const*: GSetIterTryGet_ULong,                              \
+    GSetIterFloat const*: GSetIterTryGet_Float,                              \
+    GSetIterDouble const*: GSetIterTryGet_Double,                            \
+    GSetMapIterChar*: GSetMapIterTryGet_Char,                                \
+    GSetMapIterUChar*: GSetMapIterTryGet_UChar,                              \
+    GSetMapIterInt*: GSetMapIterTryGet_Int,                                  \
+    GSetMapIterUInt*: GSetMapIterTryGet_UInt,                                \
+    GSetMapIterLong*: GSetMapIterTryGet_Long,                                \
+    GSetMapIterULong*: GSetMapIterTryGet_ULong,                              \
+    GSetMapIterFloat*: GSetMapIterTryGet_Float,                              \
+    GSetMapIterDouble*: GSetMapIterTryGet_Double,                            \
+    GSetPackedIterLong*: GSetPackedIterTryGet_Long,                          \
+    GSetPackedIterULong*: GSetPackedIterTryGet_ULong,                        \
+    default: GSetIterTryGet_Ptr)(                                            \
+      (PtrToSetIter)->i,                                                     \
+      (void*)(1 ? (PtrToData) : &((PtrToSetIter)->set->t)))
+#define GSetTryGet GSetIterTryGet
+
+#define GSetIterTryPick(PtrToSetIter, PtrToData)                             \
+  _Generic((PtrToSetIter),                                                   \
+    GSetIterChar*: GSetIterTryPick_Char,                                     \
+    GSetIterUChar*: GSetIterTryPick_UChar,                                   \
+    GSetIterInt*: GSetIterTryPick_Int,                                       \
+    GSetIterUInt*: GSetIterTryPick_UInt,                                     \
+    GSetIterLong*: GSetIterTryPick_Long,                                     \
+    GSetIterULong*: GSetIterTryPick_ULong,                                   \
+    GSetIterFloat*: GSetIterTryPick_Float,                                   \
+    GSetIterDouble*: GSetIterTryPick_Double,                                 \
+    default: GSetIterTryPick_Ptr)(                                           \
+      (PtrToSetIter)->i, (PtrToSetIter)->set->s,                             \
+      (void*)(1 ? (PtrToData) : &((PtrToSetIter)->set->t)))
+#define GSetTryPick GSetIterTryPick
+
 #define GSetIterAddBefore(PtrToSetIter, Data)                                \
   do {                                                                       \
     _Generic((PtrToSetIter),                                                 \
@@ -829,22 +3458,104 @@ void GSetMergeInvalidType(
   } while (false)
 #define GSetAddBefore GSetIterAddBefore
 
-#define GSetIterReset(PtrToSetIter) \
-  GSetIterReset_((PtrToSetIter)->i, (PtrToSetIter)->set->s)
-#define GSetIterIsReady(PtrToSetIter) GSetIterIsReady_((PtrToSetIter)->i)
-#define GSetIterNext(PtrToSetIter) GSetIterNext_((PtrToSetIter)->i)
-#define GSetIterPrev(PtrToSetIter) GSetIterPrev_((PtrToSetIter)->i)
-#define GSetIterIsFirst(PtrToSetIter) GSetIterIsFirst_((PtrToSetIter)->i)
-#define GSetIterIsLast(PtrToSetIter) GSetIterIsLast_((PtrToSetIter)->i)
-#define GSetIterSetType(PtrToSetIter, Type) \
-  GSetIterSetType_(PtrToSetIter->i, Type)
-#define GSetIterGetType(PtrToSetIter) GSetIterGetType_(PtrToSetIter->i)
-#define GSetIterSetFilter(PtrToSetIter, PtrToFun, PtrToParams) \
-  GSetIterSetFilter_((PtrToSetIter)->i, PtrToFun, PtrToParams)
-#define GSetIterGetFilterParam(PtrToSetIter) \
-  GSetIterGetFilterParam_((PtrToSetIter)->i)
-#define GSetIterCount(PtrToSetIter) \
-  GSetIterCount_((PtrToSetIter)->i, (PtrToSetIter)->set->s)
+#define GSetIterFind(PtrToSetIter, Data)                                     \
+  _Generic((PtrToSetIter),                                                   \
+    GSetIterChar*: GSetIterFind_Char,                                        \
+    GSetIterUChar*: GSetIterFind_UChar,                                      \
+    GSetIterInt*: GSetIterFind_Int,                                          \
+    GSetIterUInt*: GSetIterFind_UInt,                                        \
+    GSetIterLong*: GSetIterFind_Long,                                        \
+    GSetIterULong*: GSetIterFind_ULong,                                      \
+    GSetIterFloat*: GSetIterFind_Float,                                      \
+    GSetIterDouble*: GSetIterFind_Double,                                    \
+    default: GSetIterFind_Ptr)(                                              \
+      (PtrToSetIter)->i, (PtrToSetIter)->set->s, Data)
+#define GSetFind GSetIterFind
+
+#define GSetIterLowerBound(PtrToSetIter, Data, CmpFun)                       \
+  _Generic((PtrToSetIter),                                                   \
+    GSetIterChar*: GSetIterLowerBound_Char,                                  \
+    GSetIterUChar*: GSetIterLowerBound_UChar,                                \
+    GSetIterInt*: GSetIterLowerBound_Int,                                    \
+    GSetIterUInt*: GSetIterLowerBound_UInt,                                  \
+    GSetIterLong*: GSetIterLowerBound_Long,                                  \
+    GSetIterULong*: GSetIterLowerBound_ULong,                                \
+    GSetIterFloat*: GSetIterLowerBound_Float,                                \
+    GSetIterDouble*: GSetIterLowerBound_Double,                              \
+    default: GSetIterLowerBound_Ptr)(                                        \
+      (PtrToSetIter)->i, (PtrToSetIter)->set->s, Data, CmpFun)
+#define GSetLowerBound GSetIterLowerBound
+
+#define GSetIterUpperBound(PtrToSetIter, Data, CmpFun)                       \
+  _Generic((PtrToSetIter),                                                   \
+    GSetIterChar*: GSetIterUpperBound_Char,                                  \
+    GSetIterUChar*: GSetIterUpperBound_UChar,                                \
+    GSetIterInt*: GSetIterUpperBound_Int,                                    \
+    GSetIterUInt*: GSetIterUpperBound_UInt,                                  \
+    GSetIterLong*: GSetIterUpperBound_Long,                                  \
+    GSetIterULong*: GSetIterUpperBound_ULong,                                \
+    GSetIterFloat*: GSetIterUpperBound_Float,                                \
+    GSetIterDouble*: GSetIterUpperBound_Double,                              \
+    default: GSetIterUpperBound_Ptr)(                                        \
+      (PtrToSetIter)->i, (PtrToSetIter)->set->s, Data, CmpFun)
+#define GSetUpperBound GSetIterUpperBound
+
+#define GSetIterReset(PtrToSetIter)                                          \
+  _Generic(((PtrToSetIter)->i),                                              \
+    GSetMapIter*: GSetMapIterReset_,                                         \
+    GSetPackedIter*: GSetPackedIterReset_,                                   \
+    default: GSetIterReset_)((PtrToSetIter)->i, (PtrToSetIter)->set->s)
+#define GSetIterIsReady(PtrToSetIter)                                        \
+  _Generic(((PtrToSetIter)->i),                                              \
+    GSetMapIter*: GSetMapIterIsReady_,                                       \
+    GSetPackedIter*: GSetPackedIterIsReady_,                                 \
+    default: GSetIterIsReady_)((PtrToSetIter)->i)
+#define GSetIterNext(PtrToSetIter)                                           \
+  _Generic(((PtrToSetIter)->i),                                              \
+    GSetMapIter*: GSetMapIterNext_,                                          \
+    GSetPackedIter*: GSetPackedIterNext_,                                    \
+    default: GSetIterNext_)((PtrToSetIter)->i)
+#define GSetIterPrev(PtrToSetIter)                                           \
+  _Generic(((PtrToSetIter)->i),                                              \
+    GSetMapIter*: GSetMapIterPrev_,                                          \
+    GSetPackedIter*: GSetPackedIterPrev_,                                    \
+    default: GSetIterPrev_)((PtrToSetIter)->i)
+#define GSetIterIsFirst(PtrToSetIter)                                        \
+  _Generic(((PtrToSetIter)->i),                                              \
+    GSetMapIter*: GSetMapIterIsFirst_,                                       \
+    GSetPackedIter*: GSetPackedIterIsFirst_,                                 \
+    default: GSetIterIsFirst_)((PtrToSetIter)->i)
+#define GSetIterIsLast(PtrToSetIter)                                         \
+  _Generic(((PtrToSetIter)->i),                                              \
+    GSetMapIter*: GSetMapIterIsLast_,                                        \
+    GSetPackedIter*: GSetPackedIterIsLast_,                                  \
+    default: GSetIterIsLast_)((PtrToSetIter)->i)
+#define GSetIterSetType(PtrToSetIter, Type)                                  \
+  _Generic(((PtrToSetIter)->i),                                              \
+    GSetMapIter*: GSetMapIterSetType_,                                       \
+    GSetPackedIter*: GSetPackedIterSetType_,                                 \
+    default: GSetIterSetType_)((PtrToSetIter)->i, Type)
+#define GSetIterGetType(PtrToSetIter)                                        \
+  _Generic(((PtrToSetIter)->i),                                              \
+    GSetMapIter*: GSetMapIterGetType_,                                       \
+    GSetPackedIter*: GSetPackedIterGetType_,                                 \
+    default: GSetIterGetType_)((PtrToSetIter)->i)
+#define GSetIterSetFilter(PtrToSetIter, PtrToFun, PtrToParams)               \
+  _Generic(((PtrToSetIter)->i),                                              \
+    GSetMapIter*: GSetMapIterSetFilter_,                                     \
+    GSetPackedIter*: GSetPackedIterSetFilter_,                               \
+    default: GSetIterSetFilter_)(                                            \
+      (PtrToSetIter)->i, PtrToFun, PtrToParams)
+#define GSetIterGetFilterParam(PtrToSetIter)                                 \
+  _Generic(((PtrToSetIter)->i),                                              \
+    GSetMapIter*: GSetMapIterGetFilterParam_,                                \
+    GSetPackedIter*: GSetPackedIterGetFilterParam_,                          \
+    default: GSetIterGetFilterParam_)((PtrToSetIter)->i)
+#define GSetIterCount(PtrToSetIter)                                          \
+  _Generic(((PtrToSetIter)->i),                                              \
+    GSetMapIter*: GSetMapIterCount_,                                         \
+    GSetPackedIter*: GSetPackedIterCount_,                                   \
+    default: GSetIterCount_)((PtrToSetIter)->i, (PtrToSetIter)->set->s)
 #define GSetReset GSetIterReset
 #define GSetIsReady GSetIterIsReady
 #define GSetNext GSetIterNext
@@ -871,6 +3582,352 @@ void GSetMergeInvalidType(
     hasEnded = !GSetIterNext(PtrToSetIter), ++Idx)
 #define GSETENUM GSetIterEnumerate
 
+#define GSetParallelForEach(                                                 \
+  PtrToSet, Fun, Params, NbThread, Accs, SizeAcc, Reduce)                    \
+  GSetParallelForEach_(                                                      \
+    (PtrToSet)->s, Fun, Params, NbThread, Accs, SizeAcc, Reduce)
+
+#define GSetIterParallelForEach(                                             \
+  PtrToSetIter, Fun, Params, NbThread, Accs, SizeAcc, Reduce)                \
+  GSetIterParallelForEach_(                                                  \
+    (PtrToSetIter)->i, (PtrToSetIter)->set->s, Fun, Params, NbThread, Accs,  \
+    SizeAcc, Reduce)
+
+#define GSetConcFree(PtrToPtrToQueue)                                        \
+  if (((PtrToPtrToQueue) != NULL) && (*(PtrToPtrToQueue) != NULL)) {         \
+    GSetConcFree_(&((*(PtrToPtrToQueue))->q));                               \
+    free(*(PtrToPtrToQueue));                                                \
+    *(PtrToPtrToQueue) = NULL;                                               \
+  }
+
+#define GSetConcAdd(PtrToQueue, Data)                                        \
+  do {                                                                       \
+    _Generic((PtrToQueue),                                                   \
+      GSetConcChar*: GSetConcAdd_Char,                                       \
+      GSetConcUChar*: GSetConcAdd_UChar,                                     \
+      GSetConcInt*: GSetConcAdd_Int,                                         \
+      GSetConcUInt*: GSetConcAdd_UInt,                                       \
+      GSetConcLong*: GSetConcAdd_Long,                                       \
+      GSetConcULong*: GSetConcAdd_ULong,                                     \
+      GSetConcFloat*: GSetConcAdd_Float,                                     \
+      GSetConcDouble*: GSetConcAdd_Double,                                   \
+      default: GSetConcAdd_Ptr)((PtrToQueue)->q, Data);                      \
+    (void)sizeof((PtrToQueue)->t = Data);                                    \
+  } while (false)
+
+#define GSetConcPop(PtrToQueue, PtrToData)                                   \
+  _Generic((PtrToQueue),                                                     \
+    GSetConcChar*: GSetConcPop_Char,                                         \
+    GSetConcUChar*: GSetConcPop_UChar,                                       \
+    GSetConcInt*: GSetConcPop_Int,                                           \
+    GSetConcUInt*: GSetConcPop_UInt,                                         \
+    GSetConcLong*: GSetConcPop_Long,                                         \
+    GSetConcULong*: GSetConcPop_ULong,                                       \
+    GSetConcFloat*: GSetConcPop_Float,                                       \
+    GSetConcDouble*: GSetConcPop_Double,                                     \
+    default: GSetConcPop_Ptr)(                                               \
+      (PtrToQueue)->q, (void*)(1 ? (PtrToData) : &((PtrToQueue)->t)))
+
+#define GSetSpscFree(PtrToPtrToQueue)                                        \
+  if (((PtrToPtrToQueue) != NULL) && (*(PtrToPtrToQueue) != NULL)) {         \
+    GSetSpscFree_(&((*(PtrToPtrToQueue))->q));                               \
+    free(*(PtrToPtrToQueue));                                                \
+    *(PtrToPtrToQueue) = NULL;                                               \
+  }
+
+#define GSetSpscGetCapacity(PtrToQueue) GSetSpscGetCapacity_((PtrToQueue)->q)
+
+#define GSetSpscGetSize(PtrToQueue) GSetSpscGetSize_((PtrToQueue)->q)
+
+#define GSetSpscAdd(PtrToQueue, Data)                                        \
+  ((void)sizeof((PtrToQueue)->t = (Data)),                                   \
+    _Generic((PtrToQueue),                                                   \
+      GSetSpscChar*: GSetSpscAdd_Char,                                       \
+      GSetSpscUChar*: GSetSpscAdd_UChar,                                     \
+      GSetSpscInt*: GSetSpscAdd_Int,                                         \
+      GSetSpscUInt*: GSetSpscAdd_UInt,                                       \
+      GSetSpscLong*: GSetSpscAdd_Long,                                       \
+      GSetSpscULong*: GSetSpscAdd_ULong,                                     \
+      GSetSpscFloat*: GSetSpscAdd_Float,                                     \
+      GSetSpscDouble*: GSetSpscAdd_Double,                                   \
+      default: GSetSpscAdd_Ptr)((PtrToQueue)->q, Data))
+
+#define GSetSpscAddArr(PtrToQueue, Nb, Arr)                                  \
+  _Generic((PtrToQueue),                                                     \
+    GSetSpscChar*: GSetSpscAddArr_Char,                                      \
+    GSetSpscUChar*: GSetSpscAddArr_UChar,                                    \
+    GSetSpscInt*: GSetSpscAddArr_Int,                                        \
+    GSetSpscUInt*: GSetSpscAddArr_UInt,                                      \
+    GSetSpscLong*: GSetSpscAddArr_Long,                                      \
+    GSetSpscULong*: GSetSpscAddArr_ULong,                                    \
+    GSetSpscFloat*: GSetSpscAddArr_Float,                                    \
+    GSetSpscDouble*: GSetSpscAddArr_Double,                                  \
+    default: GSetSpscAddArr_Ptr)(                                            \
+      (PtrToQueue)->q, Nb, (void const*)(1 ? (Arr) : &((PtrToQueue)->t)))
+
+#define GSetSpscPop(PtrToQueue, PtrToData)                                   \
+  _Generic((PtrToQueue),                                                     \
+    GSetSpscChar*: GSetSpscPop_Char,                                         \
+    GSetSpscUChar*: GSetSpscPop_UChar,                                       \
+    GSetSpscInt*: GSetSpscPop_Int,                                           \
+    GSetSpscUInt*: GSetSpscPop_UInt,                                         \
+    GSetSpscLong*: GSetSpscPop_Long,                                         \
+    GSetSpscULong*: GSetSpscPop_ULong,                                       \
+    GSetSpscFloat*: GSetSpscPop_Float,                                       \
+    GSetSpscDouble*: GSetSpscPop_Double,                                     \
+    default: GSetSpscPop_Ptr)(                                               \
+      (PtrToQueue)->q, (void*)(1 ? (PtrToData) : &((PtrToQueue)->t)))
+
+#define GSetSpscPopArr(PtrToQueue, Nb, Arr)                                  \
+  _Generic((PtrToQueue),                                                     \
+    GSetSpscChar*: GSetSpscPopArr_Char,                                      \
+    GSetSpscUChar*: GSetSpscPopArr_UChar,                                    \
+    GSetSpscInt*: GSetSpscPopArr_Int,                                        \
+    GSetSpscUInt*: GSetSpscPopArr_UInt,                                      \
+    GSetSpscLong*: GSetSpscPopArr_Long,                                      \
+    GSetSpscULong*: GSetSpscPopArr_ULong,                                    \
+    GSetSpscFloat*: GSetSpscPopArr_Float,                                    \
+    GSetSpscDouble*: GSetSpscPopArr_Double,                                  \
+    default: GSetSpscPopArr_Ptr)(                                            \
+      (PtrToQueue)->q, Nb, (void*)(1 ? (Arr) : &((PtrToQueue)->t)))
+
+#define GSetBlockingQueueFree(PtrToPtrToQueue)                               \
+  if (((PtrToPtrToQueue) != NULL) && (*(PtrToPtrToQueue) != NULL)) {         \
+    GSetBlockingQueueFree_(&((*(PtrToPtrToQueue))->q));                      \
+    free(*(PtrToPtrToQueue));                                                \
+    *(PtrToPtrToQueue) = NULL;                                               \
+  }
+
+#define GSetBlockingQueueClose(PtrToQueue)                                   \
+  GSetBlockingQueueClose_((PtrToQueue)->q)
+
+#define GSetBlockingQueueIsClosed(PtrToQueue)                                \
+  GSetBlockingQueueIsClosed_((PtrToQueue)->q)
+
+#define GSetBlockingQueueGetSize(PtrToQueue)                                 \
+  GSetBlockingQueueGetSize_((PtrToQueue)->q)
+
+#define GSetBlockingQueueGetCapacity(PtrToQueue)                             \
+  GSetBlockingQueueGetCapacity_((PtrToQueue)->q)
+
+#define GSetBlockingQueueAdd(PtrToQueue, Data)                               \
+  ((void)sizeof((PtrToQueue)->t = (Data)),                                   \
+    _Generic((PtrToQueue),                                                   \
+      GSetBlockingQueueChar*: GSetBlockingQueueAdd_Char,                     \
+      GSetBlockingQueueUChar*: GSetBlockingQueueAdd_UChar,                   \
+      GSetBlockingQueueInt*: GSetBlockingQueueAdd_Int,                       \
+      GSetBlockingQueueUInt*: GSetBlockingQueueAdd_UInt,                     \
+      GSetBlockingQueueLong*: GSetBlockingQueueAdd_Long,                     \
+      GSetBlockingQueueULong*: GSetBlockingQueueAdd_ULong,                   \
+      GSetBlockingQueueFloat*: GSetBlockingQueueAdd_Float,                   \
+      GSetBlockingQueueDouble*: GSetBlockingQueueAdd_Double,                 \
+      default: GSetBlockingQueueAdd_Ptr)((PtrToQueue)->q, Data))
+
+#define GSetBlockingQueueAddArr(PtrToQueue, Nb, Arr)                         \
+  _Generic((PtrToQueue),                                                     \
+    GSetBlockingQueueChar*: GSetBlockingQueueAddArr_Char,                    \
+    GSetBlockingQueueUChar*: GSetBlockingQueueAddArr_UChar,                  \
+    GSetBlockingQueueInt*: GSetBlockingQueueAddArr_Int,                      \
+    GSetBlockingQueueUInt*: GSetBlockingQueueAddArr_UInt,                    \
+    GSetBlockingQueueLong*: GSetBlockingQueueAddArr_Long,                    \
+    GSetBlockingQueueULong*: GSetBlockingQueueAddArr_ULong,                  \
+    GSetBlockingQueueFloat*: GSetBlockingQueueAddArr_Float,                  \
+    GSetBlockingQueueDouble*: GSetBlockingQueueAddArr_Double,                \
+    default: GSetBlockingQueueAddArr_Ptr)(                                   \
+      (PtrToQueue)->q, Nb, (void const*)(1 ? (Arr) : &((PtrToQueue)->t)))
+
+#define GSetBlockingQueuePop(PtrToQueue, PtrToData)                          \
+  _Generic((PtrToQueue),                                                     \
+    GSetBlockingQueueChar*: GSetBlockingQueuePop_Char,                       \
+    GSetBlockingQueueUChar*: GSetBlockingQueuePop_UChar,                     \
+    GSetBlockingQueueInt*: GSetBlockingQueuePop_Int,                         \
+    GSetBlockingQueueUInt*: GSetBlockingQueuePop_UInt,                       \
+    GSetBlockingQueueLong*: GSetBlockingQueuePop_Long,                       \
+    GSetBlockingQueueULong*: GSetBlockingQueuePop_ULong,                     \
+    GSetBlockingQueueFloat*: GSetBlockingQueuePop_Float,                     \
+    GSetBlockingQueueDouble*: GSetBlockingQueuePop_Double,                   \
+    default: GSetBlockingQueuePop_Ptr)(                                      \
+      (PtrToQueue)->q, (void*)(1 ? (PtrToData) : &((PtrToQueue)->t)))
+
+#define GSetBlockingQueueTimedPop(PtrToQueue, PtrToData, Timeout)            \
+  _Generic((PtrToQueue),                                                     \
+    GSetBlockingQueueChar*: GSetBlockingQueueTimedPop_Char,                  \
+    GSetBlockingQueueUChar*: GSetBlockingQueueTimedPop_UChar,                \
+    GSetBlockingQueueInt*: GSetBlockingQueueTimedPop_Int,                    \
+    GSetBlockingQueueUInt*: GSetBlockingQueueTimedPop_UInt,                  \
+    GSetBlockingQueueLong*: GSetBlockingQueueTimedPop_Long,                  \
+    GSetBlockingQueueULong*: GSetBlockingQueueTimedPop_ULong,                \
+    GSetBlockingQueueFloat*: GSetBlockingQueueTimedPop_Float,                \
+    GSetBlockingQueueDouble*: GSetBlockingQueueTimedPop_Double,              \
+    default: GSetBlockingQueueTimedPop_Ptr)(                                 \
+      (PtrToQueue)->q, (void*)(1 ? (PtrToData) : &((PtrToQueue)->t)),        \
+      Timeout)
+
+#define GSetBlockingQueuePopArr(PtrToQueue, Nb, Arr)                         \
+  _Generic((PtrToQueue),                                                     \
+    GSetBlockingQueueChar*: GSetBlockingQueuePopArr_Char,                    \
+    GSetBlockingQueueUChar*: GSetBlockingQueuePopArr_UChar,                  \
+    GSetBlockingQueueInt*: GSetBlockingQueuePopArr_Int,                      \
+    GSetBlockingQueueUInt*: GSetBlockingQueuePopArr_UInt,                    \
+    GSetBlockingQueueLong*: GSetBlockingQueuePopArr_Long,                    \
+    GSetBlockingQueueULong*: GSetBlockingQueuePopArr_ULong,                  \
+    GSetBlockingQueueFloat*: GSetBlockingQueuePopArr_Float,                  \
+    GSetBlockingQueueDouble*: GSetBlockingQueuePopArr_Double,                \
+    default: GSetBlockingQueuePopArr_Ptr)(                                   \
+      (PtrToQueue)->q, Nb, (void*)(1 ? (Arr) : &((PtrToQueue)->t)))
+
+#define GSetShardedFree(PtrToPtrToSet)                                       \
+  if (((PtrToPtrToSet) != NULL) && (*(PtrToPtrToSet) != NULL)) {             \
+    GSetShardedFree_(&((*(PtrToPtrToSet))->s));                              \
+    free(*(PtrToPtrToSet));                                                  \
+    *(PtrToPtrToSet) = NULL;                                                 \
+  }
+
+#define GSetShardedGetNbShard(PtrToSet)                                      \
+  GSetShardedGetNbShard_((PtrToSet)->s)
+
+#define GSetShardedGetSize(PtrToSet)                                         \
+  GSetShardedGetSize_((PtrToSet)->s)
+
+#define GSetShardedAdd(PtrToSet, Data)                                       \
+  ((void)sizeof((PtrToSet)->t = (Data)),                                     \
+    _Generic((PtrToSet),                                                     \
+      GSetShardedChar*: GSetShardedAdd_Char,                                 \
+      GSetShardedUChar*: GSetShardedAdd_UChar,                               \
+      GSetShardedInt*: GSetShardedAdd_Int,                                   \
+      GSetShardedUInt*: GSetShardedAdd_UInt,                                 \
+      GSetShardedLong*: GSetShardedAdd_Long,                                 \
+      GSetShardedULong*: GSetShardedAdd_ULong,                               \
+      GSetShardedFloat*: GSetShardedAdd_Float,                               \
+      GSetShardedDouble*: GSetShardedAdd_Double,                             \
+      default: GSetShardedAdd_Ptr)((PtrToSet)->s, Data))
+
+#define GSetShardedContains(PtrToSet, Data)                                  \
+  ((void)sizeof((PtrToSet)->t = (Data)),                                     \
+    _Generic((PtrToSet),                                                     \
+      GSetShardedChar*: GSetShardedContains_Char,                            \
+      GSetShardedUChar*: GSetShardedContains_UChar,                          \
+      GSetShardedInt*: GSetShardedContains_Int,                              \
+      GSetShardedUInt*: GSetShardedContains_UInt,                            \
+      GSetShardedLong*: GSetShardedContains_Long,                            \
+      GSetShardedULong*: GSetShardedContains_ULong,                          \
+      GSetShardedFloat*: GSetShardedContains_Float,                          \
+      GSetShardedDouble*: GSetShardedContains_Double,                        \
+      default: GSetShardedContains_Ptr)((PtrToSet)->s, Data))
+
+#define GSetShardedRemove(PtrToSet, Data)                                    \
+  ((void)sizeof((PtrToSet)->t = (Data)),                                     \
+    _Generic((PtrToSet),                                                     \
+      GSetShardedChar*: GSetShardedRemove_Char,                              \
+      GSetShardedUChar*: GSetShardedRemove_UChar,                            \
+      GSetShardedInt*: GSetShardedRemove_Int,                                \
+      GSetShardedUInt*: GSetShardedRemove_UInt,                              \
+      GSetShardedLong*: GSetShardedRemove_Long,                              \
+      GSetShardedULong*: GSetShardedRemove_ULong,                            \
+      GSetShardedFloat*: GSetShardedRemove_Float,                            \
+      GSetShardedDouble*: GSetShardedRemove_Double,                          \
+      default: GSetShardedRemove_Ptr)((PtrToSet)->s, Data))
+
+#define GSetShardedForEach(PtrToSet, Fun, Params)                            \
+  GSetShardedForEach_((PtrToSet)->s, Fun, Params)
+
+#define GSetSave(PtrToSet, Stream)                                           \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetSave_Char,                                                \
+    GSetUChar*: GSetSave_UChar,                                              \
+    GSetInt*: GSetSave_Int,                                                  \
+    GSetUInt*: GSetSave_UInt,                                                \
+    GSetLong*: GSetSave_Long,                                                \
+    GSetULong*: GSetSave_ULong,                                              \
+    GSetFloat*: GSetSave_Float,                                              \
+    GSetDouble*: GSetSave_Double)((PtrToSet)->s, Stream)
+
+#define GSetLoad(PtrToSet, Stream)                                           \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetLoad_Char,                                                \
+    GSetUChar*: GSetLoad_UChar,                                              \
+    GSetInt*: GSetLoad_Int,                                                  \
+    GSetUInt*: GSetLoad_UInt,                                                \
+    GSetLong*: GSetLoad_Long,                                                \
+    GSetULong*: GSetLoad_ULong,                                              \
+    GSetFloat*: GSetLoad_Float,                                              \
+    GSetDouble*: GSetLoad_Double)((PtrToSet)->s, Stream)
+
+#define GSetSaveWith(PtrToSet, Stream, Fun, Params)                          \
+  GSetSaveWith_((PtrToSet)->s, Stream, Fun, Params)
+
+#define GSetLoadWith(PtrToSet, Stream, Fun, Params)                          \
+  GSetLoadWith_((PtrToSet)->s, Stream, Fun, Params)
+
+#define GSetParseText(PtrToSet, Stream, Delims, PtrToPos)                    \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetParseText_Char,                                           \
+    GSetUChar*: GSetParseText_UChar,                                         \
+    GSetInt*: GSetParseText_Int,                                             \
+    GSetUInt*: GSetParseText_UInt,                                           \
+    GSetLong*: GSetParseText_Long,                                           \
+    GSetULong*: GSetParseText_ULong,                                         \
+    GSetFloat*: GSetParseText_Float,                                         \
+    GSetDouble*: GSetParseText_Double)(                                      \
+      (PtrToSet)->s, Stream, Delims, PtrToPos)
+
+#define GSetParseTextBuf(PtrToSet, Text, Len, Delims, PtrToPos)              \
+  _Generic((PtrToSet),                                                       \
+    GSetChar*: GSetParseTextBuf_Char,                                        \
+    GSetUChar*: GSetParseTextBuf_UChar,                                      \
+    GSetInt*: GSetParseTextBuf_Int,                                          \
+    GSetUInt*: GSetParseTextBuf_UInt,                                        \
+    GSetLong*: GSetParseTextBuf_Long,                                        \
+    GSetULong*: GSetParseTextBuf_ULong,                                      \
+    GSetFloat*: GSetParseTextBuf_Float,                                      \
+    GSetDouble*: GSetParseTextBuf_Double)(                                   \
+      (PtrToSet)->s, Text, Len, Delims, PtrToPos)
+
+#define GSetMapFree(PtrToPtrToMap)                                           \
+  if (((PtrToPtrToMap) != NULL) && (*(PtrToPtrToMap) != NULL)) {             \
+    GSetMapFree_(&((*(PtrToPtrToMap))->s));                                  \
+    free(*(PtrToPtrToMap));                                                  \
+    *(PtrToPtrToMap) = NULL;                                                 \
+  }
+
+#define GSetMapFile(Path, N) GSetMap ## N ## File(Path)
+
+#define GSetMapGetArr(PtrToMap)                                              \
+  _Generic((PtrToMap),                                                       \
+    GSetMapChar*: GSetMapGetArr_Char,                                        \
+    GSetMapUChar*: GSetMapGetArr_UChar,                                      \
+    GSetMapInt*: GSetMapGetArr_Int,                                          \
+    GSetMapUInt*: GSetMapGetArr_UInt,                                        \
+    GSetMapLong*: GSetMapGetArr_Long,                                        \
+    GSetMapULong*: GSetMapGetArr_ULong,                                      \
+    GSetMapFloat*: GSetMapGetArr_Float,                                      \
+    GSetMapDouble*: GSetMapGetArr_Double)((PtrToMap)->s)
+
+#define GSetPackedFree(PtrToPtrToPacked)                                     \
+  if (((PtrToPtrToPacked) != NULL) && (*(PtrToPtrToPacked) != NULL)) {       \
+    GSetPackedFree_(&((*(PtrToPtrToPacked))->s));                            \
+    free(*(PtrToPtrToPacked));                                               \
+    *(PtrToPtrToPacked) = NULL;                                              \
+  }
+
+#define GSetPack(PtrToSet)                                                   \
+  _Generic((PtrToSet),                                                       \
+    GSetLong*: GSetPackedLongEncode,                                         \
+    GSetULong*: GSetPackedULongEncode)(PtrToSet)
+
+#define GSetUnpack(PtrToSet, PtrToPacked)                                    \
+  _Generic((PtrToPacked),                                                    \
+    GSetPackedLong*: GSetPackedLongDecode,                                   \
+    GSetPackedULong*: GSetPackedULongDecode)(PtrToPacked, PtrToSet)
+
+#define GSetPackedGetMemSize(PtrToPacked)                                    \
+  GSetPackedGetMemSize_((PtrToPacked)->s)
+
+#define GSetPackedContains(PtrToPacked, Data)                                \
+  _Generic((PtrToPacked),                                                    \
+    GSetPackedLong*: GSetPackedContains_Long,                                \
+    GSetPackedULong*: GSetPackedContains_ULong)((PtrToPacked)->s, Data)
+
 // ===== Comparison functions for GSet<N>Sort on default typed GSet =======
 
 int GSetCharCmp(
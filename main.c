@@ -1,5 +1,12 @@
 #include <stdio.h>
 #include <assert.h>
+#include <math.h>
+#include <string.h>
+#include <limits.h>
+#include <float.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
 #include "gset.h"
 
 // Loop from 0 to (N - 1)
@@ -275,7 +282,2084 @@ void CharFree(char* that) {(void)that;}
     printf("TestPtr GSet" #Name " OK\n");                                    \
   } while(false)
 
+// Function for the test of GSetParallelForEach, sum the data
+void ParallelSum(
+  void* data,
+  void* params,
+  void* acc) {
+
+  (void)params;
+  *(long*)acc += *(long*)data;
+
+}
+
+// Function for the test of GSetParallelForEach, combine the sums
+void ParallelReduce(
+  void* acc,
+  void const* other,
+  void* params) {
+
+  (void)params;
+  *(long*)acc += *(long const*)other;
+
+}
+
+// Function for the test of GSetParallelForEach, sum in parallel the data
+// of the set in parameter for each data
+void ParallelNested(
+  void* data,
+  void* params,
+  void* acc) {
+
+  (void)data;
+  long accs[3] = {0};
+  GSetParallelForEach(
+    (GSetLong*)params, ParallelSum, NULL, 3, accs, sizeof(long),
+    ParallelReduce);
+  *(long*)acc += accs[0];
+
+}
+
+// Filter for the test of GSetParallelForEach, keep the even data
+bool FilterEven(
+  void* data,
+  void* params) {
+
+  (void)params;
+  return (*(long*)data % 2 == 0);
+
+}
+
+void TestParallelForEach(
+  void) {
+
+  printf("Test GSetParallelForEach\n");
+  GSetLong* set = GSetLongAlloc();
+  long sum = 0;
+  long sumEven = 0;
+  FOR(i, 1000) {
+    GSetAdd(set, (long)i);
+    sum += (long)i;
+    if (i % 2 == 0) sumEven += (long)i;
+  }
+  FOR(nbThread, 6) {
+    long accs[5] = {0};
+    GSetParallelForEach(
+      set, ParallelSum, NULL, nbThread, accs, sizeof(long), ParallelReduce);
+    assert(accs[0] == sum);
+  }
+  GSetIterLong* iter = GSetIterLongAlloc(set);
+  GSetIterSetType(iter, GSetIterBackward);
+  GSetSetFilter(iter, FilterEven, NULL);
+  long accs[4] = {0};
+  GSetIterParallelForEach(
+    iter, ParallelSum, NULL, 4, accs, sizeof(long), ParallelReduce);
+  assert(accs[0] == sumEven);
+  GSetIterFree(&iter);
+  FOR(iRun, 1000) {
+    long accsRun[4] = {0};
+    GSetParallelForEach(
+      set, ParallelSum, NULL, 4, accsRun, sizeof(long), ParallelReduce);
+    assert(accsRun[0] == sum);
+  }
+  GSetLong* setOuter = GSetLongAlloc();
+  FOR(i, 8) GSetAdd(setOuter, (long)i);
+  long accsOuter[4] = {0};
+  GSetParallelForEach(
+    setOuter, ParallelNested, set, 4, accsOuter, sizeof(long),
+    ParallelReduce);
+  assert(accsOuter[0] == 8 * sum);
+  GSetFree(&setOuter);
+  GSetFree(&set);
+  printf("Test GSetParallelForEach OK\n");
+
+}
+
+void TestReduction(
+  void) {
+
+  printf("Test GSetSum/MinMax/Mean/Variance\n");
+  GSetInt* setInt = GSetIntAlloc();
+  GSetDouble* setDouble = GSetDoubleAlloc();
+  assert(GSetSum(setInt) == 0);
+  bool flagCatch = false;
+  Try {GSetMean(setDouble);}
+    Catch(TryCatchExc_OutOfRange) {flagCatch = true;} EndCatch;
+  assert(flagCatch == true);
+  FOR(i, 1001) {
+    GSetAdd(setInt, (int)i - 500);
+    GSetAdd(setDouble, 1e8 + 0.1 * (double)i);
+  }
+  assert(GSetSum(setInt) == 0);
+  int minInt = 0;
+  int maxInt = 0;
+  GSetMinMax(setInt, &minInt, &maxInt);
+  assert(minInt == -500 && maxInt == 500);
+  assert(fabs(GSetMean(setInt)) < 1e-12);
+  assert(fabs(GSetVariance(setInt) - 83500.0) < 1e-6);
+  double minDouble = 0.0;
+  double maxDouble = 0.0;
+  GSetMinMax(setDouble, &minDouble, &maxDouble);
+  assert(minDouble == 1e8 && maxDouble == 1e8 + 100.0);
+  assert(fabs(GSetSum(setDouble) - 100100050050.0) < 1e-3);
+  assert(fabs(GSetMean(setDouble) - 100000050.0) < 1e-6);
+  assert(fabs(GSetVariance(setDouble) - 835.0) < 1e-6);
+  GSetEmpty(setDouble);
+  GSetAdd(setDouble, 1.0);
+  GSetAdd(setDouble, INFINITY);
+  GSetAdd(setDouble, 2.0);
+  assert(GSetSum(setDouble) == INFINITY);
+  GSetAdd(setDouble, -INFINITY);
+  assert(isnan(GSetSum(setDouble)));
+  GSetLong* setLong = GSetLongAlloc();
+  GSetAdd(setLong, LONG_MAX);
+  GSetAdd(setLong, 1);
+  GSetAdd(setLong, -1);
+  assert(GSetSum(setLong) == LONG_MAX);
+  GSetFree(&setLong);
+  GSetFree(&setInt);
+  GSetFree(&setDouble);
+  printf("Test GSetSum/MinMax/Mean/Variance OK\n");
+
+}
+
+// Function for the test of GSetApplyWith, square the data
+void ApplySquare(
+  void* data,
+  void* params) {
+
+  (void)params;
+  *(long*)data *= *(long*)data;
+
+}
+
+void TestApply(
+  void) {
+
+  printf("Test GSetApply\n");
+  GSetDouble* setDouble = GSetDoubleFromArr(SIZE_ARR, arrDouble);
+  GSetIterDouble* iter = GSetIterDoubleAlloc(setDouble);
+  GSetApply(setDouble, GSetApplyOp_Affine, 2.0, -1.0);
+  GSETENUM(iter, idx) assert(GSetGet(iter) == 2.0 * arrDouble[idx] - 1.0);
+  GSetApply(setDouble, GSetApplyOp_Clamp, 2.0, 4.0);
+  GSETENUM(iter, idx) assert(GSetGet(iter) == (idx == 0 ? 2.0 : idx + 2.0));
+  GSetApply(setDouble, GSetApplyOp_Scale, 0.5, 0.0);
+  GSetApply(setDouble, GSetApplyOp_Offset, 1.0, 0.0);
+  assert(GSetSum(setDouble) == 7.5);
+  bool flagCatch = false;
+  Try {GSetApply(setDouble, (GSetApplyOp)-1, 0.0, 0.0);}
+    Catch(TryCatchExc_NotYetImplemented) {flagCatch = true;} EndCatch;
+  assert(flagCatch == true);
+  GSetIterFree(&iter);
+  GSetFree(&setDouble);
+  GSetLong* setLong = GSetLongFromArr(SIZE_ARR, arrLong);
+  GSetApplyWith(setLong, ApplySquare, NULL);
+  assert(GSetSum(setLong) == 14);
+  GSetFree(&setLong);
+  printf("Test GSetApply OK\n");
+
+}
+
+// Hash function for the test of GSetAttachIndexWith, hash of a string
+size_t StrHash(
+  void const* data) {
+
+  size_t hash = 5381;
+  for (char const* c = *(char* const*)data; *c != '\0'; ++c)
+    hash = hash * 33 + (size_t)(*c);
+  return hash;
+
+}
+
+// Equality function for the test of GSetAttachIndexWith
+bool StrEq(
+  void const* a,
+  void const* b) {
+
+  return (strcmp(*(char* const*)a, *(char* const*)b) == 0);
+
+}
+
+void TestIndex(
+  void) {
+
+  printf("Test GSetAttachIndex\n");
+  GSetLong* setA = GSetLongAlloc();
+  FOR(i, 500) GSetAdd(setA, (long)i);
+  assert(GSetContains(setA, 100l) == true);
+  assert(GSetHasIndex(setA) == false);
+  GSetAttachIndex(setA);
+  assert(GSetHasIndex(setA) == true);
+  for (long i = 500; i < 1000; ++i) GSetPush(setA, i);
+  FOR(i, 1000) assert(GSetContains(setA, (long)i) == true);
+  assert(GSetContains(setA, -1l) == false);
+  assert(GSetPop(setA) == 999);
+  assert(GSetDrop(setA) == 499);
+  assert(GSetContains(setA, 999l) == false);
+  assert(GSetContains(setA, 499l) == false);
+  assert(GSetRemove(setA, 250l) == true);
+  assert(GSetRemove(setA, 250l) == false);
+  assert(GSetContains(setA, 250l) == false);
+  assert(GSetGetSize(setA) == 997);
+  GSetIterLong* iter = GSetIterLongAlloc(setA);
+  assert(GSetFind(iter, 42l) == true);
+  assert(GSetGet(iter) == 42);
+  GSetNext(iter);
+  assert(GSetGet(iter) == 43);
+  assert(GSetPick(iter) == 43);
+  assert(GSetContains(setA, 43l) == false);
+  assert(GSetFind(iter, 43l) == false);
+  assert(GSetGet(iter) == 44);
+  GSetSetFilter(iter, FilterEven, NULL);
+  assert(GSetFind(iter, 45l) == false);
+  assert(GSetFind(iter, 46l) == true);
+  GSetLong* setB = GSetLongAlloc();
+  GSetAttachIndex(setB);
+  FOR(i, 10) GSetAdd(setB, 2000l + (long)i);
+  GSetMerge(setA, setB);
+  assert(GSetContains(setA, 2005l) == true);
+  assert(GSetContains(setB, 2005l) == false);
+  GSetAdd(setB, 3000l);
+  assert(GSetContains(setB, 3000l) == true);
+  GSetSort(setA, GSetLongCmp, false);
+  GSetApply(setA, GSetApplyOp_Offset, 1l, 0l);
+  assert(GSetContains(setA, 2010l) == true);
+  assert(GSetContains(setA, 0l) == false);
+  GSetEmpty(setA);
+  assert(GSetContains(setA, 1l) == false);
+  GSetDetachIndex(setA);
+  assert(GSetHasIndex(setA) == false);
+  GSetIterFree(&iter);
+  GSetFree(&setA);
+  GSetFree(&setB);
+  GSetStr* setStr = GSetStrAlloc();
+  char strA[] = "a";
+  char strB[] = "b";
+  char strA2[] = "a";
+  GSetAdd(setStr, strA);
+  GSetAdd(setStr, strB);
+  GSetAttachIndex(setStr);
+  assert(GSetContains(setStr, strA) == true);
+  assert(GSetContains(setStr, strA2) == false);
+  GSetAttachIndexWith(setStr, StrHash, StrEq);
+  assert(GSetContains(setStr, strA2) == true);
+  assert(GSetRemove(setStr, strA2) == true);
+  assert(GSetGetSize(setStr) == 1);
+  GSetFree(&setStr);
+  printf("Test GSetAttachIndex OK\n");
+
+}
+
+void TestUnique(
+  void) {
+
+  printf("Test GSetUnique\n");
+  GSetInt* setA = GSetIntAlloc();
+  FOR(i, 100) GSetAdd(setA, (int)(i % 7));
+  GSetAttachIndex(setA);
+  assert(GSetUnique(setA, GSetUniqueHash) == 93);
+  assert(GSetGetSize(setA) == 7);
+  GSetIterInt* iter = GSetIterIntAlloc(setA);
+  FOR(i, 7) {
+    assert(GSetGet(iter) == (int)i);
+    GSetNext(iter);
+  }
+  GSetIterFree(&iter);
+  assert(GSetContains(setA, 3) == true);
+  assert(GSetRemove(setA, 3) == true);
+  assert(GSetContains(setA, 3) == false);
+  assert(GSetUnique(setA, GSetUniqueHash) == 0);
+  GSetFree(&setA);
+  GSetDouble* setB = GSetDoubleAlloc();
+  FOR(i, 50) {
+    GSetAdd(setB, (double)(i / 5));
+    GSetAdd(setB, -0.0);
+  }
+  assert(GSetUnique(setB, GSetUniqueHash) == 90);
+  assert(GSetGetSize(setB) == 10);
+  GSetEmpty(setB);
+  FOR(i, 50) GSetAdd(setB, (double)(i / 5));
+  GSetPush(setB, 0.0);
+  assert(GSetUnique(setB, GSetUniqueSorted) == 41);
+  assert(GSetGetSize(setB) == 10);
+  assert(GSetSum(setB) == 45.0);
+  GSetFree(&setB);
+  GSetStr* setStr = GSetStrAlloc();
+  char strA[] = "a";
+  char strB[] = "b";
+  char strA2[] = "a";
+  GSetAdd(setStr, strA);
+  GSetAdd(setStr, strB);
+  GSetAdd(setStr, strA2);
+  GSetAdd(setStr, strA);
+  assert(GSetUnique(setStr, GSetUniqueHash) == 1);
+  GSetAttachIndexWith(setStr, StrHash, StrEq);
+  assert(GSetUnique(setStr, GSetUniqueHash) == 1);
+  assert(GSetGetSize(setStr) == 2);
+  GSetFree(&setStr);
+  printf("Test GSetUnique OK\n");
+
+}
+
+void TestAlgebra(
+  void) {
+
+  printf("Test GSetUnion/Intersect/Difference/SymDiff\n");
+  int flags[4] = {
+    GSetAlgebra_Copy,
+    GSetAlgebra_InPlace,
+    GSetAlgebra_Gallop,
+    GSetAlgebra_InPlace | GSetAlgebra_Gallop
+  };
+  FOR(iFlag, 4) FOR(iOp, 4) {
+    GSetLong* setA = GSetLongAlloc();
+    GSetLong* setB = GSetLongAlloc();
+    for (long i = 0; i < 200; i += 2) GSetAdd(setA, i);
+    for (long i = 0; i < 200; i += 3) GSetAdd(setB, i);
+    if (iOp == 0) GSetUnion(setA, setB, GSetLongCmp, flags[iFlag]);
+    if (iOp == 1) GSetIntersect(setA, setB, GSetLongCmp, flags[iFlag]);
+    if (iOp == 2) GSetDifference(setA, setB, GSetLongCmp, flags[iFlag]);
+    if (iOp == 3) GSetSymDiff(setA, setB, GSetLongCmp, flags[iFlag]);
+    size_t nb = 0;
+    long prev = -1;
+    GSetIterLong* iter = GSetIterLongAlloc(setA);
+    GSETFOR(iter) {
+      long v = GSetGet(iter);
+      bool inA = (v % 2 == 0);
+      bool inB = (v % 3 == 0);
+      assert(prev < v);
+      if (iOp == 0) assert(inA || inB);
+      if (iOp == 1) assert(inA && inB);
+      if (iOp == 2) assert(inA && !inB);
+      if (iOp == 3) assert(inA != inB);
+      prev = v;
+      ++nb;
+    }
+    GSetIterFree(&iter);
+    size_t nbExpected[4] = {133, 34, 66, 99};
+    assert(nb == nbExpected[iOp]);
+    assert(GSetGetSize(setA) == nb);
+    if (flags[iFlag] & GSetAlgebra_InPlace)
+      assert(GSetGetSize(setB) == 0);
+    else
+      assert(GSetGetSize(setB) == 67);
+    GSetFree(&setA);
+    GSetFree(&setB);
+  }
+  GSetLong* setA = GSetLongAlloc();
+  GSetLong* setB = GSetLongAlloc();
+  FOR(i, 10000) GSetAdd(setA, (long)i);
+  GSetAdd(setB, 5000l);
+  GSetAdd(setB, 20000l);
+  GSetAttachIndex(setA);
+  GSetIntersect(setA, setB, GSetLongCmp, GSetAlgebra_Gallop);
+  assert(GSetGetSize(setA) == 1);
+  assert(GSetContains(setA, 5000l) == true);
+  assert(GSetContains(setA, 4999l) == false);
+  GSetEmpty(setA);
+  GSetEmpty(setB);
+  long dataA[3] = {1, 1, 2};
+  long dataB[3] = {1, 3, 3};
+  FOR(i, 3) {
+    GSetAdd(setA, dataA[i]);
+    GSetAdd(setB, dataB[i]);
+  }
+  GSetUnion(
+    setA, setB, GSetLongCmp, GSetAlgebra_InPlace | GSetAlgebra_Gallop);
+  long dataC[5] = {1, 1, 2, 3, 3};
+  assert(GSetGetSize(setA) == 5);
+  GSetIterLong* iter = GSetIterLongAlloc(setA);
+  GSETENUM(iter, idx) assert(GSetGet(iter) == dataC[idx]);
+  GSetIterFree(&iter);
+  assert(GSetContains(setA, 3l) == true);
+  GSetSymDiff(setA, setA, GSetLongCmp, GSetAlgebra_Copy);
+  assert(GSetGetSize(setA) == 0);
+  GSetFree(&setA);
+  GSetFree(&setB);
+  printf("Test GSetUnion/Intersect/Difference/SymDiff OK\n");
+
+}
+
+// Comparison function for the test of GSetMergeSorted, compare the tens
+int CmpTens(
+  void const* a,
+  void const* b) {
+
+  long va = *(long const*)a / 10;
+  long vb = *(long const*)b / 10;
+  return (va < vb ? -1 : (va > vb ? 1 : 0));
+
+}
+
+void TestMergeSorted(
+  void) {
+
+  printf("Test GSetMergeSorted\n");
+  GSetLong* setDst = GSetLongAlloc();
+  GSetLong* sets[6];
+  FOR(iSet, 5) {
+    sets[iSet] = GSetLongAlloc();
+    FOR(i, iSet * 37) GSetAdd(sets[iSet], (long)(i * 100 + iSet));
+  }
+  sets[5] = sets[3];
+  FOR(i, 20) GSetAdd(setDst, (long)(i * 100 + 9));
+  GSetAttachIndex(setDst);
+  GSetAttachIndex(sets[4]);
+  GSetMergeSorted(setDst, sets, 6, CmpTens);
+  assert(GSetGetSize(setDst) == 20 + 37 * 10);
+  FOR(iSet, 5) assert(GSetGetSize(sets[iSet]) == 0);
+  assert(GSetContains(setDst, 4l) == true);
+  assert(GSetContains(setDst, 13604l) == true);
+  assert(GSetContains(sets[4], 4l) == false);
+  GSetIterLong* iter = GSetIterLongAlloc(setDst);
+  long prev = -100;
+  GSETFOR(iter) {
+    long v = GSetGet(iter);
+    if (v % 100 == 9) assert(prev / 100 < v / 100);
+    else if (v / 100 == prev / 100)
+      assert(prev % 100 == 9 || prev % 100 < v % 100);
+    else assert(prev / 100 < v / 100);
+    prev = v;
+  }
+  GSetIterFree(&iter);
+  assert(GSetDrop(setDst) == 14704);
+  GSetMergeSorted(setDst, &setDst, 1, CmpTens);
+  assert(GSetGetSize(setDst) == 20 + 37 * 10 - 1);
+  FOR(iSet, 5) GSetFree(sets + iSet);
+  GSetFree(&setDst);
+  GSetStr* strDst = GSetStrAlloc();
+  GSetStr* strSrc = GSetStrAlloc();
+  char strA[] = "a";
+  char strB[] = "b";
+  char strC[] = "c";
+  GSetAdd(strDst, strA);
+  GSetAdd(strDst, strC);
+  GSetAdd(strSrc, strB);
+  GSetStrMergeSorted(strDst, &strSrc, 1, GSetStrCmp);
+  assert(GSetGetSize(strSrc) == 0);
+  assert(GSetPop(strDst) == strA);
+  assert(GSetPop(strDst) == strB);
+  assert(GSetPop(strDst) == strC);
+  GSetFree(&strSrc);
+  GSetFree(&strDst);
+  printf("Test GSetMergeSorted OK\n");
+
+}
+
+void TestInsertSorted(
+  void) {
+
+  printf("Test GSetInsertSorted\n");
+  GSetLong* set = GSetLongAlloc();
+  FOR(i, 1000) GSetInsertSorted(set, (long)((i * 7919) % 500), GSetLongCmp);
+  assert(GSetGetSize(set) == 1000);
+  GSetIterLong* iter = GSetIterLongAlloc(set);
+  long prev = -1;
+  GSETFOR(iter) {
+    assert(prev <= GSetGet(iter));
+    prev = GSetGet(iter);
+  }
+  assert(GSetLowerBound(iter, 250, GSetLongCmp) == true);
+  assert(GSetGet(iter) == 250);
+  GSetNext(iter);
+  assert(GSetGet(iter) == 250);
+  GSetNext(iter);
+  assert(GSetGet(iter) == 251);
+  assert(GSetUpperBound(iter, 250, GSetLongCmp) == true);
+  assert(GSetGet(iter) == 251);
+  assert(GSetUpperBound(iter, 499, GSetLongCmp) == false);
+  assert(GSetGet(iter) == 251);
+  assert(GSetPop(set) == 0);
+  assert(GSetPop(set) == 0);
+  assert(GSetDrop(set) == 499);
+  assert(GSetRemove(set, 100) == true);
+  assert(GSetLowerBound(iter, -5, GSetLongCmp) == true);
+  assert(GSetGet(iter) == 1);
+  assert(GSetLowerBound(iter, 100, GSetLongCmp) == true);
+  assert(GSetGet(iter) == 100);
+  GSetNext(iter);
+  assert(GSetGet(iter) == 101);
+  GSetSetFilter(iter, FilterEven, NULL);
+  assert(GSetLowerBound(iter, 101, GSetLongCmp) == true);
+  assert(GSetGet(iter) == 102);
+  GSetIterFree(&iter);
+  GSetPush(set, -1);
+  GSetInsertSorted(set, 600, GSetLongCmp);
+  assert(GSetGetSize(set) == 998);
+  assert(GSetPop(set) == -1);
+  assert(GSetDrop(set) == 600);
+  GSetFree(&set);
+  printf("Test GSetInsertSorted OK\n");
+
+}
+
+void TestRemoveIf(
+  void) {
+
+  printf("Test GSetRemoveIf\n");
+  GSetLong* setA = GSetLongAlloc();
+  GSetLong* setB = GSetLongAlloc();
+  FOR(i, 100) GSetAdd(setA, (long)i);
+  GSetAttachIndex(setA);
+  GSetAttachIndex(setB);
+  GSetAdd(setB, -1l);
+  assert(GSetMoveIf(setA, FilterEven, NULL, setB) == 50);
+  assert(GSetGetSize(setA) == 50);
+  assert(GSetGetSize(setB) == 51);
+  assert(GSetContains(setA, 42l) == false);
+  assert(GSetContains(setB, 42l) == true);
+  assert(GSetPop(setB) == -1);
+  GSetIterLong* iter = GSetIterLongAlloc(setB);
+  GSETENUM(iter, idx) assert(GSetGet(iter) == 2 * (long)idx);
+  GSetIterFree(&iter);
+  iter = GSetIterLongAlloc(setA);
+  GSETENUM(iter, idx) assert(GSetGet(iter) == 2 * (long)idx + 1);
+  GSetIterFree(&iter);
+  assert(GSetRemoveIf(setA, FilterEven, NULL) == 0);
+  GSetApply(setA, GSetApplyOp_Offset, 1l, 0l);
+  assert(GSetRemoveIf(setA, FilterEven, NULL) == 50);
+  assert(GSetGetSize(setA) == 0);
+  GSetFree(&setA);
+  GSetFree(&setB);
+  printf("Test GSetRemoveIf OK\n");
+
+}
+
+void TestSplice(
+  void) {
+
+  printf("Test GSetSplitAt/SpliceBefore/MoveRange\n");
+  GSetLong* setA = GSetLongAlloc();
+  GSetLong* setB = GSetLongAlloc();
+  FOR(i, 100) GSetAdd(setA, (long)i);
+  GSetAttachIndex(setB);
+  GSetIterLong* iterA = GSetIterLongAlloc(setA);
+  assert(GSetFind(iterA, 90l) == true);
+  GSetSplitAt(setA, iterA, setB);
+  assert(GSetGetSize(setA) == 90);
+  assert(GSetGetSize(setB) == 10);
+  assert(GSetDrop(setA) == 89);
+  assert(GSetContains(setB, 95l) == true);
+  assert(GSetPop(setB) == 90);
+  assert(GSetDrop(setB) == 99);
+  GSetReset(iterA);
+  GSetNext(iterA);
+  GSetSpliceBefore(iterA, setB);
+  assert(GSetGetSize(setA) == 97);
+  assert(GSetGetSize(setB) == 0);
+  assert(GSetContains(setB, 95l) == false);
+  GSETENUM(iterA, idx) {
+    long v = GSetGet(iterA);
+    if (idx == 0) assert(v == 0);
+    else if (idx < 9) assert(v == 90 + (long)idx);
+    else assert(v == (long)idx - 8);
+  }
+  GSetIterLong* iterB = GSetIterLongAlloc(setA);
+  assert(GSetFind(iterA, 10l) == true);
+  assert(GSetFind(iterB, 19l) == true);
+  GSetMoveRange(iterA, iterB, setB);
+  assert(GSetGetSize(setA) == 87);
+  assert(GSetGetSize(setB) == 10);
+  assert(GSetContains(setB, 15l) == true);
+  GSetIterLong* iterC = GSetIterLongAlloc(setB);
+  GSETENUM(iterC, idx) assert(GSetGet(iterC) == 10 + (long)idx);
+  GSetIterFree(&iterC);
+  assert(GSetFind(iterA, 30l) == true);
+  assert(GSetFind(iterB, 20l) == true);
+  Try {
+    GSetMoveRange(iterA, iterB, setB);
+    assert(false);
+  } Catch (TryCatchExc_OutOfRange) {
+  } EndCatch;
+  GSetIterFree(&iterA);
+  GSetIterFree(&iterB);
+  GSetFree(&setA);
+  GSetFree(&setB);
+  printf("Test GSetSplitAt/SpliceBefore/MoveRange OK\n");
+
+}
+
+// Function for the test of GSetClone, clone a set in another thread whose
+// slabs are released when it exits while the clone is still alive
+void* CloneInThread(
+  void* set) {
+
+  return GSetClone((GSetLong*)set);
+
+}
+
+void TestClone(
+  void) {
+
+  printf("Test GSetClone\n");
+  GSetLong* setA = GSetLongAlloc();
+  FOR(i, 10000) GSetAdd(setA, (long)i);
+  GSetAttachIndex(setA);
+  GSetLong* setB = GSetClone(setA);
+  assert(GSetGetSize(setB) == 10000);
+  assert(GSetHasIndex(setB) == false);
+  GSetIterLong* iter = GSetIterLongAlloc(setB);
+  GSETENUM(iter, idx) assert(GSetGet(iter) == (long)idx);
+  GSetIterFree(&iter);
+  assert(GSetPop(setB) == 0);
+  assert(GSetDrop(setB) == 9999);
+  assert(GSetGetSize(setA) == 10000);
+  GSetAppend(setA, setB);
+  assert(GSetGetSize(setA) == 19998);
+  assert(GSetContains(setA, 5000l) == true);
+  assert(GSetRemove(setA, 5000l) == true);
+  assert(GSetContains(setA, 5000l) == true);
+  iter = GSetIterLongAlloc(setA);
+  GSETENUM(iter, idx) {
+    if (idx < 5000) assert(GSetGet(iter) == (long)idx);
+  }
+  GSetIterFree(&iter);
+  assert(GSetDrop(setA) == 9998);
+  GSetEmpty(setB);
+  GSetLong* setC = GSetClone(setB);
+  assert(GSetGetSize(setC) == 0);
+  GSetAdd(setC, 1l);
+  assert(GSetPop(setC) == 1);
+  FOR(i, 10000) GSetAdd(setB, (long)i);
+  pthread_t thread;
+  int ret = pthread_create(&thread, NULL, CloneInThread, setB);
+  assert(ret == 0);
+  GSetLong* setD = NULL;
+  ret = pthread_join(thread, (void**)&setD);
+  assert(ret == 0);
+  FOR(i, 10000) assert(GSetPop(setD) == (long)i);
+  FOR(i, 10000) GSetAdd(setD, (long)i);
+  assert(GSetDrop(setD) == 9999);
+  GSetFree(&setA);
+  GSetFree(&setB);
+  GSetFree(&setC);
+  GSetFree(&setD);
+  printf("Test GSetClone OK\n");
+
+}
+
 // Main function
+void TestTryPop(
+  void) {
+
+  printf("Test GSetTryPop\n");
+  GSetLong* set = GSetLongAllocNoExc();
+  assert(set != NULL);
+  FOR(i, 10) GSetAdd(set, (long)i);
+  long v = -1;
+  assert(GSetTryPop(set, &v) == true && v == 0);
+  assert(GSetTryDrop(set, &v) == true && v == 9);
+  assert(GSetTryPop(set, NULL) == true);
+  GSetIterLong* iter = GSetIterLongAlloc(set);
+  assert(GSetTryGet(iter, &v) == true && v == 2);
+  assert(GSetTryPick(iter, &v) == true && v == 2);
+  assert(GSetTryGet(iter, &v) == true && v == 3);
+  assert(GSetGetSize(set) == 6);
+  long sum = 0;
+  while (GSetTryPop(set, &v)) sum += v;
+  assert(sum == 3 + 4 + 5 + 6 + 7 + 8);
+  v = -1;
+  assert(GSetTryPop(set, &v) == false && v == -1);
+  assert(GSetTryDrop(set, &v) == false && v == -1);
+  GSetIterReset(iter);
+  assert(GSetTryGet(iter, &v) == false && v == -1);
+  assert(GSetTryPick(iter, &v) == false && v == -1);
+  GSetIterFree(&iter);
+  GSetFree(&set);
+  GSetStr* setStr = GSetStrAllocNoExc();
+  char* str = "a";
+  GSetAdd(setStr, str);
+  char* out = NULL;
+  assert(GSetTryPop(setStr, &out) == true && out == str);
+  assert(GSetTryPop(setStr, &out) == false);
+  GSetFree(&setStr);
+  printf("Test GSetTryPop OK\n");
+
+}
+
+void TestPopArr(
+  void) {
+
+  printf("Test GSetPopArr\n");
+  GSetLong* set = GSetLongAlloc();
+  FOR(i, 1000) GSetAdd(set, (long)i);
+  GSetAttachIndex(set);
+  long arr[600];
+  assert(GSetPopArr(set, 0, arr) == 0);
+  assert(GSetPopArr(set, 300, arr) == 300);
+  FOR(i, 300) assert(arr[i] == (long)i);
+  assert(GSetContains(set, 299l) == false);
+  assert(GSetContains(set, 300l) == true);
+  assert(GSetDropArr(set, 200, arr) == 200);
+  FOR(i, 200) assert(arr[i] == 999l - (long)i);
+  assert(GSetContains(set, 800l) == false);
+  assert(GSetGetSize(set) == 500);
+  assert(GSetDropArr(set, 10, NULL) == 10);
+  assert(GSetPopArr(set, 600, arr) == 490);
+  FOR(i, 490) assert(arr[i] == 300l + (long)i);
+  assert(GSetGetSize(set) == 0);
+  assert(GSetPopArr(set, 10, arr) == 0);
+  assert(GSetDropArr(set, 10, arr) == 0);
+  GSetAdd(set, 1l);
+  GSetAdd(set, 2l);
+  assert(GSetDropArr(set, 5, arr) == 2 && arr[0] == 2 && arr[1] == 1);
+  assert(GSetTryPop(set, NULL) == false);
+  GSetAdd(set, 3l);
+  assert(GSetPop(set) == 3);
+  GSetFree(&set);
+  GSetStr* setStr = GSetStrAlloc();
+  char* strs[3] = {"a", "b", "c"};
+  GSetAddArr(setStr, 3, strs);
+  char* out[3] = {NULL};
+  assert(GSetDropArr(setStr, 1, out) == 1 && out[0] == strs[2]);
+  assert(GSetPopArr(setStr, 3, out) == 2);
+  assert(out[0] == strs[0] && out[1] == strs[1]);
+  GSetFree(&setStr);
+  printf("Test GSetPopArr OK\n");
+
+}
+
+void TestBounded(
+  void) {
+
+  printf("Test GSetAllocBounded\n");
+  GSetDouble* set = GSetDoubleAllocBounded(4, GSetBounded_Overwrite);
+  assert(GSetGetCapacity(set) == 4);
+  FOR(i, 10) GSetAdd(set, (double)i);
+  assert(GSetGetSize(set) == 4);
+  GSetIterDouble* iter = GSetIterDoubleAlloc(set);
+  GSETENUM(iter, idx) assert(GSetGet(iter) == 6.0 + (double)idx);
+  GSetPush(set, 100.0);
+  assert(GSetGetSize(set) == 4);
+  assert(GSetDrop(set) == 8.0);
+  assert(GSetPop(set) == 100.0);
+  double arr[3] = {20.0, 21.0, 22.0};
+  GSetAddArr(set, 3, arr);
+  assert(GSetGetSize(set) == 4);
+  GSetIterReset(iter);
+  assert(GSetGet(iter) == 7.0);
+  GSetEmpty(set);
+  GSetAddArr(set, 3, arr);
+  assert(GSetDropArr(set, 2, NULL) == 2);
+  assert(GSetPop(set) == 20.0);
+  GSetIterFree(&iter);
+  GSetFree(&set);
+  GSetLong* setB = GSetLongAllocBounded(3, GSetBounded_Reject);
+  GSetAttachIndex(setB);
+  FOR(i, 3) GSetAdd(setB, (long)i);
+  Try {
+    GSetAdd(setB, 3l);
+    assert(false);
+  } Catch(TryCatchExc_OutOfRange) {
+  } EndCatch;
+  Try {
+    GSetPush(setB, 3l);
+    assert(false);
+  } Catch(TryCatchExc_OutOfRange) {
+  } EndCatch;
+  assert(GSetGetSize(setB) == 3);
+  assert(GSetContains(setB, 3l) == false);
+  assert(GSetPop(setB) == 0);
+  GSetPush(setB, 5l);
+  assert(GSetContains(setB, 5l) == true);
+  assert(GSetContains(setB, 0l) == false);
+  GSetFree(&setB);
+  GSetLong* setC = GSetLongAllocBounded(2, GSetBounded_Overwrite);
+  GSetAttachIndex(setC);
+  FOR(i, 5) GSetAdd(setC, (long)i);
+  assert(GSetContains(setC, 2l) == false);
+  assert(GSetContains(setC, 3l) == true);
+  assert(GSetContains(setC, 4l) == true);
+  GSetLong* setD = GSetClone(setC);
+  assert(GSetGetCapacity(setD) == 0);
+  GSetEmpty(setD);
+  FOR(i, 10) GSetAdd(setD, (long)i);
+  GSetLong* setE = GSetLongAllocBounded(4, GSetBounded_Overwrite);
+  GSetAppend(setE, setD);
+  assert(GSetGetSize(setE) == 4);
+  FOR(i, 4) assert(GSetPop(setE) == 6 + (long)i);
+  GSetFree(&setE);
+  setE = GSetLongAllocBounded(3, GSetBounded_Reject);
+  Try {
+    GSetAppend(setE, setD);
+    assert(false);
+  } Catch(TryCatchExc_OutOfRange) {
+  } EndCatch;
+  assert(GSetGetSize(setE) == 3);
+  GSetFree(&setE);
+  GSetFree(&setC);
+  GSetFree(&setD);
+  printf("Test GSetAllocBounded OK\n");
+
+}
+
+void TestWindow(
+  void) {
+
+  printf("Test GSetWindow\n");
+  GSetDouble* set = GSetDoubleAllocBounded(50, GSetBounded_Overwrite);
+  assert(GSetHasWindow(set) == false);
+  GSetAttachWindow(set);
+  assert(GSetHasWindow(set) == true);
+  assert(GSetWindowSum(set) == 0.0);
+  srand(1);
+  FOR(i, 2000) {
+
+    GSetAdd(set, (double)(rand() % 1000) / 10.0 - 50.0);
+    if (i % 7 == 3) (void)GSetPop(set);
+    double min = 0.0;
+    double max = 0.0;
+    GSetMinMax(set, &min, &max);
+    assert(GSetWindowMin(set) == min);
+    assert(GSetWindowMax(set) == max);
+    assert(fabs(GSetWindowSum(set) - GSetSum(set)) < 1e-9);
+    assert(fabs(GSetWindowMean(set) - GSetMean(set)) < 1e-9);
+
+  }
+  GSetFree(&set);
+  set = GSetDoubleAllocBounded(3, GSetBounded_Overwrite);
+  GSetAttachWindow(set);
+  GSetAdd(set, 1.0);
+  GSetAdd(set, INFINITY);
+  GSetAdd(set, 2.0);
+  assert(GSetWindowSum(set) == INFINITY);
+  GSetAdd(set, 3.0);
+  GSetAdd(set, 4.0);
+  assert(GSetWindowSum(set) == 9.0);
+  GSetAdd(set, -INFINITY);
+  GSetAdd(set, INFINITY);
+  assert(isnan(GSetWindowSum(set)));
+  GSetAdd(set, NAN);
+  GSetAdd(set, 5.0);
+  assert(isnan(GSetWindowSum(set)));
+  GSetAdd(set, 6.0);
+  GSetAdd(set, 7.0);
+  assert(GSetWindowSum(set) == 18.0);
+  GSetAdd(set, DBL_MAX);
+  GSetAdd(set, DBL_MAX);
+  assert(GSetWindowSum(set) == INFINITY);
+  GSetAdd(set, 1.0);
+  GSetAdd(set, 1.0);
+  assert(GSetWindowSum(set) == DBL_MAX);
+  GSetAdd(set, 1.0);
+  assert(GSetWindowSum(set) == 3.0);
+  GSetFree(&set);
+  GSetLong* setL = GSetLongAlloc();
+  Try {
+    (void)GSetWindowMin(setL);
+    assert(false);
+  } Catch(TryCatchExc_OutOfRange) {
+  } EndCatch;
+  long arr[6] = {5, 3, 8, 1, 9, 2};
+  GSetAddArr(setL, 6, arr);
+  assert(GSetWindowSum(setL) == 28);
+  assert(GSetWindowMin(setL) == 1 && GSetWindowMax(setL) == 9);
+  GSetAttachWindow(setL);
+  assert(GSetWindowSum(setL) == 28);
+  assert(GSetWindowMin(setL) == 1 && GSetWindowMax(setL) == 9);
+  assert(GSetDrop(setL) == 2);
+  GSetPush(setL, -4l);
+  assert(GSetWindowSum(setL) == 22);
+  assert(GSetWindowMin(setL) == -4 && GSetWindowMax(setL) == 9);
+  GSetIterLong* iter = GSetIterLongAlloc(setL);
+  GSetIterNext(iter);
+  GSetIterNext(iter);
+  assert(GSetPick(iter) == 3);
+  GSetIterFree(&iter);
+  assert(GSetWindowSum(setL) == 19);
+  GSetSort(setL, GSetLongCmp, true);
+  GSetPop(setL);
+  assert(GSetWindowMin(setL) == 1 && GSetWindowMax(setL) == 9);
+  GSetLong* setM = GSetLongAlloc();
+  GSetAdd(setM, 100l);
+  GSetAttachWindow(setM);
+  assert(GSetWindowMax(setM) == 100);
+  GSetMerge(setL, setM);
+  assert(GSetWindowMax(setL) == 100 && GSetWindowSum(setL) == 123);
+  assert(GSetWindowSum(setM) == 0);
+  GSetEmpty(setL);
+  assert(GSetWindowSum(setL) == 0);
+  GSetAdd(setL, 7l);
+  assert(GSetWindowMean(setL) == 7.0);
+  GSetAdd(setL, LONG_MAX);
+  assert(GSetWindowSum(setL) == LONG_MIN + 6);
+  assert(GSetDrop(setL) == LONG_MAX);
+  assert(GSetWindowSum(setL) == 7);
+  GSetDetachWindow(setL);
+  assert(GSetHasWindow(setL) == false);
+  assert(GSetWindowSum(setL) == 7);
+  GSetFree(&setL);
+  GSetFree(&setM);
+  printf("Test GSetWindow OK\n");
+
+}
+
+// Number of producer threads and of data per producer in TestConc
+#define CONC_NB_THREAD 4
+#define CONC_NB_DATA 100000
+
+// Producer thread of TestConc, adding CONC_NB_DATA data to the queue
+struct ConcProducer {
+
+  GSetConcLong* queue;
+  long id;
+
+};
+
+void* ConcProduce(
+  void* arg) {
+
+  struct ConcProducer* producer = arg;
+  FOR(i, CONC_NB_DATA)
+    GSetConcAdd(producer->queue, producer->id * CONC_NB_DATA + (long)i);
+  return NULL;
+
+}
+
+void TestConc(
+  void) {
+
+  printf("Test GSetConc\n");
+  GSetConcLong* queue = GSetConcLongAlloc();
+  long v = 0;
+  assert(GSetConcPop(queue, &v) == false);
+  GSetConcAdd(queue, 1l);
+  GSetConcAdd(queue, 2l);
+  assert(GSetConcPop(queue, &v) == true && v == 1);
+  GSetConcAdd(queue, 3l);
+  assert(GSetConcPop(queue, &v) == true && v == 2);
+  assert(GSetConcPop(queue, NULL) == true);
+  assert(GSetConcPop(queue, &v) == false);
+
+  // Several producers, one consumer checking the data of each producer
+  // arrive in order
+  pthread_t threads[CONC_NB_THREAD];
+  struct ConcProducer producers[CONC_NB_THREAD];
+  FOR(i, CONC_NB_THREAD) {
+
+    producers[i] = (struct ConcProducer){ .queue = queue, .id = (long)i };
+    int ret = pthread_create(threads + i, NULL, ConcProduce, producers + i);
+    assert(ret == 0);
+
+  }
+  long next[CONC_NB_THREAD] = {0};
+  size_t nbPop = 0;
+  while (nbPop < CONC_NB_THREAD * CONC_NB_DATA) {
+
+    if (GSetConcPop(queue, &v)) {
+
+      long id = v / CONC_NB_DATA;
+      assert(id >= 0 && id < CONC_NB_THREAD);
+      assert(v % CONC_NB_DATA == next[id]);
+      ++(next[id]);
+      ++nbPop;
+
+    }
+
+  }
+  FOR(i, CONC_NB_THREAD) pthread_join(threads[i], NULL);
+  assert(GSetConcPop(queue, &v) == false);
+
+  // Data left in the queue are freed with it
+  GSetConcAdd(queue, 4l);
+  GSetConcAdd(queue, 5l);
+  GSetConcFree(&queue);
+  assert(queue == NULL);
+  GSetConcStr* queueStr = GSetConcStrAlloc();
+  GSetConcAdd(queueStr, "a");
+  char* str = NULL;
+  assert(GSetConcPop(queueStr, &str) && strcmp(str, "a") == 0);
+  GSetConcFree(&queueStr);
+  printf("Test GSetConc OK\n");
+
+}
+
+// Number of data transfered in TestSpsc
+#define SPSC_NB_DATA 1000000
+
+// Producer thread of TestSpsc, adding data one at a time or by batches
+void* SpscProduce(
+  void* arg) {
+
+  GSetSpscLong* queue = arg;
+  long batch[37];
+  long v = 0;
+  while (v < SPSC_NB_DATA) {
+
+    if (v % 2 == 0) {
+
+      if (GSetSpscAdd(queue, v)) ++v;
+      else sched_yield();
+
+    } else {
+
+      long nb = 0;
+      while (nb < 37 && v + nb < SPSC_NB_DATA) {
+
+        batch[nb] = v + nb;
+        ++nb;
+
+      }
+      size_t nbAdd = GSetSpscAddArr(queue, (size_t)nb, batch);
+      if (nbAdd == 0) sched_yield();
+      v += (long)nbAdd;
+
+    }
+
+  }
+  return NULL;
+
+}
+
+void TestSpsc(
+  void) {
+
+  printf("Test GSetSpsc\n");
+  Try {
+    GSetSpscLong* queue = GSetSpscLongAlloc(0);
+    (void)queue;
+    assert(false);
+  } Catch(TryCatchExc_OutOfRange) {
+  } EndCatch;
+  GSetSpscLong* queue = GSetSpscLongAlloc(5);
+  assert(GSetSpscGetCapacity(queue) == 8);
+  assert(GSetSpscGetSize(queue) == 0);
+  long v = 0;
+  assert(GSetSpscPop(queue, &v) == false);
+  long arr[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  assert(GSetSpscAdd(queue, 10l));
+  assert(GSetSpscAddArr(queue, 10, arr) == 7);
+  assert(GSetSpscAdd(queue, 11l) == false);
+  assert(GSetSpscGetSize(queue) == 8);
+  assert(GSetSpscPop(queue, &v) && v == 10);
+  long out[10] = {0};
+  assert(GSetSpscPopArr(queue, 3, out) == 3);
+  assert(out[0] == 0 && out[1] == 1 && out[2] == 2);
+  assert(GSetSpscAddArr(queue, 4, arr) == 4);
+  assert(GSetSpscPopArr(queue, 10, out) == 8);
+  assert(out[3] == 6 && out[4] == 0 && out[7] == 3);
+  assert(GSetSpscPopArr(queue, 10, NULL) == 0);
+  assert(GSetSpscAdd(queue, 12l));
+  assert(GSetSpscPop(queue, NULL) && GSetSpscGetSize(queue) == 0);
+  GSetSpscFree(&queue);
+
+  // One producer thread, the consumer checks the data arrive in order
+  queue = GSetSpscLongAlloc(1000);
+  pthread_t thread;
+  int ret = pthread_create(&thread, NULL, SpscProduce, queue);
+  assert(ret == 0);
+  long next = 0;
+  while (next < SPSC_NB_DATA) {
+
+    size_t nb = GSetSpscPopArr(queue, (size_t)(next % 5 + 1), out);
+    if (nb == 0) sched_yield();
+    FOR(i, nb) {
+
+      assert(out[i] == next);
+      ++next;
+
+    }
+
+  }
+  pthread_join(thread, NULL);
+  assert(GSetSpscGetSize(queue) == 0);
+  GSetSpscFree(&queue);
+  assert(queue == NULL);
+  GSetSpscStr* queueStr = GSetSpscStrAlloc(2);
+  assert(GSetSpscAdd(queueStr, "a"));
+  char* str = NULL;
+  assert(GSetSpscPop(queueStr, &str) && strcmp(str, "a") == 0);
+  GSetSpscFree(&queueStr);
+  printf("Test GSetSpsc OK\n");
+
+}
+
+// Number of thieves and of data in TestDeque
+#define DEQUE_NB_THIEF 3
+#define DEQUE_NB_DATA 200000
+
+// Number of times each data of TestDeque has been taken, and flag set when
+// the owner has pushed all the data
+atomic_int dequeTaken[DEQUE_NB_DATA];
+atomic_bool dequeIsDone;
+
+// Thief thread of TestDeque
+void* DequeSteal(
+  void* arg) {
+
+  GSetDeque* deque = arg;
+  void* data = NULL;
+  while (
+    atomic_load(&dequeIsDone) == false || GSetDequeGetSize(deque) > 0) {
+
+    if (GSetDequeSteal(deque, &data))
+      atomic_fetch_add((atomic_int*)data, 1);
+    else sched_yield();
+
+  }
+  return NULL;
+
+}
+
+void TestDeque(
+  void) {
+
+  printf("Test GSetDeque\n");
+  GSetDeque* deque = GSetDequeAlloc();
+  void* data = NULL;
+  assert(GSetDequePop(deque, &data) == false);
+  assert(GSetDequeSteal(deque, &data) == false);
+  int arr[100] = {0};
+  FOR(i, 100) GSetDequePush(deque, arr + i);
+  assert(GSetDequeGetSize(deque) == 100);
+  assert(GSetDequePop(deque, &data) && data == arr + 99);
+  assert(GSetDequeSteal(deque, &data) && data == arr);
+  assert(GSetDequeSteal(deque, &data) && data == arr + 1);
+  assert(GSetDequePop(deque, NULL) && GSetDequeGetSize(deque) == 96);
+  FOR(i, 96) assert(GSetDequePop(deque, &data) && data == arr + 97 - i);
+  assert(GSetDequePop(deque, &data) == false);
+  assert(GSetDequeGetSize(deque) == 0);
+
+  // The owner pushes and pops while thieves steal, each data must be
+  // taken exactly once
+  FOR(i, DEQUE_NB_DATA) atomic_init(dequeTaken + i, 0);
+  atomic_init(&dequeIsDone, false);
+  pthread_t threads[DEQUE_NB_THIEF];
+  FOR(i, DEQUE_NB_THIEF) {
+
+    int ret = pthread_create(threads + i, NULL, DequeSteal, deque);
+    assert(ret == 0);
+
+  }
+  FOR(i, DEQUE_NB_DATA) {
+
+    GSetDequePush(deque, dequeTaken + i);
+    if (i % 3 == 0 && GSetDequePop(deque, &data))
+      atomic_fetch_add((atomic_int*)data, 1);
+
+  }
+  atomic_store(&dequeIsDone, true);
+  while (GSetDequeGetSize(deque) > 0)
+    if (GSetDequePop(deque, &data)) atomic_fetch_add((atomic_int*)data, 1);
+  FOR(i, DEQUE_NB_THIEF) pthread_join(threads[i], NULL);
+  FOR(i, DEQUE_NB_DATA) assert(atomic_load(dequeTaken + i) == 1);
+  GSetDequeFree(&deque);
+  assert(deque == NULL);
+  printf("Test GSetDeque OK\n");
+
+}
+
+// Number of producer threads and of data per producer in
+// TestBlockingQueue
+#define BLOCKINGQUEUE_NB_THREAD 3
+#define BLOCKINGQUEUE_NB_DATA 100000
+
+// Producer thread of TestBlockingQueue, adding data by batches of 7
+void* BlockingQueueProduce(
+  void* arg) {
+
+  GSetBlockingQueueLong* queue = arg;
+  long batch[7];
+  for (long i = 0; i < BLOCKINGQUEUE_NB_DATA; i += 7) {
+
+    size_t nb = 0;
+    while (nb < 7 && i + (long)nb < BLOCKINGQUEUE_NB_DATA) {
+
+      batch[nb] = i + (long)nb;
+      ++nb;
+
+    }
+    size_t nbAdd = GSetBlockingQueueAddArr(queue, nb, batch);
+    assert(nbAdd == nb);
+
+  }
+  return NULL;
+
+}
+
+// Consumer thread of TestBlockingQueue, waiting for a data on an empty
+// queue until it is closed
+void* BlockingQueueWaitClose(
+  void* arg) {
+
+  GSetBlockingQueueLong* queue = arg;
+  long v = 0;
+  bool isPopped = GSetBlockingQueuePop(queue, &v);
+  return (isPopped ? arg : NULL);
+
+}
+
+void TestBlockingQueue(
+  void) {
+
+  printf("Test GSetBlockingQueue\n");
+  GSetBlockingQueueLong* queue = GSetBlockingQueueLongAlloc(4);
+  assert(GSetBlockingQueueGetCapacity(queue) == 4);
+  assert(GSetBlockingQueueGetSize(queue) == 0);
+  long v = 0;
+  assert(GSetBlockingQueueTimedPop(queue, &v, 0.01) == false);
+  assert(GSetBlockingQueueAdd(queue, 1l));
+  long arr[3] = {2, 3, 4};
+  assert(GSetBlockingQueueAddArr(queue, 3, arr) == 3);
+  assert(GSetBlockingQueueGetSize(queue) == 4);
+  assert(GSetBlockingQueueTimedPop(queue, &v, 0.01) && v == 1);
+  long out[10] = {0};
+  assert(GSetBlockingQueuePopArr(queue, 10, out) == 3);
+  assert(out[0] == 2 && out[1] == 3 && out[2] == 4);
+
+  // Several producers adding more data than the capacity, the consumer
+  // gets all the data of each producer in order
+  GSetBlockingQueueFree(&queue);
+  queue = GSetBlockingQueueLongAlloc(16);
+  pthread_t threads[BLOCKINGQUEUE_NB_THREAD];
+  FOR(i, BLOCKINGQUEUE_NB_THREAD) {
+
+    int ret =
+      pthread_create(threads + i, NULL, BlockingQueueProduce, queue);
+    assert(ret == 0);
+
+  }
+  long sum = 0;
+  size_t nbPop = 0;
+  while (nbPop < BLOCKINGQUEUE_NB_THREAD * BLOCKINGQUEUE_NB_DATA) {
+
+    size_t nb = GSetBlockingQueuePopArr(queue, 10, out);
+    assert(nb > 0 && nb <= 10);
+    assert(GSetBlockingQueueGetSize(queue) <= 16);
+    FOR(i, nb) sum += out[i];
+    nbPop += nb;
+
+  }
+  FOR(i, BLOCKINGQUEUE_NB_THREAD) pthread_join(threads[i], NULL);
+  long n = BLOCKINGQUEUE_NB_DATA;
+  assert(sum == BLOCKINGQUEUE_NB_THREAD * n * (n - 1) / 2);
+
+  // A consumer waiting on the empty queue is woken up when it's closed
+  pthread_t thread;
+  int ret = pthread_create(&thread, NULL, BlockingQueueWaitClose, queue);
+  assert(ret == 0);
+  assert(GSetBlockingQueueIsClosed(queue) == false);
+  GSetBlockingQueueClose(queue);
+  void* res = queue;
+  pthread_join(thread, &res);
+  assert(res == NULL);
+  assert(GSetBlockingQueueIsClosed(queue));
+  assert(GSetBlockingQueueAdd(queue, 1l) == false);
+  assert(GSetBlockingQueuePop(queue, &v) == false);
+  GSetBlockingQueueFree(&queue);
+  assert(queue == NULL);
+
+  // Data still in a closed queue can be popped, without maximum capacity
+  queue = GSetBlockingQueueLongAlloc(0);
+  long big[1000];
+  FOR(i, 1000) big[i] = (long)i;
+  assert(GSetBlockingQueueAddArr(queue, 1000, big) == 1000);
+  GSetBlockingQueueClose(queue);
+  assert(GSetBlockingQueueAddArr(queue, 1000, big) == 0);
+  FOR(i, 1000) big[i] = 0;
+  assert(GSetBlockingQueuePopArr(queue, 1000, big) == 1000);
+  FOR(i, 1000) assert(big[i] == (long)i);
+  assert(GSetBlockingQueuePopArr(queue, 1000, NULL) == 0);
+  assert(GSetBlockingQueueTimedPop(queue, NULL, 1.0) == false);
+  GSetBlockingQueueFree(&queue);
+  GSetBlockingQueueStr* queueStr = GSetBlockingQueueStrAlloc(1);
+  GSetBlockingQueueAdd(queueStr, "a");
+  char* str = NULL;
+  assert(GSetBlockingQueuePop(queueStr, &str) && strcmp(str, "a") == 0);
+  GSetBlockingQueueFree(&queueStr);
+  printf("Test GSetBlockingQueue OK\n");
+
+}
+
+// Number of readers and of writer iterations in TestEpoch
+#define EPOCH_NB_READER 3
+#define EPOCH_NB_ITER 200000
+
+// Set read by the readers of TestEpoch, and flag set when the writer is
+// done
+GSetLong* epochSet = NULL;
+atomic_bool epochIsDone;
+
+// Reader thread of TestEpoch, iterating on the set while the writer
+// modifies it
+void* EpochRead(
+  void* arg) {
+
+  GSetIterLong* iter = GSetIterLongAlloc(epochSet);
+  size_t nbRead = 0;
+  while (atomic_load(&epochIsDone) == false) {
+
+    size_t slot = GSetEpochEnter(epochSet);
+    GSetIterReset(iter);
+    long v = 0;
+    if (GSetIterIsReady(iter)) do {
+
+      if (GSetTryGet(iter, &v)) {
+
+        assert(v >= 0 && v < EPOCH_NB_ITER);
+        ++nbRead;
+
+      }
+
+    } while (GSetIterNext(iter));
+    GSetEpochLeave(epochSet, slot);
+
+  }
+  GSetIterFree(&iter);
+  *(size_t*)arg = nbRead;
+  return NULL;
+
+}
+
+void TestEpoch(
+  void) {
+
+  printf("Test GSetEpoch\n");
+  GSetLong* set = GSetLongAlloc();
+  assert(GSetHasEpoch(set) == false);
+  assert(GSetEpochReclaim(set) == 0);
+  GSetAttachEpoch(set);
+  assert(GSetHasEpoch(set) == true);
+
+  // Removed elements are not freed while a reader may access them
+  FOR(i, 10) GSetAdd(set, (long)i);
+  size_t slot = GSetEpochEnter(set);
+  GSetIterLong* iter = GSetIterLongAlloc(set);
+  GSetIterNext(iter);
+  assert(GSetGet(iter) == 1);
+  assert(GSetPop(set) == 0);
+  assert(GSetPop(set) == 1);
+  assert(GSetDrop(set) == 9);
+  assert(GSetEpochReclaim(set) == 3);
+  assert(GSetGet(iter) == 1);
+  assert(GSetIterNext(iter) && GSetGet(iter) == 2);
+  GSetEpochLeave(set, slot);
+  assert(GSetEpochReclaim(set) == 0);
+  GSetIterFree(&iter);
+  GSetEmpty(set);
+  GSetDetachEpoch(set);
+  assert(GSetHasEpoch(set) == false);
+
+  // A bounded set overwriting its data retires the removed elements
+  // instead of recycling them
+  GSetLong* setB = GSetLongAllocBounded(4, GSetBounded_Overwrite);
+  GSetAttachEpoch(setB);
+  FOR(i, 4) GSetAdd(setB, (long)i);
+  slot = GSetEpochEnter(setB);
+  iter = GSetIterLongAlloc(setB);
+  FOR(i, 4) GSetAdd(setB, 4 + (long)i);
+  assert(GSetGetSize(setB) == 4);
+  assert(GSetGet(iter) == 0);
+  assert(GSetIterNext(iter) && GSetGet(iter) == 1);
+  assert(GSetEpochReclaim(setB) == 4);
+  GSetEpochLeave(setB, slot);
+  assert(GSetEpochReclaim(setB) == 0);
+  GSetIterFree(&iter);
+  GSetFree(&setB);
+
+  // One writer adding, inserting and removing data while readers iterate
+  GSetAttachEpoch(set);
+  epochSet = set;
+  atomic_init(&epochIsDone, false);
+  pthread_t threads[EPOCH_NB_READER];
+  size_t nbRead[EPOCH_NB_READER] = {0};
+  FOR(i, EPOCH_NB_READER) {
+
+    int ret = pthread_create(threads + i, NULL, EpochRead, nbRead + i);
+    assert(ret == 0);
+
+  }
+  FOR(i, EPOCH_NB_ITER) {
+
+    GSetAdd(set, (long)i);
+    if (i % 3 == 0) GSetPush(set, (long)i);
+    if (GSetGetSize(set) > 100) {
+
+      (void)GSetPop(set);
+      (void)GSetDrop(set);
+
+    }
+
+  }
+  atomic_store(&epochIsDone, true);
+  FOR(i, EPOCH_NB_READER) pthread_join(threads[i], NULL);
+  FOR(i, EPOCH_NB_READER) assert(nbRead[i] > 0);
+  assert(GSetEpochReclaim(set) == 0);
+  GSetFree(&set);
+  printf("Test GSetEpoch OK\n");
+
+}
+
+// Number of threads and of data per thread in TestSharded
+#define SHARDED_NB_THREAD 4
+#define SHARDED_NB_DATA 5000
+
+// Argument of the threads of TestSharded
+struct ShardedArg {
+
+  GSetShardedLong* set;
+  long first;
+
+};
+
+// Thread of TestSharded, adding its own range of data and removing every
+// other of them
+void* ShardedAddRemove(
+  void* arg) {
+
+  GSetShardedLong* set = ((struct ShardedArg*)arg)->set;
+  long first = ((struct ShardedArg*)arg)->first;
+  FOR(i, SHARDED_NB_DATA) {
+
+    long v = first + (long)i;
+    assert(GSetShardedAdd(set, v));
+    assert(GSetShardedAdd(set, v) == false);
+    assert(GSetShardedContains(set, v));
+
+  }
+  FOR(i, SHARDED_NB_DATA) {
+
+    long v = first + (long)i;
+    if (i % 2 == 0) assert(GSetShardedRemove(set, v));
+
+  }
+  return NULL;
+
+}
+
+// Function of TestSharded summing the data of a sharded set
+void ShardedSum(
+  void* data,
+  void* sum) {
+
+  *(long*)sum += *(long*)data;
+
+}
+
+void TestSharded(
+  void) {
+
+  printf("Test GSetSharded\n");
+  GSetShardedLong* set = GSetShardedLongAlloc(5);
+  assert(GSetShardedGetNbShard(set) == 8);
+  assert(GSetShardedGetSize(set) == 0);
+  assert(GSetShardedContains(set, 1l) == false);
+  assert(GSetShardedRemove(set, 1l) == false);
+  assert(GSetShardedAdd(set, 1l));
+  assert(GSetShardedAdd(set, 1l) == false);
+  assert(GSetShardedContains(set, 1l));
+  assert(GSetShardedGetSize(set) == 1);
+  assert(GSetShardedRemove(set, 1l));
+  assert(GSetShardedContains(set, 1l) == false);
+
+  // Several threads adding and removing data simultaneously
+  pthread_t threads[SHARDED_NB_THREAD];
+  struct ShardedArg args[SHARDED_NB_THREAD];
+  FOR(i, SHARDED_NB_THREAD) {
+
+    args[i].set = set;
+    args[i].first = (long)i * SHARDED_NB_DATA;
+    int ret = pthread_create(threads + i, NULL, ShardedAddRemove, args + i);
+    assert(ret == 0);
+
+  }
+  FOR(i, SHARDED_NB_THREAD) pthread_join(threads[i], NULL);
+  long n = SHARDED_NB_THREAD * SHARDED_NB_DATA;
+  assert(GSetShardedGetSize(set) == (size_t)n / 2);
+  long sum = 0;
+  GSetShardedForEach(set, ShardedSum, &sum);
+  assert(sum == (n / 2) * (n / 2));
+  FOR(i, (size_t)n)
+    assert(GSetShardedContains(set, (long)i) == (i % 2 == 1));
+  GSetShardedFree(&set);
+  assert(set == NULL);
+
+  // -0.0 and 0.0 are the same data
+  GSetShardedDouble* setDouble = GSetShardedDoubleAlloc(1);
+  assert(GSetShardedGetNbShard(setDouble) == 1);
+  assert(GSetShardedAdd(setDouble, 0.0));
+  assert(GSetShardedAdd(setDouble, -0.0) == false);
+  GSetShardedFree(&setDouble);
+
+  // Pointers are compared by identity
+  GSetShardedStr* setStr = GSetShardedStrAlloc(2);
+  char a[] = "a";
+  char b[] = "a";
+  assert(GSetShardedAdd(setStr, a));
+  assert(GSetShardedAdd(setStr, b));
+  assert(GSetShardedContains(setStr, a));
+  assert(GSetShardedRemove(setStr, b));
+  assert(GSetShardedGetSize(setStr) == 1);
+  GSetShardedFree(&setStr);
+  printf("Test GSetSharded OK\n");
+
+}
+
+// Functions of TestSaveLoad writing a string as its length followed by its
+// characters, and reading it back in a newly allocated string
+bool SaveStr(
+  void const* data,
+  FILE* stream,
+  void* params) {
+
+  (void)params;
+  size_t len = strlen(data);
+  return (
+    fwrite(&len, sizeof(len), 1, stream) == 1 &&
+    fwrite(data, 1, len, stream) == len);
+
+}
+
+bool LoadStr(
+  void** data,
+  FILE* stream,
+  void* params) {
+
+  (void)params;
+  size_t len = 0;
+  if (fread(&len, sizeof(len), 1, stream) != 1) return false;
+  char* str = malloc(len + 1);
+  if (str == NULL) return false;
+  if (fread(str, 1, len, stream) != len) {
+
+    free(str);
+    return false;
+
+  }
+
+  str[len] = '\0';
+  *data = str;
+  return true;
+
+}
+
+void TestSaveLoad(
+  void) {
+
+  printf("Test GSetSave/GSetLoad\n");
+
+  // Save and load more data than a block, after the data already in the
+  // loading set
+  FILE* stream = tmpfile();
+  assert(stream != NULL);
+  GSetLong* set = GSetLongAlloc();
+  FOR(i, 10000) GSetAdd(set, (long)i * 3 - 5000);
+  GSetSave(set, stream);
+  rewind(stream);
+  GSetLong* loaded = GSetLongAlloc();
+  GSetAdd(loaded, -1l);
+  GSetAttachIndex(loaded);
+  assert(GSetLoad(loaded, stream) == 10000);
+  assert(GSetGetSize(loaded) == 10001);
+  assert(GSetPop(loaded) == -1);
+  GSetIterLong* iter = GSetIterLongAlloc(set);
+  GSetIterLong* iterLoaded = GSetIterLongAlloc(loaded);
+  do {
+
+    assert(GSetGet(iter) == GSetGet(iterLoaded));
+    (void)GSetNext(iterLoaded);
+
+  } while (GSetNext(iter));
+  assert(GSetContains(loaded, 4999l));
+  GSetIterFree(&iter);
+  GSetIterFree(&iterLoaded);
+  GSetFree(&loaded);
+
+  // Loading into a set of another type or from a truncated stream fails,
+  // the data read before the end of the stream being added
+  rewind(stream);
+  GSetDouble* setDouble = GSetDoubleAlloc();
+  bool flagCatch = false;
+  Try {GSetLoad(setDouble, stream);}
+    Catch(TryCatchExc_IOError) {flagCatch = true;} EndCatch;
+  assert(flagCatch == true);
+  assert(GSetGetSize(setDouble) == 0);
+  GSetFree(&setDouble);
+  fclose(stream);
+  stream = tmpfile();
+  assert(stream != NULL);
+  GSetSave(set, stream);
+  rewind(stream);
+  unsigned char bytes[24 + 100 * sizeof(long)];
+  assert(fread(bytes, 1, sizeof(bytes), stream) == sizeof(bytes));
+  fclose(stream);
+  stream = tmpfile();
+  assert(stream != NULL);
+  assert(fwrite(bytes, 1, sizeof(bytes), stream) == sizeof(bytes));
+  rewind(stream);
+  loaded = GSetLongAlloc();
+  flagCatch = false;
+  Try {GSetLoad(loaded, stream);}
+    Catch(TryCatchExc_IOError) {flagCatch = true;} EndCatch;
+  assert(flagCatch == true);
+  assert(GSetGetSize(loaded) == 100);
+  assert(GSetDrop(loaded) == 99 * 3 - 5000);
+  GSetFree(&loaded);
+  GSetFree(&set);
+  fclose(stream);
+
+  // Data saved on a machine of the other byte order are converted
+  stream = tmpfile();
+  assert(stream != NULL);
+  GSetUInt* setUInt = GSetUIntAlloc();
+  GSetAdd(setUInt, 0x11223344u);
+  GSetAdd(setUInt, 0xaabbccddu);
+  GSetSave(setUInt, stream);
+  rewind(stream);
+  unsigned char swapped[24 + 2 * sizeof(unsigned int)];
+  assert(fread(swapped, 1, sizeof(swapped), stream) == sizeof(swapped));
+  size_t const fields[][2] = {{4, 4}, {8, 2}, {12, 8}, {24, 4}, {28, 4}};
+  FOR(iField, 5) FOR(i, fields[iField][1] / 2) {
+
+    unsigned char* field = swapped + fields[iField][0];
+    unsigned char byte = field[i];
+    field[i] = field[fields[iField][1] - 1 - i];
+    field[fields[iField][1] - 1 - i] = byte;
+
+  }
+  rewind(stream);
+  assert(fwrite(swapped, 1, sizeof(swapped), stream) == sizeof(swapped));
+  rewind(stream);
+  GSetEmpty(setUInt);
+  assert(GSetLoad(setUInt, stream) == 2);
+  assert(GSetPop(setUInt) == 0x11223344u);
+  assert(GSetPop(setUInt) == 0xaabbccddu);
+  fclose(stream);
+
+  // Files of another version of the format, or whose reserved bytes are
+  // not null, are rejected
+  stream = tmpfile();
+  assert(stream != NULL);
+  GSetAdd(setUInt, 1u);
+  GSetSave(setUInt, stream);
+  GSetEmpty(setUInt);
+  unsigned char header[24];
+  rewind(stream);
+  assert(fread(header, 1, sizeof(header), stream) == sizeof(header));
+  FOR(iCase, 2) {
+
+    unsigned char* byte = header + (iCase == 0 ? 8 : 20);
+    unsigned char prev = *byte;
+    *byte ^= 3;
+    rewind(stream);
+    assert(fwrite(header, 1, sizeof(header), stream) == sizeof(header));
+    rewind(stream);
+    flagCatch = false;
+    Try {GSetLoad(setUInt, stream);}
+      Catch(TryCatchExc_IOError) {flagCatch = true;} EndCatch;
+    assert(flagCatch == true);
+    assert(GSetGetSize(setUInt) == 0);
+    *byte = prev;
+
+  }
+  GSetFree(&setUInt);
+  fclose(stream);
+
+  // Sets of pointers are saved with a user defined function, and loaded
+  // into a bounded set
+  stream = tmpfile();
+  assert(stream != NULL);
+  GSetStr* setStr = GSetStrAlloc();
+  GSetAdd(setStr, "a");
+  GSetAdd(setStr, "");
+  GSetAdd(setStr, "abc");
+  GSetSaveWith(setStr, stream, SaveStr, NULL);
+  rewind(stream);
+  GSetStr* loadedStr = GSetStrAllocBounded(4, GSetBounded_Reject);
+  assert(GSetLoadWith(loadedStr, stream, LoadStr, NULL) == 3);
+  assert(GSetGetSize(loadedStr) == 3);
+  char const* strs[3] = {"a", "", "abc"};
+  FOR(i, 3) {
+
+    char* str = GSetPop(loadedStr);
+    assert(strcmp(str, strs[i]) == 0);
+    free(str);
+
+  }
+  GSetFree(&loadedStr);
+  GSetFree(&setStr);
+  fclose(stream);
+  printf("Test GSetSave/GSetLoad OK\n");
+
+}
+
+void TestMapFile(
+  void) {
+
+  printf("Test GSetMapFile\n");
+
+  // Save a set into a temporary file
+  char const* path = "./testMapFile.gset";
+  FILE* stream = fopen(path, "wb");
+  assert(stream != NULL);
+  GSetLong* set = GSetLongAlloc();
+  FOR(i, 1000) GSetAdd(set, (long)i - 500);
+  GSetSave(set, stream);
+  fclose(stream);
+  GSetFree(&set);
+
+  // Map the file and access its data as an array or with the iterator
+  // macros
+  GSetMapLong* map = GSetMapFile(path, Long);
+  assert(GSetGetSize(map) == 1000);
+  long const* arr = GSetMapGetArr(map);
+  assert(arr[0] == -500 && arr[999] == 499);
+  GSetMapIterLong* iter = GSetMapIterLongAlloc(map);
+  assert(GSetIterIsReady(iter) == true);
+  assert(GSetIterIsFirst(iter) == true);
+  assert(GSetIterCount(iter) == 1000);
+  long sum = 0;
+  long prev = -501;
+  GSetIterForEach(iter) {
+
+    long val = GSetIterGet(iter);
+    assert(val == prev + 1);
+    prev = val;
+    sum += val;
+
+  }
+  assert(sum == -500);
+  assert(GSetIterIsLast(iter) == true);
+  assert(GSetIterNext(iter) == false);
+  assert(GSetIterPrev(iter) == true);
+  assert(GSetIterGet(iter) == 498);
+
+  // Filters and backward iteration
+  GSetIterSetFilter(iter, FilterEven, NULL);
+  GSetIterSetType(iter, GSetIterBackward);
+  assert(GSetIterCount(iter) == 500);
+  GSetIterReset(iter);
+  assert(GSetIterGet(iter) == 498);
+  assert(GSetIterNext(iter) == true);
+  long val = 0;
+  assert(GSetIterTryGet(iter, &val) == true && val == 496);
+  GSetIterFree(&iter);
+  GSetMapFree(&map);
+
+  // Mapping a file with data of another type fails
+  bool flagCatch = false;
+  Try {
+
+    GSetMapDouble* mapDouble = GSetMapFile(path, Double);
+    GSetMapFree(&mapDouble);
+
+  } Catch(TryCatchExc_IOError) {flagCatch = true;} EndCatch;
+  assert(flagCatch == true);
+
+  // An empty set gives an empty view
+  stream = fopen(path, "wb");
+  assert(stream != NULL);
+  set = GSetLongAlloc();
+  GSetSave(set, stream);
+  fclose(stream);
+  GSetFree(&set);
+  map = GSetMapFile(path, Long);
+  assert(GSetGetSize(map) == 0);
+  iter = GSetMapIterLongAlloc(map);
+  assert(GSetIterIsReady(iter) == false);
+  assert(GSetIterTryGet(iter, &val) == false);
+  flagCatch = false;
+  Try {(void)GSetIterGet(iter);}
+    Catch(TryCatchExc_OutOfRange) {flagCatch = true;} EndCatch;
+  assert(flagCatch == true);
+  GSetIterFree(&iter);
+  GSetMapFree(&map);
+  remove(path);
+  printf("Test GSetMapFile OK\n");
+
+}
+
+void TestParseText(
+  void) {
+
+  printf("Test GSetParseText\n");
+
+  // Parse a buffer with the default delimiters, consecutive delimiters
+  // being considered as one
+  char const* text = "1, -2;3\n4\t\t+5\r\n";
+  GSetInt* setInt = GSetIntAlloc();
+  GSetTextPos pos;
+  assert(GSetParseTextBuf(setInt, text, strlen(text), NULL, &pos) == 5);
+  int const ints[5] = {1, -2, 3, 4, 5};
+  FOR(i, 5) assert(GSetPop(setInt) == ints[i]);
+  assert(pos.offset == strlen(text) && pos.line == 3 && pos.col == 1);
+
+  // An invalid number stops the parsing, the data before it being added,
+  // and its position is returned
+  text = "10\n20\n3x0\n40";
+  bool flagCatch = false;
+  Try {GSetParseTextBuf(setInt, text, strlen(text), "\n", &pos);}
+    Catch(TryCatchExc_IOError) {flagCatch = true;} EndCatch;
+  assert(flagCatch == true);
+  assert(GSetGetSize(setInt) == 2);
+  assert(pos.offset == 6 && pos.line == 3 && pos.col == 1);
+  GSetFree(&setInt);
+
+  // Integers out of the range of the type of data are invalid
+  char const* valids[] = {
+    "255", "-0", "-9223372036854775808", "18446744073709551615"};
+  char const* invalids[] = {
+    "256", "-1", "9223372036854775808", "18446744073709551616"};
+  GSetUChar* setUChar = GSetUCharAlloc();
+  GSetLong* setLong = GSetLongAlloc();
+  GSetULong* setULong = GSetULongAlloc();
+  FOR(i, 4) {
+
+    GSetTextPos* noPos = NULL;
+    char const* str = valids[i];
+    if (i < 2) GSetParseTextBuf(setUChar, str, strlen(str), NULL, noPos);
+    else if (i == 2) GSetParseTextBuf(setLong, str, strlen(str), NULL, noPos);
+    else GSetParseTextBuf(setULong, str, strlen(str), NULL, noPos);
+    str = invalids[i];
+    flagCatch = false;
+    Try {
+
+      if (i < 2) GSetParseTextBuf(setUChar, str, strlen(str), NULL, noPos);
+      else if (i == 2)
+        GSetParseTextBuf(setLong, str, strlen(str), NULL, noPos);
+      else GSetParseTextBuf(setULong, str, strlen(str), NULL, noPos);
+
+    } Catch(TryCatchExc_IOError) {flagCatch = true;} EndCatch;
+    assert(flagCatch == true);
+
+  }
+  assert(GSetPop(setUChar) == 255 && GSetPop(setUChar) == 0);
+  assert(GSetPop(setLong) == -9223372036854775807L - 1);
+  assert(GSetPop(setULong) == 18446744073709551615UL);
+  GSetFree(&setUChar);
+  GSetFree(&setLong);
+  GSetFree(&setULong);
+
+  // Reals are converted as strtod does
+  char const* reals[] = {
+    "0.1", "-1.5e-3", "1e22", "1e23", "123456789012345678901234567890",
+    "4.9e-324", "2.2250738585072014e-308", ".5", "5.", "1E+2", "-0",
+    "0.30000000000000004", "9007199254740993", "1.7976931348623157e308",
+    "inf", "-Infinity"};
+  GSetDouble* setDouble = GSetDoubleAlloc();
+  FOR(i, sizeof(reals) / sizeof(reals[0])) {
+
+    GSetParseTextBuf(setDouble, reals[i], strlen(reals[i]), NULL, &pos);
+    double val = GSetPop(setDouble);
+    double ref = strtod(reals[i], NULL);
+    assert(val == ref);
+
+  }
+  GSetParseTextBuf(setDouble, "NaN", 3, NULL, &pos);
+  assert(isnan(GSetPop(setDouble)));
+  char const* invalidReals[] = {
+    "1e", "e1", "1.2.3", "--1", "1e999", "0x10", ".", "infinit"};
+  FOR(i, sizeof(invalidReals) / sizeof(invalidReals[0])) {
+
+    char const* str = invalidReals[i];
+    flagCatch = false;
+    Try {GSetParseTextBuf(setDouble, str, strlen(str), NULL, &pos);}
+      Catch(TryCatchExc_IOError) {flagCatch = true;} EndCatch;
+    assert(flagCatch == true);
+
+  }
+  assert(GSetGetSize(setDouble) == 0);
+  GSetFree(&setDouble);
+  GSetFloat* setFloat = GSetFloatAlloc();
+  flagCatch = false;
+  Try {GSetParseTextBuf(setFloat, "0.1,3.5e38", 10, ",", &pos);}
+    Catch(TryCatchExc_IOError) {flagCatch = true;} EndCatch;
+  assert(flagCatch == true && pos.offset == 4);
+  assert(GSetPop(setFloat) == 0.1f);
+
+  // Floats are rounded once, directly to float
+  char const* floats[] = {
+
+    "3.40282347e+38", "1.00000005960464477539062500000000001",
+    "-1.17549435e-38", "0.3", "16777217"
+
+  };
+  FOR(i, 5) {
+
+    GSetParseTextBuf(setFloat, floats[i], strlen(floats[i]), NULL, &pos);
+    assert(GSetPop(setFloat) == strtof(floats[i], NULL));
+
+  }
+  assert(GSetGetSize(setFloat) == 0);
+  GSetFree(&setFloat);
+
+  // Parse a stream larger than the buffer, the numbers straddling the
+  // chunks in which it is read
+  FILE* stream = tmpfile();
+  assert(stream != NULL);
+  FOR(i, 200000) fprintf(stream, "%ld,", (long)i * 7 - 100000);
+  fprintf(stream, "\n12a\n");
+  rewind(stream);
+  setLong = GSetLongAlloc();
+  flagCatch = false;
+  Try {GSetParseText(setLong, stream, ",\n", &pos);}
+    Catch(TryCatchExc_IOError) {flagCatch = true;} EndCatch;
+  assert(flagCatch == true);
+  assert(GSetGetSize(setLong) == 200000);
+  assert(pos.line == 2 && pos.col == 1);
+  GSetIterLong* iter = GSetIterLongAlloc(setLong);
+  long expected = -100000;
+  GSetIterForEach(iter) {
+
+    assert(GSetGet(iter) == expected);
+    expected += 7;
+
+  }
+  GSetIterFree(&iter);
+  GSetEmpty(setLong);
+  rewind(stream);
+  size_t nb = 0;
+  flagCatch = false;
+  Try {nb = GSetParseText(setLong, stream, ",\n", NULL);}
+    Catch(TryCatchExc_IOError) {flagCatch = true;} EndCatch;
+  assert(flagCatch == true && nb == 0);
+  fclose(stream);
+  stream = tmpfile();
+  assert(stream != NULL);
+  fprintf(stream, "1 2 3");
+  rewind(stream);
+  GSetEmpty(setLong);
+  assert(GSetParseText(setLong, stream, " ", &pos) == 3);
+  assert(pos.offset == 5 && pos.line == 1 && pos.col == 6);
+  assert(GSetDrop(setLong) == 3);
+  fclose(stream);
+  GSetFree(&setLong);
+  printf("Test GSetParseText OK\n");
+
+}
+
+// Check the data of a compressed set against the ones of a set, with an
+// iterator and by decoding it into another set
+void CheckPacked(
+        GSetLong* const set,
+  GSetPackedLong* const packed) {
+
+  assert(GSetGetSize(packed) == GSetGetSize(set));
+  GSetIterLong* iter = GSetIterLongAlloc(set);
+  GSetPackedIterLong* iterPacked = GSetPackedIterLongAlloc(packed);
+  GSetIterForEach(iterPacked) {
+
+    assert(GSetIterGet(iterPacked) == GSetIterGet(iter));
+    assert(GSetPackedContains(packed, GSetIterGet(iter)));
+    (void)GSetIterNext(iter);
+
+  }
+  GSetLong* decoded = GSetLongAlloc();
+  assert(GSetUnpack(decoded, packed) == GSetGetSize(set));
+  GSetIterLong* iterDecoded = GSetIterLongAlloc(decoded);
+  GSetIterReset(iter);
+  GSetIterForEach(iterDecoded) {
+
+    assert(GSetIterGet(iterDecoded) == GSetIterGet(iter));
+    (void)GSetIterNext(iter);
+
+  }
+  GSetIterFree(&iterDecoded);
+  GSetFree(&decoded);
+  GSetIterFree(&iterPacked);
+  GSetIterFree(&iter);
+
+}
+
+void TestPacked(
+  void) {
+
+  printf("Test GSetPacked\n");
+
+  // Dense sorted set of ids, with a few gaps and duplicates
+  GSetLong* set = GSetLongAlloc();
+  FOR(i, 100000) {
+
+    if (i % 1000 != 7) GSetAdd(set, (long)i + 1000);
+    if (i % 5000 == 3) GSetAdd(set, (long)i + 1000);
+
+  }
+  GSetPackedLong* packed = GSetPack(set);
+  CheckPacked(set, packed);
+  assert(GSetPackedGetMemSize(packed) * 20 < GSetGetSize(set) * 24);
+  assert(GSetPackedContains(packed, 1007l) == false);
+  assert(GSetPackedContains(packed, 999l) == false);
+  assert(GSetPackedContains(packed, 101000l) == false);
+
+  // Backward iteration and filter, across the blocks
+  GSetPackedIterLong* iter = GSetPackedIterLongAlloc(packed);
+  assert(GSetIterIsFirst(iter) == true);
+  assert(GSetIterGet(iter) == 1000);
+  GSetIterSetType(iter, GSetIterBackward);
+  GSetIterReset(iter);
+  assert(GSetIterIsFirst(iter) == true);
+  assert(GSetIterGet(iter) == 100999);
+  GSetIterSetFilter(iter, FilterEven, NULL);
+  assert(GSetIterCount(iter) == 50000);
+  GSetIterReset(iter);
+  assert(GSetIterGet(iter) == 100998);
+  size_t nb = 1;
+  while (GSetIterNext(iter)) ++nb;
+  assert(nb == 50000);
+  assert(GSetIterIsLast(iter) == true && GSetIterGet(iter) == 1000);
+  assert(GSetIterPrev(iter) == true && GSetIterGet(iter) == 1002);
+  GSetIterFree(&iter);
+  GSetPackedFree(&packed);
+  GSetFree(&set);
+
+  // Data spanning the whole range, blocks of equal data and a set whose
+  // last block is full
+  set = GSetLongAlloc();
+  GSetAdd(set, -9223372036854775807L - 1);
+  FOR(i, 127) GSetAdd(set, -5l);
+  FOR(i, 128) GSetAdd(set, (long)i * 72057594037927936l);
+  GSetAdd(set, 9223372036854775807L);
+  FOR(i, 127) GSetAdd(set, 9223372036854775807L);
+  packed = GSetPack(set);
+  CheckPacked(set, packed);
+  assert(GSetPackedContains(packed, -4l) == false);
+  GSetPackedFree(&packed);
+
+  // Data not sorted in increasing order are encoded without loss
+  GSetEmpty(set);
+  FOR(i, 300) GSetAdd(set, (long)((i * 7919) % 300) - 150);
+  packed = GSetPack(set);
+  CheckPacked(set, packed);
+  assert(GSetPackedContains(packed, 150l) == false);
+  GSetPackedFree(&packed);
+
+  // Empty set
+  GSetEmpty(set);
+  packed = GSetPack(set);
+  CheckPacked(set, packed);
+  iter = GSetPackedIterLongAlloc(packed);
+  assert(GSetIterIsReady(iter) == false);
+  long val = 0;
+  assert(GSetIterTryGet(iter, &val) == false);
+  GSetIterFree(&iter);
+  GSetPackedFree(&packed);
+  GSetFree(&set);
+
+  // Unsigned data above the range of long, decoded into a bounded set
+  GSetULong* setULong = GSetULongAlloc();
+  FOR(i, 200) GSetAdd(setULong, 18446744073709551416UL + i);
+  GSetPackedULong* packedULong = GSetPack(setULong);
+  assert(GSetPackedContains(packedULong, 18446744073709551615UL));
+  GSetULong* bounded = GSetULongAllocBounded(50, GSetBounded_Overwrite);
+  assert(GSetUnpack(bounded, packedULong) == 200);
+  assert(GSetGetSize(bounded) == 50);
+  assert(GSetPop(bounded) == 18446744073709551566UL);
+  GSetFree(&bounded);
+  GSetPackedIterULong* iterULong = GSetPackedIterULongAlloc(packedULong);
+  unsigned long expected = 18446744073709551416UL;
+  GSetIterForEach(iterULong) {
+
+    assert(GSetIterGet(iterULong) == expected);
+    ++expected;
+
+  }
+  GSetIterFree(&iterULong);
+  GSetPackedFree(&packedULong);
+  GSetFree(&setULong);
+  printf("Test GSetPacked OK\n");
+
+}
+
 int main() {
 
   TryCatchSetRaiseStream(stdout);
@@ -294,6 +2378,31 @@ int main() {
     TEST(Double, double);
     TESTPTR(Str, char);
     TESTPTR(Dummy, struct Dummy);
+    TestParallelForEach();
+    TestReduction();
+    TestApply();
+    TestIndex();
+    TestUnique();
+    TestAlgebra();
+    TestMergeSorted();
+    TestInsertSorted();
+    TestRemoveIf();
+    TestSplice();
+    TestClone();
+    TestTryPop();
+    TestPopArr();
+    TestBounded();
+    TestWindow();
+    TestConc();
+    TestSpsc();
+    TestDeque();
+    TestBlockingQueue();
+    TestEpoch();
+    TestSharded();
+    TestSaveLoad();
+    TestMapFile();
+    TestParseText();
+    TestPacked();
     printf("All unit tests OK\n");
 
   } EndCatch;